@@ -16,6 +16,27 @@
 namespace ov {
 namespace snippets {
 
+/**
+ * @interface RuntimeLoopInfo
+ * @brief Describes a Loop of a shape-agnostic kernel. The work amount, ptr increments and finalization offsets
+ *        of such a Loop are passed at runtime and must be derived from the i/o shapes the same way InitLoops does it
+ * @ingroup snippets
+ */
+struct RuntimeLoopInfo {
+    static size_t UNDEFINED_IO;
+    // dimension processed by the Loop, counted from the innermost one
+    size_t dim_idx = 0;
+    // number of elements processed by one iteration
+    size_t increment = 1;
+    // increment of the vector Loop whose remainder is processed by this tail Loop, 0 if it's not a tail Loop
+    size_t tail_of = 0;
+    // vector Loops are followed by tail Loops which apply the finalization offsets instead of them
+    bool apply_finalization = true;
+    // i/o index (inputs first, then outputs) of every Loop port, UNDEFINED_IO if the port isn't connected to i/o
+    std::vector<size_t> io_indexes {};
+    std::vector<int64_t> element_type_sizes {};
+};
+
 /**
  * @interface Schedule
  * @brief Return scheduling information and pointer to generated kernel code
@@ -44,6 +65,8 @@ public:
     ov::PartialShape work_size {};
     bool is_flat {false};
     code ptr {nullptr};
+    // Loops whose parameters are passed at runtime, in the order of their runtime arguments (shape-agnostic kernels only)
+    std::vector<RuntimeLoopInfo> runtime_loops {};
 };
 
 /**
@@ -75,6 +98,7 @@ public:
      struct LoweringResult {
          LoweringResult(code c) : binary_code(c) {}
          code binary_code = nullptr;
+         std::vector<RuntimeLoopInfo> runtime_loops {};
      };
     LoweringResult generate(lowered::LinearIR& linear_ir, const lowered::Config& config, const void* compile_params = nullptr);
 
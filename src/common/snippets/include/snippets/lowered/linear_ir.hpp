@@ -19,6 +19,9 @@ public:
     // True if we should check runtime info for nodes to call specific needed transformations
     bool m_need_fill_tail_register = false;
     size_t m_loop_depth = 1;
+    // True if the kernel must serve all the shapes of the same rank and broadcasting pattern: the work amounts,
+    // pointer increments and finalization offsets of the Loops are passed as runtime arguments
+    bool m_shape_agnostic = false;
 };
 
 /* The control flow of Snippets is built on Linear Intermediate Representation (Linear IR).
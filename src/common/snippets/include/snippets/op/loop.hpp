@@ -94,6 +94,14 @@ public:
     // to skip pointer increments when outer Loop is empty, and work_amount == vector_size (one inner vector Loop)
     // true by default, the optimizations enabled if it's false;
     bool has_outer_loop = true;
+    // Used by shape-agnostic kernels which read the work amount, ptr increments and finalization offsets of the Loop
+    // from the runtime arguments with the index runtime_args_idx. dim_idx is the dimension processed by the Loop
+    // (counted from the innermost one), tail_of is the increment of the vector Loop whose remainder is processed
+    // by this Loop (0 if it's not a tail Loop).
+    static size_t NO_RUNTIME_ARGS;
+    size_t runtime_args_idx = NO_RUNTIME_ARGS;
+    size_t dim_idx = 0;
+    size_t tail_of = 0;
     size_t get_work_amount() const;
     size_t get_increment() const;
     bool get_evaluate_once() const;
@@ -121,6 +121,8 @@ public:
     // it's going to be replaced with Jitters table later
     void set_generator(std::shared_ptr<ov::snippets::Generator> generator);
     void set_tile_rank(size_t newRank) {tileRank = newRank;}
+    // the generated kernel takes Loop parameters at runtime, see Schedule::runtime_loops
+    void set_shape_agnostic(bool shapeAgnostic) {m_shape_agnostic = shapeAgnostic;}
     void set_virtual_port_count(const size_t count);
 
     void print() const;
@@ -158,6 +160,7 @@ private:
 
     ov::PartialShape master_shape;
     size_t tileRank = 0; // set by plugin to specify the number of dimensions processed in a single kernel call
+    bool m_shape_agnostic = false;
 
     /**
     * @interface SubgraphConfig
@@ -0,0 +1,28 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+
+namespace ov {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface ReduceToSnippetsReduce
+ * @brief The pass converts ReduceSum, ReduceMax and ReduceMean over the last dimension to the snippets ReduceSum and ReduceMax
+ *        (ReduceMean is ReduceSum multiplied by the reciprocal of the dimension) and updates their port descriptors
+ *        in accordance with the reduction axis
+ * @ingroup snippets
+ */
+class ReduceToSnippetsReduce: public ov::pass::MatcherPass {
+public:
+    ReduceToSnippetsReduce();
+};
+
+} // namespace pass
+} // namespace snippets
+} // namespace ov
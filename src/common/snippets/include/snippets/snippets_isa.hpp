@@ -20,6 +20,7 @@
 #include "op/nop.hpp"
 #include "op/scalar.hpp"
 #include "op/powerstatic.hpp"
+#include "op/reduce.hpp"
 #include "op/store.hpp"
 #include "op/loop.hpp"
 #include "op/brgemm.hpp"
@@ -15,6 +15,59 @@
 namespace ov {
 namespace snippets {
 
+size_t RuntimeLoopInfo::UNDEFINED_IO = SIZE_MAX;
+
+namespace {
+// Assigns runtime arguments to the Loops in the order of their appearance and describes the Loops
+// so the runtime arguments could be calculated for the actual shapes
+std::vector<RuntimeLoopInfo> init_runtime_loops(const lowered::LinearIR& linear_ir) {
+    const auto& io_exprs = linear_ir.get_IO_ops();
+    const auto num_inputs = static_cast<size_t>(std::count_if(io_exprs.begin(), io_exprs.end(),
+        [](const std::shared_ptr<lowered::IOExpression>& expr) {
+            return expr->get_type() == lowered::IOExpression::io_type::INPUT;
+        }));
+    auto get_io_index = [num_inputs](const lowered::ExpressionPtr& expr) {
+        const auto io_expr = std::dynamic_pointer_cast<lowered::IOExpression>(expr);
+        if (!io_expr)
+            return RuntimeLoopInfo::UNDEFINED_IO;
+        const auto index = static_cast<size_t>(io_expr->get_index());
+        return io_expr->get_type() == lowered::IOExpression::io_type::INPUT ? index : num_inputs + index;
+    };
+
+    std::vector<RuntimeLoopInfo> runtime_loops;
+    for (const auto& expr : linear_ir.get_ops()) {
+        const auto loop_end = ov::as_type_ptr<op::LoopEnd>(expr->get_node());
+        if (!loop_end)
+            continue;
+        RuntimeLoopInfo loop;
+        loop.dim_idx = loop_end->dim_idx;
+        loop.increment = loop_end->get_increment();
+        loop.tail_of = loop_end->tail_of;
+        loop.apply_finalization = loop.increment == 1;
+        loop.element_type_sizes = loop_end->get_element_type_sizes();
+        const auto& connectors = expr->get_input_port_connectors();
+        const auto in_num = loop_end->get_input_num();
+        const auto io_num = in_num + loop_end->get_output_num();
+        for (size_t i = 0; i < io_num; ++i) {
+            auto io_index = RuntimeLoopInfo::UNDEFINED_IO;
+            if (i < in_num) {
+                io_index = get_io_index(connectors[i]->get_source().get_expr());
+            } else {
+                for (const auto& consumer : connectors[i]->get_consumers()) {
+                    io_index = get_io_index(consumer.get_expr());
+                    if (io_index != RuntimeLoopInfo::UNDEFINED_IO)
+                        break;
+                }
+            }
+            loop.io_indexes.push_back(io_index);
+        }
+        loop_end->runtime_args_idx = runtime_loops.size();
+        runtime_loops.push_back(std::move(loop));
+    }
+    return runtime_loops;
+}
+} // namespace
+
 Generator::LoweringResult Generator::generate(lowered::LinearIR& linear_ir, const lowered::Config& config, const void* compile_params) {
     OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::Generator::generate")
     OV_ITT_TASK_CHAIN(GENERATE, ov::pass::itt::domains::SnippetsTransform, "Snippets::Generator", "::Transformations")
@@ -29,6 +82,11 @@ Generator::LoweringResult Generator::generate(lowered::LinearIR& linear_ir, cons
     lowered_pipeline.register_pass<lowered::pass::InsertTailLoop>();
     lowered_pipeline.run(linear_ir);
 
+    // Note: runtime arguments must be assigned before the emitters are created
+    std::vector<RuntimeLoopInfo> runtime_loops;
+    if (config.m_shape_agnostic)
+        runtime_loops = init_runtime_loops(linear_ir);
+
     linear_ir.init_emitters(target);
 
     OV_ITT_TASK_NEXT(GENERATE, "::EmitCode")
@@ -49,7 +107,9 @@ Generator::LoweringResult Generator::generate(lowered::LinearIR& linear_ir, cons
     if (config.m_save_expressions)
         lowered_saved = linear_ir;
 
-    return { target->get_snippet() };
+    LoweringResult result(target->get_snippet());
+    result.runtime_loops = std::move(runtime_loops);
+    return result;
 }
 
 std::shared_ptr<const TargetMachine> Generator::get_target_machine() const {
@@ -78,6 +138,7 @@ Generator::opRegType Generator::get_op_reg_type(const std::shared_ptr<Node>& op)
              std::dynamic_pointer_cast<ov::op::v0::Convert>(op) ||
              std::dynamic_pointer_cast<ov::op::v1::Select>(op) ||
              std::dynamic_pointer_cast<op::VectorBuffer>(op) ||
+             std::dynamic_pointer_cast<op::Fill>(op) ||
              std::dynamic_pointer_cast<op::BroadcastMove>(op) ||
              std::dynamic_pointer_cast<op::Scalar>(op) ||
              std::dynamic_pointer_cast<op::HorizonMax>(op) ||
@@ -62,14 +62,20 @@ bool AssignRegisters::run(LinearIR& linear_ir) {
             manually_assigned_gprs[expr->get_output_port_connector(0)] =
                     static_cast<Reg>(num_results + num_parameters + buffer_id);
         } else if (ov::is_type<op::HorizonMax>(op) || ov::is_type<op::HorizonSum>(op)) {
-            // Only in SoftmaxDecomposition ReduceMax and ReduceSum use HorizonMax/HorizonSum and VectorBuffer.
+            // Only in SoftmaxDecomposition and ReduceDecomposition ReduceMax and ReduceSum use HorizonMax/HorizonSum and VectorBuffer.
             // We should manually set the one vector register for VectorBuffer and Max/Sum output to simulate a accumulator
             // TODO [96351]: We should rewrite accumulator pattern using another way
             const auto& input_tensor = expr->get_input_port_connector(0);
             const auto& input_expr = input_tensor->get_source().get_expr();
             const auto& input_expr_input_tensors = input_expr->get_input_port_connectors();
             for (const auto& tensor : input_expr_input_tensors) {
-                if (ov::is_type<op::VectorBuffer>(tensor->get_source().get_expr()->get_node())) {
+                const auto& parent_expr = tensor->get_source().get_expr();
+                if (ov::is_type<op::VectorBuffer>(parent_expr->get_node())) {
+                    manually_assigned_vecs[tensor] = static_cast<Reg>(accumulator_reg);
+                } else if (ov::is_type<op::Fill>(parent_expr->get_node()) &&
+                           ov::is_type<op::VectorBuffer>(parent_expr->get_input_port_connector(0)->get_source().get_expr()->get_node())) {
+                    // VectorBuffer can be initialized by Fill in place (e.g. by float min for ReduceMax)
+                    manually_assigned_vecs[parent_expr->get_input_port_connector(0)] = static_cast<Reg>(accumulator_reg);
                     manually_assigned_vecs[tensor] = static_cast<Reg>(accumulator_reg);
                 }
             }
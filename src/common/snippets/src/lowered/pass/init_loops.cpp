@@ -147,6 +147,7 @@ void InitLoops::insertion(LinearIR& linear_ir, const LinearIR::LoopManager::Loop
             loop_begin->output(0), work_amount, work_amount_increment, ptr_increments, finalization_offsets,
             io_data_sizes, loop_entries.size(), loop_exits.size());
     loop_end->has_outer_loop = has_outer_loop;
+    loop_end->dim_idx = dim_idx;
 
     std::vector<PortConnectorPtr> loop_end_inputs;
     for (const auto& expr_port : loop_entries)
@@ -72,6 +72,9 @@ void InsertTailLoop::tail_transformations(LinearIR& linear_ir,
 bool InsertTailLoop::run(LinearIR& linear_ir) {
     OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::insertTailLoop")
     bool modified = false;
+    // Shape-agnostic kernels get work amounts at runtime, so every vector loop is followed by a scalar tail loop.
+    // Both of them are skipped at runtime if the work amount is not enough for a single iteration.
+    const bool shape_agnostic = linear_ir.get_config().m_shape_agnostic;
     // *1* solo vector/tail loop + empty outer loop
     //      => skip increments (both counter & ptr) : set evaluate_once flag
     // *2* solo vector/tail loop + non-empty outer loop
@@ -138,9 +141,9 @@ bool InsertTailLoop::run(LinearIR& linear_ir) {
             const bool is_there_buffer = is_loop_with_buffers(vector_loop_end);
             const auto work_amount = vector_loop_end->get_work_amount();
             const auto increment = vector_loop_end->get_increment();
-            const auto tail_size = work_amount % increment;
-            const auto need_tail = tail_size != 0;
-            const auto need_vector_loop = work_amount >= increment;
+            const size_t tail_size = shape_agnostic ? 1 : work_amount % increment;
+            const auto need_tail = shape_agnostic || tail_size != 0;
+            const auto need_vector_loop = shape_agnostic || work_amount >= increment;
             // Note, that finalization_offsets could be modified inside optimize_single_evaluation,
             // so need to save them here to cover (evaluate_once vector with non-zero finalization_offsets + tail)
             std::vector<int64_t> tail_finalization_offsets = need_tail ? vector_loop_end->get_finalization_offsets()
@@ -154,7 +157,8 @@ bool InsertTailLoop::run(LinearIR& linear_ir) {
                             std::vector<int64_t>(tail_finalization_offsets.size(), 0));
 
                 // force ptr increments if there is tail
-                optimize_single_evaluation(vector_loop_end, need_tail || is_there_buffer);
+                if (!shape_agnostic)
+                    optimize_single_evaluation(vector_loop_end, need_tail || is_there_buffer);
             }
 
             // tail is required => transform the body into a tail representation
@@ -189,9 +193,14 @@ bool InsertTailLoop::run(LinearIR& linear_ir) {
                 tail_loop_end->set_work_amount(tail_size);
                 tail_loop_end->has_outer_loop = vector_loop_end->has_outer_loop;
 
-                // Note: despite the fact that the tail loop is always executed once, we still need
-                // to keep finalization_offsets to reset Buffer
-                optimize_single_evaluation(tail_loop_end, is_there_buffer);
+                if (shape_agnostic) {
+                    // the runtime work amount of the tail loop is the remainder of the vector one
+                    tail_loop_end->tail_of = increment;
+                } else {
+                    // Note: despite the fact that the tail loop is always executed once, we still need
+                    // to keep finalization_offsets to reset Buffer
+                    optimize_single_evaluation(tail_loop_end, is_there_buffer);
+                }
             }
             modified = true;
         } else {
@@ -0,0 +1,124 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/lowered/pass/reduce_decomposition.hpp"
+
+#include "snippets/lowered/linear_ir.hpp"
+#include "snippets/lowered/loop_manager.hpp"
+#include "snippets/snippets_isa.hpp"
+#include "snippets/itt.hpp"
+
+
+namespace ov {
+namespace snippets {
+namespace lowered {
+namespace pass {
+
+ReduceDecomposition::ReduceDecomposition(size_t vector_size) : m_vector_size{vector_size} {}
+
+bool ReduceDecomposition::run(LinearIR& linear_ir) {
+    OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::ReduceDecompositionLowered")
+    bool modified = false;
+    const auto& loop_manager = linear_ir.get_loop_manager();
+
+    for (auto expr_it = linear_ir.begin(); expr_it != linear_ir.end(); expr_it++) {
+        const auto reduce = ov::as_type_ptr<op::ReduceBase>((*expr_it)->get_node());
+        if (!reduce)
+            continue;
+
+        const auto reduce_expr = *expr_it;
+        const auto reduce_loop_ids = reduce_expr->get_loop_ids();
+        const auto& input_connector = reduce_expr->get_input_port_connector(0);
+        const auto& output_connector = reduce_expr->get_output_port_connector(0);
+        const auto tensor_in = reduce_expr->get_input_port_descriptor(0)->get_shape();
+        const auto inner_work_amount = *(tensor_in.rbegin());
+        const bool is_max = ov::is_type<op::ReduceMax>(reduce);
+
+        expr_it = linear_ir.erase(expr_it);   // Remove Reduce
+
+        std::vector<ExpressionPtr> outer_exprs;
+
+        // We need an iterator to the inserted element
+        auto push_node = [&linear_ir, &expr_it, &reduce_loop_ids](const std::shared_ptr<Node>& n) {
+            const auto expr = linear_ir.insert(expr_it, n);
+            (*expr)->set_loop_ids(reduce_loop_ids);
+            return std::make_pair(expr, n);
+        };
+
+        // VectorBuffer is zeroed, so the accumulator of ReduceMax is filled by -inf: float min isn't the identity of max
+        // when the reduced values are -inf
+        const auto vector_buffer = push_node(std::make_shared<op::VectorBuffer>());
+        outer_exprs.push_back(*vector_buffer.first);
+        auto initial_value = vector_buffer.second;
+        if (is_max) {
+            const auto fill = push_node(std::make_shared<op::Fill>(vector_buffer.second, 0, uint32_t(0xff800000)));
+            outer_exprs.push_back(*fill.first);
+            initial_value = fill.second;
+        }
+
+        // Accumulation Loop
+        std::shared_ptr<Node> accumulation_node = nullptr;
+        if (is_max) {
+            accumulation_node = std::make_shared<ov::op::v1::Maximum>(reduce->get_input_source_output(0), initial_value);
+        } else {
+            accumulation_node = std::make_shared<ov::op::v1::Add>(reduce->get_input_source_output(0), initial_value);
+        }
+        const auto accumulation = push_node(accumulation_node);
+
+        std::shared_ptr<Node> horizon_node = nullptr;
+        if (is_max) {
+            horizon_node = std::make_shared<op::HorizonMax>(accumulation.second);
+        } else {
+            horizon_node = std::make_shared<op::HorizonSum>(accumulation.second);
+        }
+        const auto horizon = push_node(horizon_node);
+        outer_exprs.push_back(*horizon.first);
+
+        // Markup of Accumulation Loop
+        loop_manager->mark_loop(accumulation.first, horizon.first, 1, inner_work_amount, m_vector_size,
+                                std::vector<ExpressionPort>{(*accumulation.first)->get_input_port(0),
+                                                            (*accumulation.first)->get_input_port(1)},
+                                std::vector<ExpressionPort>{(*accumulation.first)->get_output_port(0)});
+
+        // Transfer original ExpressionPorts
+        linear_ir.replace_input((*accumulation.first)->get_input_port(0), input_connector);
+        linear_ir.replace_input(output_connector->get_consumers(), (*horizon.first)->get_output_port_connector(0));
+
+        // Markup inner loop for outside expression with null loop id
+        for (const auto& expr : outer_exprs) {
+            expr->set_loop_id(Expression::LOOP_NULL_ID, 1);
+        }
+
+        auto update_loop_bounds = [&reduce_expr](std::vector<ExpressionPort>& points, const ExpressionPort& new_point) {
+            auto entry_found = std::find_if(points.begin(), points.end(), [&reduce_expr](const ExpressionPort& desc) {
+                return desc.get_expr() == reduce_expr;
+            });
+            if (entry_found != points.end())
+                *entry_found = new_point;
+        };
+
+        // Update Loop info for outer loops
+        for (auto loop_id : reduce_loop_ids) {
+            if (loop_id == Expression::LOOP_NULL_ID)
+                continue;
+            const auto loop_info = loop_manager->get_loop_info(loop_id);
+            update_loop_bounds(loop_info->entry_exprs, (*accumulation.first)->get_input_port(0));
+            update_loop_bounds(loop_info->exit_exprs, (*horizon.first)->get_output_port(0));
+        }
+
+        // For tail loop we should fill the input of the accumulation to avoid math incorrect calculations
+        accumulation_node->input(0).get_rt_info()["set_fill"] = is_max ? uint32_t(0xff800000) : uint32_t(0x00000000);
+
+        // expr_it points to the expression after the decomposed Reduce
+        expr_it = std::prev(expr_it);
+        modified = true;
+    }
+
+    return modified;
+}
+
+} // namespace pass
+} // namespace lowered
+} // namespace snippets
+} // namespace ov
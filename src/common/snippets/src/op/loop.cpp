@@ -48,6 +48,8 @@ bool LoopBegin::visit_attributes(AttributeVisitor &visitor) {
     return true;
 }
 
+size_t LoopEnd::NO_RUNTIME_ARGS = SIZE_MAX;
+
 LoopEnd::LoopEnd(const Output<Node>& loop_begin, size_t work_amount, size_t work_amount_increment,
                  std::vector<bool> apply_increments, std::vector<int64_t> finalization_offsets,
                  std::vector<int64_t> element_type_sizes, size_t input_num, size_t output_num)
@@ -86,8 +88,12 @@ LoopEnd::LoopEnd(const Output<Node>& loop_begin, size_t work_amount, size_t work
 
 std::shared_ptr<Node> LoopEnd::clone_with_new_inputs(const OutputVector& inputs) const {
     check_new_args_count(this, inputs);
-    return std::make_shared<LoopEnd>(inputs.at(0), work_amount, work_amount_increment, ptr_increments,
-                                     finalization_offsets, element_type_sizes, input_num, output_num);
+    const auto loop_end = std::make_shared<LoopEnd>(inputs.at(0), work_amount, work_amount_increment, ptr_increments,
+                                                    finalization_offsets, element_type_sizes, input_num, output_num);
+    loop_end->runtime_args_idx = runtime_args_idx;
+    loop_end->dim_idx = dim_idx;
+    loop_end->tail_of = tail_of;
+    return loop_end;
 }
 
 std::shared_ptr<LoopBegin> LoopEnd::get_loop_begin() {
@@ -7,6 +7,7 @@
 
 #include "snippets/op/subgraph.hpp"
 #include "snippets/op/convert_saturation.hpp"
+#include "snippets/op/reduce.hpp"
 
 #include "snippets/pass/insert_movebroadcast.hpp"
 #include "snippets/pass/broadcast_to_movebroadcast.hpp"
@@ -18,6 +19,7 @@
 #include "snippets/pass/matmul_to_brgemm.hpp"
 #include "snippets/pass/fuse_transpose_brgemm.hpp"
 #include "snippets/pass/set_softmax_ports.hpp"
+#include "snippets/pass/reduce_to_snippets_reduce.hpp"
 
 #include "snippets/utils.hpp"
 
@@ -34,6 +36,7 @@
 #include "snippets/lowered/pass/propagate_layout.hpp"
 #include "snippets/lowered/pass/cleanup_loop_offsets.hpp"
 #include "snippets/lowered/pass/softmax_decomposition.hpp"
+#include "snippets/lowered/pass/reduce_decomposition.hpp"
 #include "snippets/lowered/pass/move_scalar_to_consumer.hpp"
 #include "snippets/lowered/pass/move_result_out_of_loop.hpp"
 #include "snippets/lowered/pass/clean_repeated_ptr_shifts.hpp"
@@ -68,6 +71,10 @@ auto snippets::op::Subgraph::is_domain_sensitive_op(const std::shared_ptr<ov::No
     return ov::is_type<ov::op::v1::Transpose>(op) ||
            ov::is_type<ov::op::v1::Softmax>(op) ||
            ov::is_type<ov::op::v8::Softmax>(op) ||
+           ov::is_type<ov::op::v1::ReduceSum>(op) ||   // Reductions are supported only over the last dimension,
+           ov::is_type<ov::op::v1::ReduceMax>(op) ||   // so the dimensions can't be collapsed
+           ov::is_type<ov::op::v1::ReduceMean>(op) ||
+           ov::is_type<op::ReduceBase>(op) ||
            ov::is_type<ov::op::v0::MatMul>(op) ||
            ov::is_type<ov::op::v1::Broadcast>(op) || // Broadcast is domain sensetive op because the output shape depends on
            ov::is_type<ov::op::v3::Broadcast>(op);   // the both input and broadcast shapes (the both - are inputs of op). Note: is used only in MHA pattern
@@ -90,7 +97,7 @@ auto snippets::op::Subgraph::get_estimated_buffer_count(const ov::NodeVector& op
     // So we should check for element type size of nodes which are used Buffer to get rating from above for unique Buffer count.
     // The count is estimated because when we calculate this number, we have only original graph representation
     // and where will be Loops - we can just predict.
-    // Note: The ops that create Buffers: MatMul, Transpose and Softmax (always FP32)
+    // Note: The ops that create Buffers: MatMul, Transpose, Softmax and Reduce (always FP32)
     std::vector<size_t> used_precision_size;
     for (const auto& op : ops) {
         if (const auto transpose = ov::as_type_ptr<ov::op::v1::Transpose>(op)) {
@@ -110,8 +117,10 @@ auto snippets::op::Subgraph::get_estimated_buffer_count(const ov::NodeVector& op
                     used_precision_size.push_back(prc_size);
                 }
             }
-        } else if (ov::is_type<ov::op::v1::Softmax>(op) || ov::is_type<ov::op::v8::Softmax>(op)) {
-            // Softmax always uses 2 FP32 Buffers
+        } else if (ov::is_type<ov::op::v1::Softmax>(op) || ov::is_type<ov::op::v8::Softmax>(op) ||
+                   ov::is_type<ov::op::v1::ReduceSum>(op) || ov::is_type<ov::op::v1::ReduceMax>(op) ||
+                   ov::is_type<ov::op::v1::ReduceMean>(op)) {
+            // Softmax always uses 2 FP32 Buffers, the reduced values are passed to the next Loops via FP32 Buffers
             const auto prc_size = ov::element::f32.size();
             if (used_precision_size.empty() || used_precision_size.back() != prc_size) {
                 used_precision_size.push_back(prc_size);
@@ -485,6 +494,7 @@ void snippets::op::Subgraph::data_flow_transformations(ov::pass::Manager& pre_co
         common_manager.register_pass<snippets::pass::FuseTransposeBrgemm>();
         common_manager.register_pass<snippets::pass::TransposeDecomposition>();
         common_manager.register_pass<snippets::pass::SetSoftmaxPorts>();
+        common_manager.register_pass<snippets::pass::ReduceToSnippetsReduce>();
     }
     common_manager.register_pass<snippets::pass::BroadcastToMoveBroadcast>();
     common_manager.register_pass<snippets::pass::ConvertConstantsToScalars>();
@@ -524,6 +534,7 @@ void snippets::op::Subgraph::control_flow_transformations(lowered::LinearIR& lin
     lowered::pass::PassPipeline common_pipeline;
     common_pipeline.register_pass<lowered::pass::MarkLoops>(vector_size);
     common_pipeline.register_pass<lowered::pass::SoftmaxDecomposition>(vector_size);
+    common_pipeline.register_pass<lowered::pass::ReduceDecomposition>(vector_size);
     common_pipeline.register_pass<lowered::pass::FuseLoops>();
     common_pipeline.register_pass<lowered::pass::MoveResultOutOfLoop>();
     common_pipeline.register_pass<lowered::pass::InsertBuffers>(buffer_allocation_rank);
@@ -590,6 +601,7 @@ snippets::Schedule snippets::op::Subgraph::generate(
     lowering_config.m_save_expressions = config.m_has_domain_sensitive_ops;
     lowering_config.m_need_fill_tail_register = config.m_has_domain_sensitive_ops;
     lowering_config.m_loop_depth = tileRank;
+    lowering_config.m_shape_agnostic = m_shape_agnostic;
 
     lowered::LinearIR linear_ir = lowered::LinearIR(body_ptr(), lowering_config);
     control_flow_transformations(linear_ir, target_lowered_pipeline);
@@ -598,7 +610,9 @@ snippets::Schedule snippets::op::Subgraph::generate(
     const auto& lowering_result = m_generator->generate(linear_ir, lowering_config, compile_params);
     const auto ptr = lowering_result.binary_code;
 
-    return {master_shape, false /*canBeLinearized*/, ptr};
+    snippets::Schedule schedule {master_shape, false /*canBeLinearized*/, ptr};
+    schedule.runtime_loops = lowering_result.runtime_loops;
+    return schedule;
 }
 
 void snippets::op::Subgraph::print() const {
@@ -24,6 +24,7 @@
 #include <string>
 #include <numeric>
 #include <climits>
+#include <algorithm>
 
 
 namespace ov {
@@ -152,6 +153,40 @@ auto is_supported_op(const std::shared_ptr<const Node> &n) -> bool {
         return axis >= 0 && axis == (rank.get_length() - 1);
     };
 
+    // The reduced tensor (or the input of the eltwise op which produces it) is also consumed by another op,
+    // e.g. x / sqrt(mean(x * x) + eps) or x - max(x). Standalone reductions keep the plugin path.
+    auto is_normalization_reduce = [](const std::shared_ptr<const Node> &n) -> bool {
+        const auto data = n->input_value(0);
+        OutputVector sources{data};
+        const auto producer = data.get_node_shared_ptr();
+        if (!ov::is_type<ov::op::v0::Parameter>(producer) && !ov::is_type<ov::op::v0::Constant>(producer)) {
+            const auto producer_inputs = producer->input_values();
+            sources.insert(sources.end(), producer_inputs.begin(), producer_inputs.end());
+        }
+        return std::any_of(sources.begin(), sources.end(), [&](const Output<Node>& source) {
+            const auto consumers = source.get_target_inputs();
+            return std::any_of(consumers.begin(), consumers.end(), [&](const Input<Node>& consumer) {
+                const auto consumer_node = consumer.get_node();
+                return consumer_node != n.get() && consumer_node != producer.get();
+            });
+        });
+    };
+
+    auto is_supported_reduce = [&](const std::shared_ptr<const Node> &n) -> bool {
+        // Reductions are decomposed to accumulation Loops, so only a single last axis is supported.
+        // The scale of ReduceMean isn't representable in integer types, so only float reductions are supported.
+        const auto reduce = ov::as_type_ptr<const ov::op::util::ArithmeticReductionKeepDims>(n);
+        if (!reduce ||
+            !(ov::is_type<ov::op::v1::ReduceSum>(n) || ov::is_type<ov::op::v1::ReduceMax>(n) || ov::is_type<ov::op::v1::ReduceMean>(n)) ||
+            !reduce->get_keep_dims() || !reduce->reduction_axes_constant() || !n->get_input_element_type(0).is_real() ||
+            n->get_input_partial_shape(0).rank().is_dynamic())
+            return false;
+        const auto rank = n->get_input_partial_shape(0).rank().get_length();
+        const auto axes = reduce->get_reduction_axes();
+        return rank > 0 && axes.size() == 1 && *axes.begin() == static_cast<size_t>(rank - 1) &&
+               is_normalization_reduce(n);
+    };
+
     auto is_supported_broadcast_op = [](const std::shared_ptr<const Node> &n) -> bool {
         // Broadcast is supported only for MHA tokenization where there are needed and special checks
         if (auto broadcast_v1 = ov::as_type_ptr<const ov::op::v1::Broadcast>(n)) {
@@ -168,21 +203,35 @@ auto is_supported_op(const std::shared_ptr<const Node> &n) -> bool {
            is_supported_ternary_eltwise_op(n) ||
            is_supported_transpose(n) ||
            is_supported_softmax(n) ||
+           is_supported_reduce(n) ||
            is_supported_matmul(n) ||
            is_supported_broadcast_op(n);
 }
 
 auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
-    auto supported = [&n](descriptor::Tensor& t) -> bool {
+    // Dynamic dimensions are supported only by elementwise operations: they are lowered to shape-agnostic kernels.
+    // Note that the rank must be static anyway
+    const bool is_elementwise = !ov::is_type<const opset1::FakeQuantize>(n) &&
+                                !ov::is_type<const opset1::Transpose>(n) &&
+                                !ov::is_type<const ov::op::v1::Softmax>(n) &&
+                                !ov::is_type<const ov::op::v8::Softmax>(n) &&
+                                !ov::is_type<const ov::op::util::ArithmeticReductionKeepDims>(n) &&
+                                !ov::is_type<const opset1::MatMul>(n) &&
+                                !ov::is_type<const ov::op::v1::Broadcast>(n) &&
+                                !ov::is_type<const ov::op::v3::Broadcast>(n);
+    auto supported = [&n, is_elementwise](descriptor::Tensor& t) -> bool {
+        const auto& pshape = t.get_partial_shape();
         // Todo: int32 isn't supported in general because i32 emitters are required for bit-exact i32 calculations in some cases
         //  So i32 is supported exclusively for transposes and broadcast
-        return t.get_partial_shape().is_static() &&
+        return (pshape.is_static() || (is_elementwise && pshape.rank().is_static())) &&
                (TokenizeSnippets::supported_element_types.count(t.get_element_type()) != 0 ||
                 (t.get_element_type() == ov::element::i32 &&
                         (ov::is_type<const opset1::Transpose>(n) ||
                          ov::is_type<const opset1::Broadcast>(n))));
     };
-    const auto&  inputs = n->inputs();
+    // The axes of reductions aren't scheduled, they are only used for decomposition
+    const auto&  inputs = ov::is_type<const ov::op::util::ArithmeticReductionKeepDims>(n) ?
+                          std::vector<Input<const Node>>{n->input(0)} : n->inputs();
     const auto&  outputs = n->outputs();
     // todo: Is this check necessary? Remove if not
     for (const auto& out : outputs) {
@@ -582,8 +631,15 @@ TokenizeSnippets::TokenizeSnippets() {
         // At the moment, CPU Plugin has limitation for GPR registers: there are only 12 available registers.
         // This limitation will be resolved once generator supports gprs spills [75622].
         // TODO [75567]: move this plugin-specific constraint to the plugin callback
+        // The shape-agnostic kernels of dynamic subgraphs keep one more GPR for the runtime Loop arguments.
+        const auto is_dynamic_io = [](const std::shared_ptr<ov::Node>& io) {
+            return io->get_output_partial_shape(0).is_dynamic();
+        };
+        const bool is_dynamic = std::any_of(body_parameters.begin(), body_parameters.end(), is_dynamic_io) ||
+                                std::any_of(body_results.begin(), body_results.end(), is_dynamic_io);
+        const size_t max_data_count = is_dynamic ? 11 : 12;
         const auto unique_buffer_count = op::Subgraph::get_estimated_buffer_count(new_body_ops);
-        if (body_parameters.size() + body_results.size() + hidden_data_count + unique_buffer_count > 12) {
+        if (body_parameters.size() + body_results.size() + hidden_data_count + unique_buffer_count > max_data_count) {
             const std::string message_reset = "new subgraph is created. Impossible to schedule subgraph with " +
             std::to_string(body_parameters.size()) + " inputs, " + std::to_string(body_results.size()) + " outputs and " +
             std::to_string(hidden_data_count) + " non-scalar constants and " + std::to_string(unique_buffer_count) + "buffers.";
@@ -0,0 +1,67 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/pass/reduce_to_snippets_reduce.hpp"
+
+#include "snippets/itt.hpp"
+#include "snippets/op/reduce.hpp"
+#include "snippets/lowered/port_descriptor.hpp"
+
+#include "openvino/opsets/opset1.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+
+ov::snippets::pass::ReduceToSnippetsReduce::ReduceToSnippetsReduce() {
+    MATCHER_SCOPE(ReduceToSnippetsReduce);
+
+    auto m_reduce = ov::pass::pattern::wrap_type<ov::op::v1::ReduceSum, ov::op::v1::ReduceMax, ov::op::v1::ReduceMean>(
+        {ov::pass::pattern::any_input(), ov::pass::pattern::wrap_type<ov::op::v0::Constant>()});
+
+    auto callback = [](ov::pass::pattern::Matcher &m) {
+        OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::op::ReduceToSnippetsReduce")
+        const auto reduce = ov::as_type_ptr<ov::op::util::ArithmeticReductionKeepDims>(m.get_match_root());
+        if (!reduce || !reduce->get_keep_dims())
+            return false;
+
+        const auto& pshape = reduce->get_input_partial_shape(0);
+        if (pshape.is_dynamic())
+            return false;
+        const auto shape = pshape.get_shape();
+        const auto rank = shape.size();
+        const auto axes = reduce->get_reduction_axes();
+        if (rank == 0 || axes.size() != 1 || *axes.begin() != rank - 1)
+            return false;
+
+        const auto axis = rank - 1;
+        const auto& data = reduce->input_value(0);
+        std::shared_ptr<ov::op::Op> snippets_reduce = nullptr;
+        if (ov::is_type<ov::op::v1::ReduceMax>(reduce)) {
+            snippets_reduce = std::make_shared<op::ReduceMax>(data, axis);
+        } else {
+            snippets_reduce = std::make_shared<op::ReduceSum>(data, axis);
+        }
+
+        std::vector<size_t> subtensor(rank, 1);
+        subtensor[axis] = lowered::PortDescriptor::ServiceDimensions::FULL_DIM;
+        lowered::PortDescriptorUtils::set_port_descriptor_ptr(snippets_reduce->input(0),
+                                                              std::make_shared<lowered::PortDescriptor>(snippets_reduce->input(0), subtensor));
+        lowered::PortDescriptorUtils::set_port_descriptor_ptr(snippets_reduce->output(0),
+                                                              std::make_shared<lowered::PortDescriptor>(snippets_reduce->output(0), subtensor));
+
+        std::shared_ptr<ov::Node> result = snippets_reduce;
+        if (ov::is_type<ov::op::v1::ReduceMean>(reduce)) {
+            // The Constant is converted to Scalar by ConvertConstantsToScalars
+            const auto reciprocal = ov::op::v0::Constant::create(reduce->get_element_type(), ov::Shape{},
+                                                                 {1.f / static_cast<float>(shape[axis])});
+            result = std::make_shared<ov::op::v1::Multiply>(snippets_reduce, reciprocal);
+        }
+        result->set_friendly_name(reduce->get_friendly_name());
+        ov::copy_runtime_info(reduce, {snippets_reduce, result});
+        ov::replace_node(reduce, result);
+        return true;
+    };
+
+    register_matcher(std::make_shared<ov::pass::pattern::Matcher>(m_reduce, matcher_name), callback);
+}
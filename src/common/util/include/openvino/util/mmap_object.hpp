@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific shared memory map objects
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "openvino/util/util.hpp"
+
+namespace ov {
+
+/**
+ * @brief This class represents a read-only mapped memory of a file.
+ * The mapping is released together with the object.
+ */
+class MappedMemory {
+public:
+    virtual ~MappedMemory() = default;
+
+    virtual char* data() noexcept = 0;
+    virtual size_t size() const noexcept = 0;
+};
+
+/**
+ * @brief Maps the whole file into memory in read-only mode
+ * @param path Path to the file
+ * @return Reference to the mapped memory
+ * @throws std::runtime_error if the file can not be opened or mapped
+ */
+std::shared_ptr<ov::MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+/**
+ * @brief Maps the whole file into memory in read-only mode
+ * @param path Wide char path to the file
+ * @return Reference to the mapped memory
+ * @throws std::runtime_error if the file can not be opened or mapped
+ */
+std::shared_ptr<ov::MappedMemory> load_mmap_object(const std::wstring& path);
+
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace ov
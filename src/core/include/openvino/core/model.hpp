@@ -34,6 +34,11 @@ namespace frontend {
 class FrontEnd;
 }
 
+namespace pass {
+class GraphRewrite;
+class Manager;
+}
+
 class ModelAccessor;
 
 /**
@@ -454,6 +459,9 @@ public:
 
 private:
     friend class ov::ModelAccessor;
+    // To track the changes of the model between the incremental rewrites
+    friend class ov::pass::GraphRewrite;
+    friend class ov::pass::Manager;
 
     // Allow to get attribute for the vector
     ov::Any& get_rt_info(ov::AnyMap& info,
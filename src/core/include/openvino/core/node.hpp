@@ -57,6 +57,7 @@ struct AutoBroadcastSpec;
 namespace pass {
 
 class ResolveNameCollisions;
+class GraphRewrite;
 
 namespace pattern {
 class Matcher;
@@ -130,6 +131,8 @@ class OPENVINO_API Node : public std::enable_shared_from_this<Node> {
     friend class Model;
     // To fix collisions in generated friendly name
     friend class pass::ResolveNameCollisions;
+    // To attach the model info to the nodes visited by the incremental rewrites
+    friend class pass::GraphRewrite;
 
 protected:
     descriptor::Input& get_input_descriptor(size_t position);
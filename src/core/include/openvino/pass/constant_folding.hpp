@@ -19,6 +19,10 @@ namespace pass {
 class OPENVINO_API ConstantFolding : public ModelPass {
 public:
     OPENVINO_RTTI("ConstantFolding");
+    ConstantFolding() = default;
+    /// \param parallel  Enables the parallel folding: the independent nodes of the constant sub-graphs are folded
+    /// concurrently and the large elementwise nodes are split between the threads.
+    explicit ConstantFolding(bool parallel) : m_parallel(parallel) {}
     bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
 
 protected:
@@ -26,6 +30,16 @@ protected:
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& model);
+    /// \brief Folds the sub-graphs computed from the constants only. The nodes are grouped by the longest path from
+    /// the constants, the nodes of a group don't depend on each other and are evaluated concurrently. The nodes which
+    /// are not folded here are left for the sequential traversal.
+    bool parallel_constant_subgraphs_folding(const std::shared_ptr<ov::Model>& model);
+    /// \brief Replaces the outputs of the folded node with the replacements and propagates the names and the runtime
+    /// info to them.
+    bool replace_folded_outputs(const std::shared_ptr<Node>& node, const OutputVector& replacements);
+
+private:
+    bool m_parallel = false;
 };
 
 /**
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <deque>
 #include <functional>
 #include <memory>
 #include <set>
@@ -261,12 +262,54 @@ public:
 
     void set_pass_config(const std::shared_ptr<PassConfig>& pass_config) override;
 
+    /// \brief Enables the incremental mode. A run on a model visits only the nodes which inputs or consumers were
+    /// changed since the previous run of the same matcher passes, the nodes created since then and their consumers
+    /// up to the depth of the patterns. The nodes changed by the rewrites are revisited in the same run. After the
+    /// run the types and shapes are inferred again only for the changed nodes and their consumers which inputs are
+    /// changed.
+    ///
+    /// The previous runs are known only within the incremental rewrites session of the model which is open while
+    /// pass::Manager with the incremental rewrite runs, otherwise all the nodes are visited. The mode relies on the
+    /// change log of the model, so the modifications which do not reconnect the nodes (e.g. the attributes changed
+    /// in place) are not tracked. The matcher passes without a pattern or with a recurrent one always visit all the
+    /// nodes.
+    void set_incremental(bool incremental) {
+        m_incremental = incremental;
+    }
+
+    /// \brief Work counters accumulated over all the runs
+    struct Statistics {
+        size_t visited_nodes = 0;
+        size_t matcher_calls = 0;
+        size_t rewrites = 0;
+        size_t revalidated_nodes = 0;
+        size_t incremental_runs = 0;
+    };
+
+    const Statistics& get_statistics() const {
+        return m_statistics;
+    }
+
 protected:
     bool apply_matcher_passes(std::shared_ptr<Model> f, std::deque<std::weak_ptr<Node>> nodes_to_run);
 
     bool m_enable_shape_inference = false;
 
     std::vector<std::shared_ptr<ov::pass::MatcherPass>> m_matchers;
+
+    Statistics m_statistics;
+
+private:
+    using revisit_callback = std::function<void(std::deque<std::weak_ptr<Node>>& nodes_to_run)>;
+
+    bool run_incrementally(const std::shared_ptr<Model>& f);
+
+    /// \param revisit is called after every matcher pass application to append the nodes changed by it to the queue
+    bool apply_matcher_passes(std::shared_ptr<Model> f,
+                              std::deque<std::weak_ptr<Node>> nodes_to_run,
+                              const revisit_callback& revisit);
+
+    bool m_incremental = false;
 };
 
 class OPENVINO_API BackwardGraphRewrite : public GraphRewrite {
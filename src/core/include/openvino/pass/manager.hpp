@@ -76,6 +76,15 @@ public:
     /// \param new_state Value "true" enables Validate pass run; "false", otherwise
     void set_per_pass_validation(bool new_state);
 
+    /// \brief Set flag to enable/disable the incremental mode of the GraphRewrite passes (see
+    /// GraphRewrite::set_incremental). The changes of the model are tracked while the passes run (including the
+    /// passes of the managers run by them), so the matcher passes which run again revisit only the changed part of
+    /// the model. The tracking stops after the last pass. The passes revalidate the changed part of the model
+    /// themselves, so the Validate passes registered after them are skipped and the whole model is validated once
+    /// after the last pass.
+    /// \param new_state Value "true" enables the incremental mode; "false", otherwise
+    void set_incremental_rewrite(bool new_state);
+
     /// \return PassConfig shared object. This object is used for transformations pipeline
     /// configuration.
     /// This object allows to disable/enable transformations execution, set callback to
@@ -99,6 +108,7 @@ protected:
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     bool m_visualize = false;
     bool m_per_pass_validation = true;
+    bool m_incremental_rewrite = false;
 };
 }  // namespace pass
 }  // namespace ov
@@ -6,6 +6,7 @@
 
 #include <cstddef>
 
+#include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "ngraph/type/float16.hpp"
 
@@ -115,6 +116,11 @@ void convert<float16, int8_t>(const float16* arg, int8_t* out, size_t count);
 
 #endif  // OPENVINO_ARCH_X86 || OPENVINO_ARCH_X86_64
 
+template <>
+void convert<bfloat16, float>(const bfloat16* arg, float* out, size_t count);
+template <>
+void convert<float, bfloat16>(const float* arg, bfloat16* out, size_t count);
+
 // overload to handle ngraph::boolean (it is stored as char)
 template <typename TI, typename TO>
 typename std::enable_if<std::is_same<TO, char>::value>::type convert(const TI* arg, TO* out, size_t count) {
@@ -4,11 +4,27 @@
 
 #include "ngraph/runtime/reference/broadcast.hpp"
 
+#include <algorithm>
+#include <cstring>
+
 #include "ngraph/runtime/reference/tile.hpp"
+#include "parallel_rows.hpp"
 
 namespace ngraph {
 namespace runtime {
 namespace reference {
+namespace {
+/// \brief Repeats one element count times, the filled part of the row is doubled by every copy
+void broadcast_element(char* out, const char* value, size_t count, size_t elem_size) {
+    std::memcpy(out, value, elem_size);
+    for (size_t filled = 1; filled < count;) {
+        const auto copied = std::min(filled, count - filled);
+        std::memcpy(out + filled * elem_size, out, copied * elem_size);
+        filled += copied;
+    }
+}
+}  // namespace
+
 void broadcast(const char* arg,
                char* out,
                const Shape& in_shape,
@@ -24,12 +40,65 @@ void broadcast(const char* arg,
     }
     Shape adjusted_out_shape = out_shape;
     adjusted_out_shape.insert(adjusted_out_shape.begin(), output_rank - adjusted_out_shape.size(), 1);
-    std::vector<int64_t> repeats(output_rank);
-    for (size_t i = 0; i < repeats.size(); ++i) {
-        repeats[i] = adjusted_out_shape[i] / adjusted_in_shape[i];
+
+    // The unit dimensions are removed and the adjacent dimensions which are either all broadcast or all copied are
+    // merged, then every output row is a copy of an input row or a repeated input element.
+    std::vector<size_t> in_dims, out_dims;
+    bool last_broadcast = false;
+    bool mergeable = adjusted_in_shape.size() == output_rank;
+    for (size_t i = 0; mergeable && i < output_rank; ++i) {
+        if (adjusted_out_shape[i] == 0)
+            return;
+        if (adjusted_in_shape[i] != 1 && adjusted_in_shape[i] != adjusted_out_shape[i]) {
+            mergeable = false;
+        } else if (adjusted_out_shape[i] != 1) {
+            const bool is_broadcast = adjusted_in_shape[i] == 1;
+            if (!out_dims.empty() && is_broadcast == last_broadcast) {
+                in_dims.back() *= adjusted_in_shape[i];
+                out_dims.back() *= adjusted_out_shape[i];
+            } else {
+                in_dims.push_back(adjusted_in_shape[i]);
+                out_dims.push_back(adjusted_out_shape[i]);
+            }
+            last_broadcast = is_broadcast;
+        }
     }
 
-    return tile(arg, out, adjusted_in_shape, adjusted_out_shape, elem_size, repeats);
+    if (!mergeable) {
+        std::vector<int64_t> repeats(output_rank);
+        for (size_t i = 0; i < repeats.size(); ++i) {
+            repeats[i] = adjusted_out_shape[i] / adjusted_in_shape[i];
+        }
+        return tile(arg, out, adjusted_in_shape, adjusted_out_shape, elem_size, repeats);
+    }
+
+    if (out_dims.empty()) {
+        std::memcpy(out, arg, elem_size);
+        return;
+    }
+    if (out_dims.size() == 1 && !last_broadcast) {
+        rows::parallel_copy(out, arg, out_dims.back() * elem_size);
+        return;
+    }
+
+    auto in_strides = rows::row_major_strides(in_dims);
+    for (size_t i = 0; i < in_dims.size(); ++i) {
+        if (in_dims[i] != out_dims[i])
+            in_strides[i] = 0;
+    }
+    const std::vector<size_t> row_dims(out_dims.begin(), out_dims.end() - 1);
+    const std::vector<size_t> row_strides(in_strides.begin(), in_strides.end() - 1);
+    const size_t row_size = out_dims.back();
+    const size_t row_bytes = row_size * elem_size;
+    rows::parallel_split(shape_size(row_dims), shape_size(out_dims) * elem_size, [&](size_t start, size_t end) {
+        rows::for_each_row(row_dims, row_strides, start, end, [&](size_t row, size_t in_offset) {
+            if (last_broadcast) {
+                broadcast_element(out + row * row_bytes, arg + in_offset * elem_size, row_size, elem_size);
+            } else {
+                std::memcpy(out + row * row_bytes, arg + in_offset * elem_size, row_bytes);
+            }
+        });
+    });
 }
 }  // namespace reference
 }  // namespace runtime
@@ -4,6 +4,10 @@
 
 #include "ngraph/runtime/reference/convert.hpp"
 
+#include <cstring>
+
+#include "parallel_rows.hpp"
+
 #if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
 
 #    include "jit_generator.hpp"
@@ -196,8 +200,14 @@ void convert_impl(const TI* arg, TO* out, size_t count) {
     auto converter = jit_convert_array::get<TI, TO>();
 
     if (converter) {
-        jit_convert_array::args_t args = {arg, out, count};
-        converter(&args);
+        // the chunks are multiples of the vector length, so only the last one has the tail
+        constexpr size_t chunk = 8 * 1024;
+        rows::parallel_split((count + chunk - 1) / chunk, count * sizeof(TO), [&](size_t start, size_t end) {
+            jit_convert_array::args_t args = {arg + start * chunk,
+                                              out + start * chunk,
+                                              std::min(end * chunk, count) - start * chunk};
+            converter(&args);
+        });
     } else {
         for (size_t i = 0; i < count; ++i) {
             out[i] = static_cast<TO>(arg[i]);
@@ -236,3 +246,35 @@ void convert<float16, int8_t>(const float16* arg, int8_t* out, size_t count) {
 }  // namespace ngraph
 
 #endif  // OPENVINO_ARCH_X86 || OPENVINO_ARCH_X86_64
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+// bfloat16 is the upper half of float, so the conversions are the bit shifts which the compiler vectorizes, the
+// rounding is the same as in the bfloat16 constructor
+template <>
+void convert<bfloat16, float>(const bfloat16* arg, float* out, size_t count) {
+    rows::parallel_split(count, count * sizeof(float), [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            uint16_t half;
+            std::memcpy(&half, arg + i, sizeof(half));
+            const uint32_t bits = static_cast<uint32_t>(half) << 16;
+            std::memcpy(out + i, &bits, sizeof(bits));
+        }
+    });
+}
+
+template <>
+void convert<float, bfloat16>(const float* arg, bfloat16* out, size_t count) {
+    rows::parallel_split(count, count * sizeof(float), [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            uint32_t bits;
+            std::memcpy(&bits, arg + i, sizeof(bits));
+            const auto half = static_cast<uint16_t>((bits + ((bits & 0x00010000) >> 1)) >> 16);
+            std::memcpy(out + i, &half, sizeof(half));
+        }
+    });
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
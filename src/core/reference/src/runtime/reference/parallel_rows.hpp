@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "openvino/core/parallel.hpp"
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+namespace rows {
+// the data movement kernels are split between the threads starting from this number of bytes
+constexpr size_t parallel_min_bytes = 1 << 16;
+
+/// \brief Splits [0, work_amount) between the threads if the kernel moves enough bytes and calls
+/// func(start, end) for every part.
+template <typename F>
+void parallel_split(size_t work_amount, size_t bytes, const F& func) {
+    if (work_amount == 0)
+        return;
+    const auto nthr = bytes < parallel_min_bytes
+                          ? 1
+                          : static_cast<int>(std::min(work_amount, static_cast<size_t>(parallel_get_max_threads())));
+    ov::parallel_nt(nthr, [&](const int ithr, const int nthreads) {
+        size_t start = 0, end = 0;
+        ov::splitter(work_amount, nthreads, ithr, start, end);
+        if (start < end)
+            func(start, end);
+    });
+}
+
+/// \brief Calls row(row_idx, in_offset) for the rows [start, end) of the output. The rows are indexed in the row-major
+/// order of row_dims (all the output dimensions but the innermost one), in_offset is the offset of the input elements
+/// of the row, in_strides are the input strides along row_dims (0 for the broadcast dimensions).
+template <typename F>
+void for_each_row(const std::vector<size_t>& row_dims,
+                  const std::vector<size_t>& in_strides,
+                  size_t start,
+                  size_t end,
+                  const F& row) {
+    std::vector<size_t> idx(row_dims.size(), 0);
+    size_t in_offset = 0;
+    for (size_t i = row_dims.size(), rest = start; i-- > 0;) {
+        idx[i] = rest % row_dims[i];
+        rest /= row_dims[i];
+        in_offset += idx[i] * in_strides[i];
+    }
+    for (size_t r = start; r < end; ++r) {
+        row(r, in_offset);
+        for (size_t i = row_dims.size(); i-- > 0;) {
+            in_offset += in_strides[i];
+            if (++idx[i] < row_dims[i])
+                break;
+            in_offset -= idx[i] * in_strides[i];
+            idx[i] = 0;
+        }
+    }
+}
+
+/// \brief memcpy split between the threads for the large buffers
+inline void parallel_copy(char* dst, const char* src, size_t bytes) {
+    constexpr size_t block = 4096;
+    parallel_split((bytes + block - 1) / block, bytes, [&](size_t start, size_t end) {
+        std::memcpy(dst + start * block, src + start * block, std::min(end * block, bytes) - start * block);
+    });
+}
+
+/// \brief Row-major strides of the dimensions in elements
+inline std::vector<size_t> row_major_strides(const std::vector<size_t>& dims) {
+    std::vector<size_t> strides(dims.size(), 1);
+    for (size_t i = dims.size(); i-- > 1;)
+        strides[i - 1] = strides[i] * dims[i];
+    return strides;
+}
+}  // namespace rows
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
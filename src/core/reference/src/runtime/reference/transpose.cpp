@@ -4,27 +4,189 @@
 
 #include "ngraph/runtime/reference/transpose.hpp"
 
+#include <algorithm>
 #include <cfenv>
 #include <cmath>
+#include <cstring>
 #include <numeric>
+#include <tuple>
 #include <vector>
 
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
 #include "ngraph/shape.hpp"
+#include "parallel_rows.hpp"
 
 namespace ngraph {
 namespace runtime {
 namespace reference {
+namespace {
+/// \brief Transposes the tiles of the output rows and of the output dimension which is the innermost one in the
+/// input, so both the reads and the writes of a tile stay in a few cache lines.
+///
+/// \param out_dims      Dimensions of the output.
+/// \param in_strides    Input strides along the output dimensions.
+/// \param in_inner_axis Output dimension with the unit input stride, it is not the innermost one.
+template <typename T>
+void transpose_blocked(const T* in,
+                       T* out,
+                       const std::vector<size_t>& out_dims,
+                       const std::vector<size_t>& in_strides,
+                       const size_t in_inner_axis) {
+    constexpr size_t block = 64 / sizeof(T) > 16 ? 64 / sizeof(T) : 16;
+    const auto out_strides = rows::row_major_strides(out_dims);
+    const size_t inner_axis = out_dims.size() - 1;
+
+    // the tiles are indexed by the output dimensions, where the two transposed ones are counted in blocks
+    std::vector<size_t> tile_dims(out_dims);
+    tile_dims[in_inner_axis] = (out_dims[in_inner_axis] + block - 1) / block;
+    tile_dims[inner_axis] = (out_dims[inner_axis] + block - 1) / block;
+    const size_t tiles = shape_size(tile_dims);
+
+    rows::parallel_split(tiles, shape_size(out_dims) * sizeof(T), [&](size_t start, size_t end) {
+        std::vector<size_t> idx(tile_dims.size());
+        for (size_t tile = start; tile < end; ++tile) {
+            for (size_t i = tile_dims.size(), rest = tile; i-- > 0;) {
+                idx[i] = rest % tile_dims[i];
+                rest /= tile_dims[i];
+            }
+            size_t in_offset = 0, out_offset = 0;
+            for (size_t i = 0; i < idx.size(); ++i) {
+                const auto pos = i == in_inner_axis || i == inner_axis ? idx[i] * block : idx[i];
+                in_offset += pos * in_strides[i];
+                out_offset += pos * out_strides[i];
+            }
+            const size_t rows_num = std::min(block, out_dims[in_inner_axis] - idx[in_inner_axis] * block);
+            const size_t cols_num = std::min(block, out_dims[inner_axis] - idx[inner_axis] * block);
+            const T* src = in + in_offset;
+            T* dst = out + out_offset;
+            const size_t src_stride = in_strides[inner_axis];
+            const size_t dst_stride = out_strides[in_inner_axis];
+            for (size_t r = 0; r < rows_num; ++r) {
+                for (size_t c = 0; c < cols_num; ++c)
+                    dst[r * dst_stride + c] = src[r + c * src_stride];
+            }
+        }
+    });
+}
+
+/// \brief Removes the unit dimensions and merges the dimensions which stay adjacent after the transposition.
+///
+/// \return the merged input dimensions and the order of the merged dimensions
+std::pair<std::vector<size_t>, std::vector<size_t>> merge_transposed_dims(const Shape& data_shape,
+                                                                          const int64_t* axes_order) {
+    const size_t rank = data_shape.size();
+    std::vector<size_t> squeezed_axis(rank, 0);
+    for (size_t i = 0, squeezed = 0; i < rank; ++i) {
+        squeezed_axis[i] = squeezed;
+        if (data_shape[i] != 1)
+            ++squeezed;
+    }
+    std::vector<size_t> squeezed_dims, squeezed_order;
+    for (size_t i = 0; i < rank; ++i) {
+        if (data_shape[i] != 1)
+            squeezed_dims.push_back(data_shape[i]);
+        const auto axis = static_cast<size_t>(axes_order[i]);
+        if (data_shape[axis] != 1)
+            squeezed_order.push_back(squeezed_axis[axis]);
+    }
+
+    // the groups of the output dimensions which are consecutive in the input, by their first input dimension
+    std::vector<size_t> group_of_axis(squeezed_dims.size(), 0);
+    std::vector<size_t> group_start;
+    for (size_t i = 0; i < squeezed_order.size(); ++i) {
+        if (i == 0 || squeezed_order[i] != squeezed_order[i - 1] + 1)
+            group_start.push_back(squeezed_order[i]);
+        group_of_axis[squeezed_order[i]] = group_start.size() - 1;
+    }
+    std::vector<size_t> sorted_starts(group_start);
+    std::sort(sorted_starts.begin(), sorted_starts.end());
+
+    std::vector<size_t> dims(sorted_starts.size(), 1), order(group_start.size());
+    for (size_t g = 0; g < group_start.size(); ++g) {
+        const auto merged_axis =
+            std::lower_bound(sorted_starts.begin(), sorted_starts.end(), group_start[g]) - sorted_starts.begin();
+        order[g] = merged_axis;
+    }
+    for (size_t axis = 0; axis < squeezed_dims.size(); ++axis)
+        dims[order[group_of_axis[axis]]] *= squeezed_dims[axis];
+    return {dims, order};
+}
+}  // namespace
+
 void transpose(const char* data,
                char* out,
                const Shape& data_shape,
                size_t element_size,
                const int64_t* axes_order,
                Shape out_shape) {
-    // To reuse opt_kernel::reshape axes order vector has to be converted to AxisVector
-    // Negative axes are not supported, it is validated by transpose evaluate method
-    std::vector<size_t> axis_vector(axes_order, axes_order + data_shape.size());
-    runtime::opt_kernel::reshape(data, out, data_shape, axis_vector, out_shape, element_size);
+    const auto total_size = shape_size(data_shape);
+    if (total_size == 0)
+        return;
+
+    std::vector<size_t> in_dims, order;
+    std::tie(in_dims, order) = merge_transposed_dims(data_shape, axes_order);
+    if (in_dims.size() <= 1) {
+        rows::parallel_copy(out, data, total_size * element_size);
+        return;
+    }
+
+    const auto in_strides = rows::row_major_strides(in_dims);
+    std::vector<size_t> out_dims(order.size()), out_in_strides(order.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        out_dims[i] = in_dims[order[i]];
+        out_in_strides[i] = in_strides[order[i]];
+    }
+
+    if (order.back() == order.size() - 1) {
+        // the innermost dimension is not moved, the output rows are copied from the input
+        const std::vector<size_t> row_dims(out_dims.begin(), out_dims.end() - 1);
+        const std::vector<size_t> row_strides(out_in_strides.begin(), out_in_strides.end() - 1);
+        const size_t row_bytes = out_dims.back() * element_size;
+        rows::parallel_split(shape_size(row_dims), total_size * element_size, [&](size_t start, size_t end) {
+            rows::for_each_row(row_dims, row_strides, start, end, [&](size_t row, size_t in_offset) {
+                std::memcpy(out + row * row_bytes, data + in_offset * element_size, row_bytes);
+            });
+        });
+        return;
+    }
+
+    const size_t in_inner_axis = std::find(order.begin(), order.end(), order.size() - 1) - order.begin();
+    switch (element_size) {
+    case 1:
+        transpose_blocked(reinterpret_cast<const uint8_t*>(data),
+                          reinterpret_cast<uint8_t*>(out),
+                          out_dims,
+                          out_in_strides,
+                          in_inner_axis);
+        break;
+    case 2:
+        transpose_blocked(reinterpret_cast<const uint16_t*>(data),
+                          reinterpret_cast<uint16_t*>(out),
+                          out_dims,
+                          out_in_strides,
+                          in_inner_axis);
+        break;
+    case 4:
+        transpose_blocked(reinterpret_cast<const uint32_t*>(data),
+                          reinterpret_cast<uint32_t*>(out),
+                          out_dims,
+                          out_in_strides,
+                          in_inner_axis);
+        break;
+    case 8:
+        transpose_blocked(reinterpret_cast<const uint64_t*>(data),
+                          reinterpret_cast<uint64_t*>(out),
+                          out_dims,
+                          out_in_strides,
+                          in_inner_axis);
+        break;
+    default: {
+        // To reuse opt_kernel::reshape axes order vector has to be converted to AxisVector
+        // Negative axes are not supported, it is validated by transpose evaluate method
+        std::vector<size_t> axis_vector(axes_order, axes_order + data_shape.size());
+        runtime::opt_kernel::reshape(data, out, data_shape, axis_vector, out_shape, element_size);
+    }
+    }
 }
 }  // namespace reference
 }  // namespace runtime
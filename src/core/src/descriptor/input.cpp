@@ -32,6 +32,8 @@ ov::descriptor::Input::~Input() {
 }
 
 void ov::descriptor::Input::replace_output(Output& new_output) {
+    // keep the previous source alive until the change is logged
+    const auto old_src_node = m_src_node;
     if (m_output != nullptr) {
         m_output->remove_input(this);
     }
@@ -46,6 +48,20 @@ void ov::descriptor::Input::replace_output(Output& new_output) {
              [](const std::shared_ptr<SharedRTInfo>& info) {
                  info->set_use_topological_cache(false);
              });
+
+    // This node gets a new input and both sources change their consumers
+    const auto log_changes = [&](const std::shared_ptr<SharedRTInfo>& info) {
+        if (!info->is_change_log_enabled())
+            return;
+        info->log_change(m_node);
+        if (old_src_node)
+            info->log_change(old_src_node.get());
+        info->log_change(m_src_node.get());
+    };
+    for_each(m_node->m_shared_rt_info.cbegin(), m_node->m_shared_rt_info.cend(), log_changes);
+    if (old_src_node)
+        for_each(old_src_node->m_shared_rt_info.cbegin(), old_src_node->m_shared_rt_info.cend(), log_changes);
+    for_each(m_src_node->m_shared_rt_info.cbegin(), m_src_node->m_shared_rt_info.cend(), log_changes);
 }
 
 void ov::descriptor::Input::replace_output(const std::shared_ptr<ov::Node>& node, size_t i) {
@@ -92,6 +92,12 @@ ov::Node::~Node() {
 
         for (descriptor::Input& input : m_inputs) {
             if (input.has_output()) {
+                {
+                    // the producer loses a consumer
+                    const auto producer = input.get_output().get_node();
+                    for (const auto& info : producer->m_shared_rt_info)
+                        info->log_change(producer.get());
+                }
                 // This test adds 1 to the actual count, so a count of 2 means this input is the only
                 // reference to the node.
                 if (input.get_output().get_node().use_count() == 2) {
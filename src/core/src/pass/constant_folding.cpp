@@ -4,11 +4,18 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <atomic>
 #include <openvino/cc/pass/itt.hpp>
+#include <unordered_map>
 
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/validation_util.hpp"
+#include "openvino/op/add.hpp"
 #include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/subtract.hpp"
 #include "openvino/op/util/op_types.hpp"
 #include "openvino/op/util/read_value_base.hpp"
 #include "openvino/op/util/shape_of_base.hpp"
@@ -51,10 +58,129 @@ const auto friendly_name_from = [](const ov::Node& node, const size_t output_cou
     }
 };
 
+namespace {
+// the elementwise nodes with at least this number of output elements are folded by several threads
+constexpr size_t parallel_fold_min_elements = 1 << 16;
+
+bool is_parallel_foldable(const std::shared_ptr<ov::Node>& node) {
+    using namespace ov::op;
+    // the sub-graphs of the MultiSubGraphOp nodes are folded by the sequential traversal
+    return node->get_input_size() && node->get_output_size() && !ov::is_type<v0::Constant>(node) &&
+           !ov::pass::constant_folding_is_disabled(node) && is_output_foldable(node->output(0)) &&
+           !util::is_parameter(node) && !util::is_output(node) && !util::is_sink(node) &&
+           !ov::is_type<util::ReadValueBase>(node) && !ov::is_type<util::MultiSubGraphOp>(node);
+}
+
+bool is_splittable_elementwise(const std::shared_ptr<ov::Node>& node) {
+    using namespace ov::op;
+    if (ov::is_type<v0::Convert>(node))
+        return true;
+    if (ov::is_type<v1::Add>(node) || ov::is_type<v1::Subtract>(node) || ov::is_type<v1::Multiply>(node)) {
+        const auto& autob = node->get_autob();
+        return autob.m_type == AutoBroadcastType::NUMPY || autob.m_type == AutoBroadcastType::NONE;
+    }
+    return false;
+}
+
+/**
+ * \brief Folds a large elementwise node by the chunks evaluated in parallel. The chunks are the ranges of the elements
+ * if every input is either of the output shape or a single element, otherwise the ranges of the outermost dimension
+ * if the inputs are not broadcast along it.
+ *
+ * \return false if the node is not split, it is folded as usual then.
+ */
+bool split_elementwise_fold(const std::shared_ptr<ov::Node>& node, ov::OutputVector& replacements) {
+    if (!is_splittable_elementwise(node) || ov::pass::constant_folding_is_disabled(node) ||
+        node->get_output_size() != 1 || node->get_output_partial_shape(0).is_dynamic())
+        return false;
+    const auto& out_shape = node->get_output_shape(0);
+    const auto& out_type = node->get_output_element_type(0);
+    const auto out_size = ov::shape_size(out_shape);
+    if (out_size < parallel_fold_min_elements || out_type.bitwidth() % 8 != 0)
+        return false;
+
+    using ConstantPtr = std::shared_ptr<ov::op::v0::Constant>;
+    std::vector<ConstantPtr> constants;
+    for (const auto& input : node->input_values()) {
+        auto constant = ov::as_type_ptr<ov::op::v0::Constant>(input.get_node_shared_ptr());
+        if (!constant || constant->get_element_type().bitwidth() % 8 != 0)
+            return false;
+        constants.push_back(constant);
+    }
+
+    const bool flat = std::all_of(constants.cbegin(), constants.cend(), [&](const ConstantPtr& c) {
+        return c->get_shape() == out_shape || ov::shape_size(c->get_shape()) == 1;
+    });
+    if (!flat) {
+        for (const auto& c : constants) {
+            const auto& shape = c->get_shape();
+            if (shape.size() == out_shape.size() && shape[0] != out_shape[0] && shape[0] != 1)
+                return false;
+        }
+    }
+    const size_t work_amount = flat ? out_size : out_shape[0];
+    const size_t chunks = std::min(work_amount, static_cast<size_t>(parallel_get_max_threads()));
+    if (chunks < 2)
+        return false;
+
+    // the chunk of a tensor, the inputs broadcast to the chunk are passed as is
+    auto chunk_of = [&](const ov::element::Type& type,
+                        const ov::Shape& shape,
+                        const void* data,
+                        size_t start,
+                        size_t end) {
+        auto chunk_shape = shape;
+        size_t offset = 0;
+        if (flat) {
+            if (shape == out_shape) {
+                chunk_shape = ov::Shape{end - start};
+                offset = start;
+            } else {
+                chunk_shape = ov::Shape{1};
+            }
+        } else if (shape.size() == out_shape.size() && shape[0] == out_shape[0]) {
+            chunk_shape[0] = end - start;
+            offset = start * (ov::shape_size(shape) / shape[0]);
+        }
+        return ov::Tensor(type, chunk_shape, const_cast<char*>(static_cast<const char*>(data)) + offset * type.size());
+    };
+
+    ov::Tensor output(out_type, out_shape);
+    std::atomic<bool> evaluated{true};
+    ov::parallel_for(chunks, [&](size_t chunk) {
+        size_t start = 0, end = 0;
+        ov::splitter(work_amount, chunks, chunk, start, end);
+        if (start >= end)
+            return;
+        ov::TensorVector inputs;
+        for (const auto& c : constants)
+            inputs.push_back(chunk_of(c->get_element_type(), c->get_shape(), c->get_data_ptr(), start, end));
+        ov::TensorVector outputs{chunk_of(out_type, out_shape, output.data(), start, end)};
+        if (!node->evaluate(outputs, inputs))
+            evaluated = false;
+    });
+    if (!evaluated)
+        return false;
+
+    ov::NodeVector nodes(constants.cbegin(), constants.cend());
+    replacements[0] = std::make_shared<ov::op::v0::Constant>(output);
+    ov::copy_runtime_info(nodes, replacements[0].get_node_shared_ptr());
+    return true;
+}
+
+bool fold_node(const std::shared_ptr<ov::Node>& node, ov::OutputVector& replacements, bool parallel) {
+    return (parallel && split_elementwise_fold(node, replacements)) ||
+           node->constant_fold(replacements, node->input_values());
+}
+}  // namespace
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
     bool rewritten = pre_calculated_values_folding(model);
+    if (m_parallel) {
+        rewritten = parallel_constant_subgraphs_folding(model) || rewritten;
+    }
 
     for (const auto& node : model->get_ordered_ops()) {
         if (rewritten) {
@@ -63,30 +189,8 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
 
         OutputVector replacements(node->get_output_size());
 
-        if (node->constant_fold(replacements, node->input_values())) {
-            OPENVINO_ASSERT(!constant_folding_is_disabled(node),
-                            "Node folded but constant folding disabled. Check constant_fold implementation for ",
-                            node);
-            OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
-                            "constant_fold_default returned incorrect number of replacements for ",
-                            node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
-
-                    node_output.replace(replacement);
-                    // Copy runtime info from source nodes
-                    // when it was not propogated during pre-calculation
-                    copy_runtime_info_from_input_values(node);
-                    // Propagate runtime info attributes to replacement
-                    copy_runtime_info(node, replacement.get_node_shared_ptr());
-
-                    rewritten = true;
-                }
-            }
+        if (fold_node(node, replacements, m_parallel)) {
+            rewritten = replace_folded_outputs(node, replacements) || rewritten;
         } else {
             // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
             if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
@@ -101,6 +205,100 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
     return rewritten;
 }
 
+bool ov::pass::ConstantFolding::replace_folded_outputs(const std::shared_ptr<Node>& node,
+                                                      const OutputVector& replacements) {
+    OPENVINO_ASSERT(!constant_folding_is_disabled(node),
+                    "Node folded but constant folding disabled. Check constant_fold implementation for ",
+                    node);
+    OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
+                    "constant_fold_default returned incorrect number of replacements for ",
+                    node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i) {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+            replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
+
+            node_output.replace(replacement);
+            // Copy runtime info from source nodes
+            // when it was not propogated during pre-calculation
+            copy_runtime_info_from_input_values(node);
+            // Propagate runtime info attributes to replacement
+            copy_runtime_info(node, replacement.get_node_shared_ptr());
+
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
+
+bool ov::pass::ConstantFolding::parallel_constant_subgraphs_folding(const std::shared_ptr<ov::Model>& model) {
+    // the level of a node is the longest path to it from the constants, so the inputs of the level nodes are folded
+    // on the previous levels
+    std::unordered_map<const Node*, size_t> levels;
+    std::vector<NodeVector> level_nodes;
+    for (const auto& node : model->get_ordered_ops()) {
+        if (!is_parallel_foldable(node))
+            continue;
+        size_t level = 0;
+        bool from_constants = true;
+        for (const auto& input : node->input_values()) {
+            if (ov::is_type<op::v0::Constant>(input.get_node()))
+                continue;
+            const auto it = levels.find(input.get_node());
+            if (it == levels.end()) {
+                from_constants = false;
+                break;
+            }
+            level = std::max(level, it->second + 1);
+        }
+        if (!from_constants)
+            continue;
+        levels[node.get()] = level;
+        if (level_nodes.size() <= level)
+            level_nodes.resize(level + 1);
+        level_nodes[level].push_back(node);
+    }
+
+    bool rewritten = false;
+    for (const auto& nodes : level_nodes) {
+        // the consumers of the nodes which are not folded are left for the sequential traversal
+        NodeVector ready;
+        for (const auto& node : nodes) {
+            const auto& inputs = node->input_values();
+            if (std::all_of(inputs.cbegin(), inputs.cend(), [](const Output<Node>& input) {
+                    return ov::is_type<op::v0::Constant>(input.get_node());
+                })) {
+                node->validate_and_infer_types();
+                // the unique names are generated lazily, they are created before the concurrent evaluation
+                for (const auto& input : inputs)
+                    input.get_node()->get_name();
+                ready.push_back(node);
+            }
+        }
+
+        std::vector<OutputVector> replacements(ready.size());
+        std::vector<char> folded(ready.size(), 0);
+        auto fold = [&](size_t i) {
+            replacements[i].resize(ready[i]->get_output_size());
+            folded[i] = fold_node(ready[i], replacements[i], true);
+        };
+        if (ready.size() == 1) {
+            fold(0);
+        } else {
+            ov::parallel_for(ready.size(), fold);
+        }
+
+        for (size_t i = 0; i < ready.size(); ++i) {
+            if (folded[i])
+                rewritten = replace_folded_outputs(ready[i], replacements[i]) || rewritten;
+        }
+    }
+    return rewritten;
+}
+
 void ov::pass::ConstantFolding::copy_runtime_info_from_input_values(const std::shared_ptr<Node>& node) {
     if (is_type<op::util::ShapeOfBase>(node)) {
         // Don't propogate names of ShapeOf source node since it is not fused itself
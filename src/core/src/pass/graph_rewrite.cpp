@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <deque>
 #include <iostream>
+#include <limits>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <openvino/cc/pass/itt.hpp>
 #include <regex>
@@ -17,7 +18,12 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "openvino/pass/pattern/op/any_output.hpp"
+#include "openvino/pass/pattern/op/branch.hpp"
+#include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/or.hpp"
 #include "perf_counters.hpp"
+#include "shared_node_info.hpp"
 
 /* GraphRewrite algorithm:
  * GraphRewrite processes an input graph in an topological order(i.e. args before users)
@@ -49,7 +55,16 @@
  * In this case, you need to register nodes in MatcherPass manually using register_new_node method.
  * GraphRewrite will automatically add this nodes in the beginning of execution queue.
  * If MatcherPass register more than one node make sure that this nodes are registered in
- * topological order. */
+ * topological order.
+ *
+ * In the incremental mode the model logs the nodes which inputs or consumers are reconnected, so the next run of
+ * the same matcher passes starts from the nodes logged since their previous run (and the nodes created since then
+ * which are connected to them) instead of the whole model. For example, if another pass replaces `Neg3` with `Relu6`,
+ * the log contains `Neg3`, `Constant1`, `Add4` and `Relu6`, so `Constant1`, `Relu6` and `Add4` are visited. The
+ * consumers of them up to the depth of the patterns are visited too, as the patterns rooted there may match the
+ * changed nodes: `Result5` is visited if a pattern has two levels. After the run only the changed nodes are
+ * revalidated, the type and shape inference goes to the consumers while
+ * the output types or shapes change. */
 
 #ifdef ENABLE_PROFILING_ITT
 
@@ -78,6 +93,9 @@ bool ov::pass::BackwardGraphRewrite::run_on_model(const std::shared_ptr<ov::Mode
 
 bool ov::pass::GraphRewrite::run_on_model(const std::shared_ptr<ov::Model>& f) {
     RUN_ON_MODEL_SCOPE(GraphRewrite);
+    if (m_incremental) {
+        return run_incrementally(f);
+    }
     // Initialize execution queue with nodes in topological order
     std::deque<std::weak_ptr<Node>> nodes_to_run;
     for (auto& node : f->get_ordered_ops()) {
@@ -88,6 +106,336 @@ bool ov::pass::GraphRewrite::run_on_model(const std::shared_ptr<ov::Model>& f) {
 
 bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
                                                   std::deque<std::weak_ptr<Node>> nodes_to_run) {
+    return apply_matcher_passes(std::move(f), std::move(nodes_to_run), nullptr);
+}
+
+namespace {
+constexpr size_t unbounded_depth = std::numeric_limits<size_t>::max();
+
+/// \return the length of the longest path from the root of the pattern to its inputs, the nodes matched by the
+/// pattern are not farther from the matched root. unbounded_depth is returned for the recurrent patterns.
+size_t get_pattern_depth(ov::Node* root) {
+    // these patterns match their inputs to the same node
+    const auto same_node = [](const ov::Node* node) {
+        return ov::is_type<ov::pass::pattern::op::Label>(node) || ov::is_type<ov::pass::pattern::op::Or>(node) ||
+               ov::is_type<ov::pass::pattern::op::AnyOutput>(node);
+    };
+    std::unordered_map<ov::Node*, size_t> depths;
+    std::unordered_set<ov::Node*> on_path{root};
+    std::vector<std::pair<ov::Node*, size_t>> path{{root, 0}};
+    while (!path.empty()) {
+        const auto node = path.back().first;
+        if (ov::is_type<ov::pass::pattern::op::Branch>(node))
+            return unbounded_depth;
+        const size_t input_index = path.back().second++;
+        if (input_index < node->get_input_size()) {
+            const auto producer = node->get_input_node_ptr(input_index);
+            if (on_path.count(producer))
+                return unbounded_depth;
+            if (!depths.count(producer)) {
+                on_path.insert(producer);
+                path.emplace_back(producer, 0);
+            }
+        } else {
+            const size_t level = same_node(node) ? 0 : 1;
+            size_t depth = 0;
+            for (size_t i = 0; i < node->get_input_size(); ++i)
+                depth = std::max(depth, depths[node->get_input_node_ptr(i)] + level);
+            depths[node] = depth;
+            on_path.erase(node);
+            path.pop_back();
+        }
+    }
+    return depths[root];
+}
+
+/// \brief Appends the consumers of the nodes up to the depth to selected
+///
+/// \return the appended consumers in the order of the distance from the nodes
+std::vector<ov::Node*> select_consumers(std::unordered_map<ov::Node*, std::shared_ptr<ov::Node>>& selected,
+                                        const std::vector<ov::Node*>& nodes,
+                                        size_t depth) {
+    std::vector<ov::Node*> consumers;
+    size_t level_begin = 0;
+    for (size_t level = 0; level < depth; ++level) {
+        const size_t level_end = consumers.size();
+        const auto visit = [&](ov::Node* node) {
+            for (const auto& output : node->outputs()) {
+                for (const auto& input : output.get_target_inputs()) {
+                    const auto consumer = input.get_node();
+                    if (selected.emplace(consumer, consumer->shared_from_this()).second)
+                        consumers.push_back(consumer);
+                }
+            }
+        };
+        if (level == 0) {
+            for (const auto node : nodes)
+                visit(node);
+        } else {
+            for (size_t i = level_begin; i < level_end; ++i)
+                visit(consumers[i]);
+        }
+        if (consumers.size() == level_end)
+            break;
+        level_begin = level_end;
+    }
+    return consumers;
+}
+
+/// \brief Collects the changed nodes, the nodes created since first_new_instance_id which are producers of them
+/// (directly or through other created nodes), the producers of the created nodes and the consumers of all of them
+/// up to consumers_depth.
+///
+/// \return the collected nodes in the topological order of the connections between them
+std::vector<std::shared_ptr<ov::Node>> collect_changed_nodes(const std::vector<std::shared_ptr<ov::Node>>& changed,
+                                                             size_t first_new_instance_id,
+                                                             size_t consumers_depth) {
+    std::unordered_map<ov::Node*, std::shared_ptr<ov::Node>> selected;
+    std::vector<std::shared_ptr<ov::Node>> stack;
+    for (const auto& node : changed) {
+        if (selected.emplace(node.get(), node).second)
+            stack.push_back(node);
+    }
+    while (!stack.empty()) {
+        const auto node = std::move(stack.back());
+        stack.pop_back();
+        if (node->get_instance_id() < first_new_instance_id)
+            continue;
+        for (const auto& input : node->input_values()) {
+            const auto producer = input.get_node_shared_ptr();
+            if (selected.emplace(producer.get(), producer).second)
+                stack.push_back(producer);
+        }
+    }
+    if (consumers_depth != 0) {
+        std::vector<ov::Node*> nodes;
+        nodes.reserve(selected.size());
+        for (const auto& item : selected)
+            nodes.push_back(item.first);
+        select_consumers(selected, std::move(nodes), consumers_depth);
+    }
+
+    // depth first search over the inputs, the roots are taken in the creation order of the nodes
+    std::vector<ov::Node*> roots;
+    roots.reserve(selected.size());
+    for (const auto& item : selected)
+        roots.push_back(item.first);
+    std::sort(roots.begin(), roots.end(), [](const ov::Node* lhs, const ov::Node* rhs) {
+        return lhs->get_instance_id() < rhs->get_instance_id();
+    });
+    std::vector<std::shared_ptr<ov::Node>> ordered;
+    ordered.reserve(selected.size());
+    std::unordered_set<ov::Node*> entered;
+    std::vector<std::pair<ov::Node*, size_t>> path;
+    for (const auto root : roots) {
+        if (!entered.insert(root).second)
+            continue;
+        path.emplace_back(root, 0);
+        while (!path.empty()) {
+            auto& top = path.back();
+            if (top.second < top.first->get_input_size()) {
+                const auto producer = top.first->get_input_node_ptr(top.second++);
+                if (selected.count(producer) && entered.insert(producer).second)
+                    path.emplace_back(producer, 0);
+            } else {
+                ordered.push_back(selected[top.first]);
+                path.pop_back();
+            }
+        }
+    }
+    return ordered;
+}
+
+bool outputs_changed(const ov::Node& node,
+                     const std::vector<std::pair<ov::element::Type, ov::PartialShape>>& outputs_before) {
+    if (node.get_output_size() != outputs_before.size())
+        return true;
+    for (size_t i = 0; i < outputs_before.size(); ++i) {
+        if (node.get_output_element_type(i) != outputs_before[i].first ||
+            node.get_output_partial_shape(i) != outputs_before[i].second)
+            return true;
+    }
+    return false;
+}
+
+/// \brief Infers the types and shapes of the nodes again, the consumers are revalidated if the outputs change. The
+/// nodes which outputs change are logged, the patterns may check them.
+///
+/// \return the number of revalidated nodes
+size_t revalidate_changed_nodes(const std::vector<std::shared_ptr<ov::Node>>& nodes, ov::SharedRTInfo& info) {
+    std::deque<std::shared_ptr<ov::Node>> nodes_to_validate(nodes.begin(), nodes.end());
+    std::unordered_set<ov::Node*> pending;
+    for (const auto& node : nodes)
+        pending.insert(node.get());
+    std::vector<std::pair<ov::element::Type, ov::PartialShape>> outputs_before;
+    size_t revalidated = 0;
+    while (!nodes_to_validate.empty()) {
+        const auto node = std::move(nodes_to_validate.front());
+        nodes_to_validate.pop_front();
+        pending.erase(node.get());
+
+        outputs_before.clear();
+        for (const auto& output : node->outputs())
+            outputs_before.emplace_back(output.get_element_type(), output.get_partial_shape());
+        node->revalidate_and_infer_types();
+        ++revalidated;
+        if (!outputs_changed(*node, outputs_before))
+            continue;
+        info.log_change(node.get());
+        for (const auto& output : node->outputs()) {
+            for (const auto& consumer : output.get_target_inputs()) {
+                const auto consumer_node = consumer.get_node();
+                if (pending.insert(consumer_node).second)
+                    nodes_to_validate.push_back(consumer_node->shared_from_this());
+            }
+        }
+    }
+    return revalidated;
+}
+}  // namespace
+
+bool ov::pass::GraphRewrite::run_incrementally(const std::shared_ptr<Model>& f) {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::core, "pass::GraphRewrite::run_incrementally");
+    const auto info = f->m_shared_rt_info;
+    // out of the session of the manager the changes are dropped after the run
+    IncrementalRewritesScope incremental_rewrites(info);
+    const size_t change_log_position = info->get_change_log_end();
+    const size_t first_new_instance_id = Node::m_next_instance_id.load();
+    const auto& pass_config = get_pass_config();
+
+    // The matcher passes are identified by the type and the matcher name, the passes of the same type are expected
+    // to match the same patterns. The replay starts from the earliest of their previous runs.
+    std::vector<std::pair<std::string, std::shared_ptr<PassConfig>>> keys;
+    size_t consumers_depth = 0;
+    for (const auto& m_pass : m_matchers) {
+        if (pass_config->is_disabled(m_pass->get_type_info()))
+            continue;
+        const auto matcher = m_pass->get_matcher();
+        keys.emplace_back(std::string(m_pass->get_type_info().name) + "/" + (matcher ? matcher->get_name() : "") +
+                              (m_enable_shape_inference ? "/shape_inference" : ""),
+                          m_pass->get_pass_config());
+        const size_t depth = matcher ? get_pattern_depth(matcher->get_pattern_value().get_node()) : unbounded_depth;
+        consumers_depth = std::max(consumers_depth, depth);
+    }
+    auto& states = info->get_rewrite_states();
+    const SharedRTInfo::RewriteState* previous = nullptr;
+    for (const auto& key : keys) {
+        // the callbacks of the passes are set in the config
+        const auto state = states.find(key.first);
+        if (state == states.end() || state->second.pass_config.lock() != key.second) {
+            previous = nullptr;
+            break;
+        }
+        if (!previous || state->second.change_log_position < previous->change_log_position)
+            previous = &state->second;
+    }
+
+    // the nodes changed since the previous run, they are replayed if the part of the model is small enough
+    std::vector<std::shared_ptr<Node>> nodes;
+    bool replay = false;
+    SharedRTInfo::RewriteState state;
+    if (previous && consumers_depth != unbounded_depth) {
+        state = *previous;
+        std::vector<std::shared_ptr<Node>> changed;
+        if (info->get_changes_since(state.change_log_position, changed)) {
+            nodes = collect_changed_nodes(changed, state.first_new_instance_id, consumers_depth);
+            replay = nodes.size() * 2 < state.model_size;
+        }
+    }
+    if (replay) {
+        std::unordered_set<Node*> selected;
+        for (const auto& node : nodes) {
+            selected.insert(node.get());
+            node->insert_info(info);
+            if (node->get_instance_id() >= state.first_new_instance_id) {
+                ++state.model_size;
+                if (std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node))
+                    state.sub_graph_ops.emplace_back(node);
+            }
+        }
+        // the bodies are visited through the sub-graph operations
+        for (const auto& weak_op : state.sub_graph_ops) {
+            const auto op = weak_op.lock();
+            if (op && !selected.count(op.get()))
+                nodes.insert(nodes.begin(), op);
+        }
+    } else {
+        nodes = f->get_ordered_ops();
+        state.model_size = nodes.size();
+        state.sub_graph_ops.clear();
+        for (const auto& node : nodes) {
+            if (std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node))
+                state.sub_graph_ops.emplace_back(node);
+        }
+    }
+    state.change_log_position = change_log_position;
+    state.first_new_instance_id = first_new_instance_id;
+    const size_t model_size = state.model_size;
+
+    std::deque<std::weak_ptr<Node>> nodes_to_run;
+    std::unordered_set<Node*> queued;
+    for (const auto& node : nodes) {
+        nodes_to_run.emplace_back(node);
+        queued.insert(node.get());
+    }
+    nodes.clear();
+
+    // In the replay the existing nodes changed by the rewrites and their consumers up to the depth of the patterns
+    // are not necessarily in the queue, so they are appended. The nodes created by the rewrites are visited only if
+    // they are registered like in the full run.
+    size_t revisit_position = info->get_change_log_end();
+    const auto revisit = [&](std::deque<std::weak_ptr<Node>>& queue) {
+        if (!replay || revisit_position == info->get_change_log_end())
+            return;
+        std::vector<std::shared_ptr<Node>> changed;
+        info->get_changes_since(revisit_position, changed);
+        revisit_position = info->get_change_log_end();
+        std::unordered_map<Node*, std::shared_ptr<Node>> selected;
+        std::vector<Node*> existing;
+        for (const auto& node : changed) {
+            if (node->get_instance_id() < first_new_instance_id && selected.emplace(node.get(), node).second)
+                existing.push_back(node.get());
+        }
+        const auto consumers = select_consumers(selected, existing, consumers_depth);
+        existing.insert(existing.end(), consumers.begin(), consumers.end());
+        for (const auto node : existing) {
+            if (node->get_instance_id() < first_new_instance_id && queued.insert(node).second)
+                queue.emplace_back(selected[node]);
+        }
+    };
+    const bool rewritten = apply_matcher_passes(f, std::move(nodes_to_run), revisit);
+    ++m_statistics.incremental_runs;
+
+    // the nodes which outputs are changed by the revalidation are logged, the patterns may check them
+    const auto validate_model = [&]() {
+        validate_and_log_changes(f->get_ordered_ops(), *info, [&]() {
+            f->validate_nodes_and_infer_types();
+        });
+    };
+    std::vector<std::shared_ptr<Node>> changed;
+    if (!info->get_changes_since(change_log_position, changed)) {
+        validate_model();
+        m_statistics.revalidated_nodes += model_size;
+    } else if (!changed.empty()) {
+        const auto changed_nodes = collect_changed_nodes(changed, first_new_instance_id, 0);
+        try {
+            m_statistics.revalidated_nodes += revalidate_changed_nodes(changed_nodes, *info);
+        } catch (...) {
+            // the nodes may be revalidated before their changed producers, the whole model is validated to check
+            // if the error is real
+            validate_model();
+        }
+    }
+    for (const auto& key : keys) {
+        state.pass_config = key.second;
+        states[key.first] = state;
+    }
+    return rewritten;
+}
+
+bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
+                                                  std::deque<std::weak_ptr<Node>> nodes_to_run,
+                                                  const revisit_callback& revisit) {
     OV_ITT_SCOPED_TASK(ov::itt::domains::core, "pass::GraphRewrite::apply_matcher_passes");
 
     bool rewritten = false;
@@ -152,6 +500,9 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
         bool status = m_pass->apply(node);
+        ++m_statistics.matcher_calls;
+        if (status)
+            ++m_statistics.rewrites;
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -164,6 +515,8 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
             }
             m_pass->clear_new_nodes();
         }
+        if (revisit)
+            revisit(nodes_to_run);
         return status;
     };
 
@@ -177,6 +530,7 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         auto node = weak_node.lock();
         if (!node)
             continue;
+        ++m_statistics.visited_nodes;
 
         // Recursive apply Matchers for sub-graph based nodes
         if (auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node)) {
@@ -184,7 +538,11 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
                 size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
                 for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
                     auto sub_graph = sub_graph_node->get_function(sub_graph_ind);
-                    run_on_model(sub_graph);
+                    if (run_on_model(sub_graph) && m_incremental) {
+                        // the operation is revalidated with the changed body
+                        for (const auto& info : node->m_shared_rt_info)
+                            info->log_change(node.get());
+                    }
                 }
             }
         }
@@ -22,6 +22,7 @@
 #include "ngraph/util.hpp"
 #include "openvino/util/env_util.hpp"
 #include "perf_counters.hpp"
+#include "shared_node_info.hpp"
 
 using namespace std;
 
@@ -59,6 +60,19 @@ void ov::pass::Manager::set_per_pass_validation(bool new_state) {
     m_per_pass_validation = new_state;
 }
 
+void ov::pass::Manager::set_incremental_rewrite(bool new_state) {
+    m_incremental_rewrite = new_state;
+}
+
+namespace {
+void print_rewrite_statistics(const ov::pass::GraphRewrite::Statistics& before,
+                              const ov::pass::GraphRewrite::Statistics& after) {
+    cout << " (visited " << after.visited_nodes - before.visited_nodes << ", matched "
+         << after.matcher_calls - before.matcher_calls << ", rewritten " << after.rewrites - before.rewrites
+         << ", revalidated " << after.revalidated_nodes - before.revalidated_nodes << ")";
+}
+}  // namespace
+
 bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     NGRAPH_SUPPRESS_DEPRECATED_START
     OV_ITT_SCOPED_TASK(ov::itt::domains::core, "pass::Manager::run_passes");
@@ -73,6 +87,14 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     bool pass_applied = false;
     bool function_changed = false;
     bool needs_validate = false;
+    // the pass was a GraphRewrite which revalidated the changed nodes
+    bool revalidated = false;
+    bool deferred_validate = false;
+    // the managers run by the passes continue the incremental rewrites of the outer one
+    const bool incremental_rewrite = m_incremental_rewrite || func->m_shared_rt_info->is_incremental_rewrites_active();
+    std::unique_ptr<IncrementalRewritesScope> incremental_rewrites;
+    if (incremental_rewrite)
+        incremental_rewrites.reset(new IncrementalRewritesScope(func->m_shared_rt_info));
     for (auto& pass : m_pass_list) {
         if (m_pass_config->is_disabled(pass->get_type_info())) {
             NGRAPH_DEBUG << "Pass " << pass->get_name() << " is disabled";
@@ -83,6 +105,14 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
 
         pass_timer.start();
 
+        GraphRewrite::Statistics rewrite_before, rewrite_after;
+        const auto graph_rewrite = dynamic_pointer_cast<GraphRewrite>(pass);
+        if (graph_rewrite) {
+            if (incremental_rewrite)
+                graph_rewrite->set_incremental(true);
+            rewrite_before = graph_rewrite->get_statistics();
+        }
+
         if (auto matcher_pass = dynamic_pointer_cast<MatcherPass>(pass)) {
             // This checks is to skip the graph transformation when the graph pass relies on
             // static shape but the function state is dynamic.
@@ -93,7 +123,10 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
             }
             // GraphRewrite is a temporary container for MatcherPass to make execution
             // on on entire ngraph::Function
-            pass_applied = GraphRewrite(matcher_pass).run_on_model(func);
+            GraphRewrite rewrite(matcher_pass);
+            rewrite.set_incremental(incremental_rewrite);
+            pass_applied = rewrite.run_on_model(func);
+            rewrite_after = rewrite.get_statistics();
         } else if (auto function_pass = dynamic_pointer_cast<ModelPass>(pass)) {
             // This checks is to skip the graph transformation when the graph pass relies on
             // static shape but the function state is dynamic.
@@ -104,12 +137,24 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
             }
 
             if (dynamic_pointer_cast<Validate>(pass)) {
-                if (needs_validate) {
+                if (needs_validate && incremental_rewrite) {
+                    // the nodes which types or shapes are changed are revisited by the next incremental rewrites
+                    validate_and_log_changes(func->get_ordered_ops(), *func->m_shared_rt_info, [&]() {
+                        function_pass->run_on_model(func);
+                    });
+                    needs_validate = false;
+                    deferred_validate = false;
+                } else if (needs_validate) {
                     function_pass->run_on_model(func);
                     needs_validate = false;
+                    deferred_validate = false;
+                } else if (revalidated) {
+                    deferred_validate = true;
                 }
             } else {
                 pass_applied = function_pass->run_on_model(func);
+                if (graph_rewrite)
+                    rewrite_after = graph_rewrite->get_statistics();
             }
         } else if (auto node_pass = dynamic_pointer_cast<ngraph::pass::NodePass>(pass)) {
             if (node_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && func->is_dynamic()) {
@@ -138,10 +183,19 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
         index++;
         pass_timer.stop();
         if (profile_enabled) {
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
+            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name();
+            if (rewrite_after.matcher_calls + rewrite_after.visited_nodes != 0)
+                print_rewrite_statistics(rewrite_before, rewrite_after);
+            cout << "\n";
         }
         function_changed = function_changed || pass_applied;
-        needs_validate = pass_applied;
+        // the incremental runs revalidate the model themselves
+        revalidated = pass_applied && rewrite_after.incremental_runs != rewrite_before.incremental_runs;
+        needs_validate = pass_applied && !revalidated;
+    }
+    if (deferred_validate) {
+        // the checks of the whole model are done once for all the skipped Validate passes
+        func->validate_nodes_and_infer_types();
     }
     if (profile_enabled) {
         cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
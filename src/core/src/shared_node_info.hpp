@@ -4,9 +4,14 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <openvino/core/except.hpp>
 #include <openvino/core/node.hpp>
+#include <openvino/pass/pass_config.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace ov {
 class SharedRTInfo {
@@ -21,7 +26,132 @@ public:
         return m_use_topological_cache;
     }
 
+    /// \brief State of the model after the last incremental run of a matcher pass
+    struct RewriteState {
+        std::weak_ptr<ov::pass::PassConfig> pass_config;
+        size_t change_log_position = 0;
+        size_t first_new_instance_id = 0;
+        size_t model_size = 0;
+        std::vector<std::weak_ptr<Node>> sub_graph_ops;
+    };
+
+    /// \brief Starts the incremental rewrites session, the nodes which inputs or consumers are changed are recorded
+    /// until the session ends, so the repeated graph rewrites revisit only the modified part of the model. The
+    /// sessions can be nested, the log and the states of the passes are dropped when the outermost one ends.
+    void begin_incremental_rewrites() {
+        if (m_incremental_rewrites++ == 0)
+            m_change_log_enabled = true;
+    }
+
+    void end_incremental_rewrites() {
+        if (--m_incremental_rewrites != 0)
+            return;
+        m_change_log_enabled = false;
+        m_change_log_begin += m_change_log.size();
+        std::vector<std::weak_ptr<Node>>().swap(m_change_log);
+        m_rewrite_states.clear();
+    }
+
+    bool is_incremental_rewrites_active() const {
+        return m_incremental_rewrites != 0;
+    }
+
+    bool is_change_log_enabled() const {
+        return m_change_log_enabled;
+    }
+
+    /// \brief States of the matcher passes run in the current session, the key identifies the matcher pass
+    std::unordered_map<std::string, RewriteState>& get_rewrite_states() {
+        return m_rewrite_states;
+    }
+
+    void log_change(Node* node) {
+        if (!m_change_log_enabled)
+            return;
+        if (m_change_log.size() == max_change_log_size) {
+            // the oldest positions can't be replayed anymore, the passes which need them run on the whole model
+            m_change_log_begin += m_change_log.size();
+            m_change_log.clear();
+        }
+        m_change_log.emplace_back(node->shared_from_this());
+    }
+
+    /// \return Position after the last recorded change
+    size_t get_change_log_end() const {
+        return m_change_log_begin + m_change_log.size();
+    }
+
+    /// \brief Appends the live nodes changed since the position to nodes.
+    /// \return false if the changes since the position were dropped from the log
+    bool get_changes_since(size_t position, std::vector<std::shared_ptr<Node>>& nodes) const {
+        if (position < m_change_log_begin)
+            return false;
+        for (size_t i = position - m_change_log_begin; i < m_change_log.size(); ++i) {
+            if (auto node = m_change_log[i].lock())
+                nodes.push_back(std::move(node));
+        }
+        return true;
+    }
+
 private:
+    // the log keeps the memory of the removed nodes until it is dropped
+    static constexpr size_t max_change_log_size = 1 << 16;
+
     bool m_use_topological_cache;
+    bool m_change_log_enabled = false;
+    size_t m_incremental_rewrites = 0;
+    size_t m_change_log_begin = 0;
+    std::vector<std::weak_ptr<Node>> m_change_log;
+    std::unordered_map<std::string, RewriteState> m_rewrite_states;
+};
+
+/// \brief Calls validate and records the nodes which output types or shapes are changed by it in the change log, so
+/// the incremental rewrites revisit the nodes which patterns may check them.
+inline void validate_and_log_changes(const std::vector<std::shared_ptr<Node>>& nodes,
+                                     SharedRTInfo& info,
+                                     const std::function<void()>& validate) {
+    if (!info.is_change_log_enabled()) {
+        validate();
+        return;
+    }
+    std::vector<std::pair<element::Type, PartialShape>> outputs_before;
+    std::vector<size_t> outputs_num;
+    outputs_num.reserve(nodes.size());
+    for (const auto& node : nodes) {
+        outputs_num.push_back(node->get_output_size());
+        for (const auto& output : node->outputs())
+            outputs_before.emplace_back(output.get_element_type(), output.get_partial_shape());
+    }
+    validate();
+    auto before = outputs_before.cbegin();
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const auto& node = nodes[i];
+        bool changed = node->get_output_size() != outputs_num[i];
+        for (size_t j = 0; j < outputs_num[i] && !changed; ++j) {
+            changed = node->get_output_element_type(j) != before[j].first ||
+                      node->get_output_partial_shape(j) != before[j].second;
+        }
+        if (changed)
+            info.log_change(node.get());
+        before += outputs_num[i];
+    }
+}
+
+/// \brief Keeps the incremental rewrites session of the model open while the scope exists
+class IncrementalRewritesScope {
+public:
+    explicit IncrementalRewritesScope(std::shared_ptr<SharedRTInfo> info) : m_info(std::move(info)) {
+        m_info->begin_incremental_rewrites();
+    }
+
+    ~IncrementalRewritesScope() {
+        m_info->end_incremental_rewrites();
+    }
+
+    IncrementalRewritesScope(const IncrementalRewritesScope&) = delete;
+    IncrementalRewritesScope& operator=(const IncrementalRewritesScope&) = delete;
+
+private:
+    std::shared_ptr<SharedRTInfo> m_info;
 };
 }  // namespace ov
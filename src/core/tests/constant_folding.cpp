@@ -3911,3 +3911,70 @@ TEST(constant_folding, gather_with_dynamic_shapes_in_data_input) {
     check_names(strided_slice, {"strided_slice"}, "strided_slice");
     check_names(res, {"result"}, "result");
 }
+
+TEST(constant_folding, parallel_folding) {
+    auto make_model = []() {
+        const Shape shape{64, 2048};
+        std::vector<float> weights(shape_size(shape)), scales(shape[1]), shifts(shape_size(shape));
+        for (size_t i = 0; i < weights.size(); i++) {
+            weights[i] = static_cast<float>(i % 97) - 48.f;
+            shifts[i] = static_cast<float>(i % 13) * 0.5f;
+        }
+        for (size_t i = 0; i < scales.size(); i++)
+            scales[i] = static_cast<float>(i % 7) * 0.25f;
+
+        // large elementwise nodes folded by the chunks of the elements and of the outermost dimension
+        auto weights_const = make_shared<ov::opset11::Constant>(element::f16, shape, weights);
+        weights_const->set_friendly_name("weights");
+        auto convert = make_shared<ov::opset11::Convert>(weights_const, element::f32);
+        convert->set_friendly_name("convert");
+        auto scales_const = make_shared<ov::opset11::Constant>(element::f32, Shape{1, shape[1]}, scales);
+        scales_const->set_friendly_name("scales");
+        auto multiply = make_shared<ov::opset11::Multiply>(convert, scales_const);
+        multiply->set_friendly_name("multiply");
+        auto shifts_const = make_shared<ov::opset11::Constant>(element::f32, shape, shifts);
+        shifts_const->set_friendly_name("shifts");
+        auto add = make_shared<ov::opset11::Add>(multiply, shifts_const);
+        add->set_friendly_name("test");
+
+        // independent small sub-graph
+        auto a = ov::opset11::Constant::create(element::i32, Shape{4}, {1, 2, 3, 4});
+        a->set_friendly_name("a");
+        auto b = ov::opset11::Constant::create(element::i32, Shape{4}, {4, 3, 2, 1});
+        b->set_friendly_name("b");
+        auto subtract = make_shared<ov::opset11::Subtract>(a, b);
+        subtract->set_friendly_name("subtract");
+
+        // the data path is not folded
+        auto param = make_shared<ov::opset11::Parameter>(element::i32, Shape{4});
+        auto relu = make_shared<ov::opset11::Relu>(make_shared<ov::opset11::Add>(param, subtract));
+        return make_shared<ov::Model>(OutputVector{add, relu}, ParameterVector{param});
+    };
+
+    auto sequential = make_model();
+    run_constant_folding(sequential);
+
+    auto parallel = make_model();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<ov::pass::InitNodeInfo>();
+    pass_manager.register_pass<ov::pass::ConstantFolding>(true);
+    pass_manager.run_passes(parallel);
+
+    ASSERT_EQ(count_ops_of_type<ov::opset11::Convert>(parallel), 0);
+    ASSERT_EQ(count_ops_of_type<ov::opset11::Multiply>(parallel), 0);
+    ASSERT_EQ(count_ops_of_type<ov::opset11::Subtract>(parallel), 0);
+    ASSERT_EQ(count_ops_of_type<ov::opset11::Add>(parallel), 1);
+    ASSERT_EQ(count_ops_of_type<ov::opset11::Relu>(parallel), 1);
+
+    auto new_const = get_result_constant(parallel);
+    ASSERT_TRUE(new_const);
+    check_names(new_const, {"weights", "convert", "scales", "multiply", "shifts", "test"});
+    ASSERT_EQ(get_result_constant(sequential)->get_vector<float>(), new_const->get_vector<float>());
+
+    auto relu = parallel->get_results().at(1)->get_input_node_shared_ptr(0);
+    auto relu_input = relu->get_input_node_shared_ptr(0);
+    auto folded_subtract = ov::as_type_ptr<ov::opset11::Constant>(relu_input->get_input_node_shared_ptr(1));
+    ASSERT_TRUE(folded_subtract);
+    check_names(folded_subtract, {"a", "b", "subtract"}, "subtract");
+    ASSERT_EQ((vector<int>{-3, -1, 1, 3}), folded_subtract->cast_vector<int>());
+}
@@ -8,6 +8,7 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 
 NGRAPH_SUPPRESS_DEPRECATED_START
 
@@ -442,3 +443,198 @@ TEST(GraphRewriteTest, nodes_use_count) {
     m.register_pass<CheckConsumers>();
     ASSERT_NO_THROW(m.run_passes(f));
 }
+
+namespace {
+std::shared_ptr<Function> get_relu_chain(size_t length, NodeVector& relus) {
+    auto data = std::make_shared<opset3::Parameter>(element::f32, Shape{3, 1, 2});
+    Output<Node> last = data;
+    for (size_t i = 0; i < length; ++i) {
+        relus.push_back(std::make_shared<opset3::Relu>(last));
+        last = relus.back();
+    }
+    return std::make_shared<Function>(OutputVector{last}, ParameterVector{data});
+}
+}  // namespace
+
+class ReplaceWithAbs : public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    ReplaceWithAbs(std::shared_ptr<Node>& node, std::shared_ptr<Node>& abs, NodeVector& order)
+        : m_node(node),
+          m_abs(abs),
+          m_order(order) {}
+
+    bool run_on_model(const std::shared_ptr<ov::Model>&) override {
+        m_abs = std::make_shared<opset3::Abs>(m_node->input_value(0));
+        replace_node(m_node, m_abs);
+        // the replaced node is released to check that it is not visited
+        m_node.reset();
+        m_order.clear();
+        return true;
+    }
+
+private:
+    std::shared_ptr<Node>& m_node;
+    std::shared_ptr<Node>& m_abs;
+    NodeVector& m_order;
+};
+
+NGRAPH_RTTI_DEFINITION(ReplaceWithAbs, "ReplaceWithAbs");
+
+TEST(GraphRewriteTest, IncrementalRunVisitsChangedNodes) {
+    NodeVector relus;
+    auto f = get_relu_chain(20, relus);
+    const auto ops_num = f->get_ops().size();
+
+    NodeVector order;
+    std::shared_ptr<Node> abs;
+    pass::Manager m;
+    m.set_incremental_rewrite(true);
+    auto first = m.register_pass<pass::GraphRewrite>();
+    first->add_matcher<GatherNodesPass>(order);
+    m.register_pass<ReplaceWithAbs>(relus[9], abs, order);
+    // the same matcher in another GraphRewrite continues from the previous run
+    auto second = m.register_pass<pass::GraphRewrite>();
+    second->add_matcher<GatherNodesPass>(order);
+    auto third = m.register_pass<pass::GraphRewrite>();
+    third->add_matcher<GatherNodesPass>(order);
+    m.run_passes(f);
+
+    // only the producer, the replacement and the consumer of the replaced node are visited
+    ASSERT_EQ(order, (NodeVector{relus[8], abs, relus[10]}));
+    ASSERT_EQ(first->get_statistics().visited_nodes, ops_num);
+    ASSERT_EQ(second->get_statistics().visited_nodes, 3);
+    ASSERT_EQ(third->get_statistics().visited_nodes, 0);
+
+    // the changes are not tracked after the manager, so the next one visits all the nodes
+    order.clear();
+    pass::Manager next;
+    next.set_incremental_rewrite(true);
+    next.register_pass<pass::GraphRewrite>()->add_matcher<GatherNodesPass>(order);
+    next.run_passes(f);
+    ASSERT_EQ(order, f->get_ordered_ops());
+
+    // out of a manager every run visits all the nodes
+    order.clear();
+    pass::GraphRewrite anchor;
+    anchor.add_matcher<GatherNodesPass>(order);
+    anchor.set_incremental(true);
+    anchor.run_on_model(f);
+    anchor.run_on_model(f);
+    ASSERT_EQ(anchor.get_statistics().visited_nodes, 2 * ops_num);
+}
+
+class EliminateDoubleNegative : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    EliminateDoubleNegative() : MatcherPass() {
+        auto negative = pattern::wrap_type<opset3::Negative>({pattern::wrap_type<opset3::Negative>()});
+        auto add = pattern::wrap_type<opset3::Add>({negative, pattern::any_input()});
+        auto relu = pattern::wrap_type<opset3::Relu>({add});
+        ngraph::matcher_pass_callback callback = [=](pattern::Matcher& m) {
+            const auto& pattern_map = m.get_pattern_value_map();
+            const auto& add_node = pattern_map.at(add).get_node_shared_ptr();
+            auto data = pattern_map.at(negative).get_node()->get_input_node_ptr(0)->input_value(0);
+            auto new_add = std::make_shared<opset3::Add>(data, add_node->input_value(1));
+            ngraph::replace_node(m.get_match_root(), std::make_shared<opset3::Relu>(new_add));
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(relu, "EliminateDoubleNegative");
+        this->register_matcher(m, callback);
+    }
+};
+
+NGRAPH_RTTI_DEFINITION(EliminateDoubleNegative, "EliminateDoubleNegative");
+
+class AbsToNegative : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    AbsToNegative() : MatcherPass() {
+        auto abs = pattern::wrap_type<opset3::Abs>();
+        ngraph::matcher_pass_callback callback = [](pattern::Matcher& m) {
+            auto abs = m.get_match_root();
+            ngraph::replace_node(abs, std::make_shared<opset3::Negative>(abs->input_value(0)));
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(abs, "AbsToNegative");
+        this->register_matcher(m, callback);
+    }
+};
+
+NGRAPH_RTTI_DEFINITION(AbsToNegative, "AbsToNegative");
+
+TEST(GraphRewriteTest, IncrementalRunVisitsConsumersUpToPatternDepth) {
+    const auto run = [](bool incremental) {
+        // the Relu matched after the replacement of Abs is three levels below it, the logged consumer of Abs is
+        // one level below
+        auto data = std::make_shared<opset3::Parameter>(element::f32, Shape{3, 1, 2});
+        auto negative = std::make_shared<opset3::Negative>(std::make_shared<opset3::Abs>(data));
+        auto add = std::make_shared<opset3::Add>(negative, data);
+        NodeVector relus;
+        Output<Node> last = std::make_shared<opset3::Relu>(add);
+        for (size_t i = 0; i < 20; ++i) {
+            relus.push_back(std::make_shared<opset3::Relu>(last));
+            last = relus.back();
+        }
+        auto f = std::make_shared<Function>(OutputVector{last}, ParameterVector{data});
+
+        pass::Manager m;
+        m.set_incremental_rewrite(incremental);
+        m.register_pass<EliminateDoubleNegative>();
+        m.register_pass<AbsToNegative>();
+        m.register_pass<EliminateDoubleNegative>();
+        m.run_passes(f);
+        return f;
+    };
+    const auto incremental = run(true);
+    ASSERT_EQ(count_ops_of_type<opset3::Negative>(incremental), 0);
+    ASSERT_EQ(count_ops_of_type<opset3::Add>(incremental), 1);
+    const auto res = FunctionsComparator::with_default().compare(incremental, run(false));
+    ASSERT_TRUE(res.valid) << res.message;
+}
+
+class DivideToConvertF16 : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    DivideToConvertF16() : MatcherPass() {
+        auto divide = pattern::wrap_type<opset3::Divide>();
+        ngraph::matcher_pass_callback callback = [](pattern::Matcher& m) {
+            auto divide = m.get_match_root();
+            auto convert = std::make_shared<opset3::Convert>(divide->input_value(0), element::f16);
+            ngraph::replace_node(divide, convert);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(divide, "DivideToConvertF16");
+        this->register_matcher(m, callback);
+    }
+};
+
+NGRAPH_RTTI_DEFINITION(DivideToConvertF16, "DivideToConvertF16");
+
+TEST(GraphRewriteTest, IncrementalRunRevalidatesConsumers) {
+    auto data = std::make_shared<opset3::Parameter>(element::f32, Shape{3, 1, 2});
+    auto divide_constant = opset3::Constant::create(element::f32, Shape{1}, {1.5});
+    auto divide = std::make_shared<opset3::Divide>(data, divide_constant);
+    auto relu = std::make_shared<opset3::Relu>(std::make_shared<opset3::Relu>(divide));
+    auto other = std::make_shared<opset3::Relu>(data);
+    auto f = std::make_shared<Function>(NodeVector{relu, other}, ParameterVector{data});
+    divide.reset();
+
+    pass::Manager m;
+    m.set_per_pass_validation(false);
+    m.set_incremental_rewrite(true);
+    auto anchor = m.register_pass<pass::GraphRewrite>();
+    anchor->add_matcher<DivideToConvertF16>();
+    m.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Convert>(f), 1);
+    ASSERT_EQ(f->get_output_element_type(0), element::f16);
+    ASSERT_EQ(f->get_output_element_type(1), element::f32);
+    const auto& statistics = anchor->get_statistics();
+    ASSERT_EQ(statistics.rewrites, 1);
+    // the Parameter, the Constant which lost a consumer, the Convert, both Relu and the Result
+    ASSERT_EQ(statistics.revalidated_nodes, 6);
+}
@@ -0,0 +1,140 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Micro-benchmark of the data movement and conversion reference kernels used by the constant folding and the
+// reference evaluation. Every kernel is compared with the scalar implementation it replaces.
+//
+// Usage: ov_core_reference_benchmark [repetitions]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/convert.hpp"
+#include "ngraph/runtime/reference/tile.hpp"
+#include "ngraph/runtime/reference/transpose.hpp"
+#include "ngraph/shape_util.hpp"
+
+using namespace ngraph;
+
+namespace {
+size_t repetitions = 10;
+
+double best_time_ms(const std::function<void()>& kernel) {
+    double best = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < repetitions; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        kernel();
+        const auto end = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    return best;
+}
+
+void report(const std::string& name, const std::function<void()>& scalar, const std::function<void()>& fast) {
+    const auto scalar_ms = best_time_ms(scalar);
+    const auto fast_ms = best_time_ms(fast);
+    std::cout << std::left << std::setw(48) << name << std::right << std::fixed << std::setprecision(3)
+              << std::setw(12) << scalar_ms << std::setw(12) << fast_ms << std::setw(10) << std::setprecision(2)
+              << scalar_ms / fast_ms << "x" << std::endl;
+}
+
+void transpose_case(const Shape& shape, const std::vector<int64_t>& order, size_t elem_size) {
+    const auto size = shape_size(shape) * elem_size;
+    std::vector<char> in(size), out(size);
+    std::iota(in.begin(), in.end(), 0);
+    Shape out_shape(shape.size());
+    for (size_t i = 0; i < order.size(); ++i)
+        out_shape[i] = shape[order[i]];
+    const AxisVector axis_order(order.begin(), order.end());
+
+    std::ostringstream name;
+    name << "transpose " << shape << " " << axis_order << " x" << elem_size << "B";
+    report(
+        name.str(),
+        [&]() {
+            runtime::opt_kernel::reshape(in.data(), out.data(), shape, axis_order, out_shape, elem_size);
+        },
+        [&]() {
+            runtime::reference::transpose(in.data(), out.data(), shape, elem_size, order.data(), out_shape);
+        });
+}
+
+void broadcast_case(const Shape& in_shape, const Shape& out_shape, size_t elem_size) {
+    std::vector<char> in(shape_size(in_shape) * elem_size), out(shape_size(out_shape) * elem_size);
+    std::iota(in.begin(), in.end(), 0);
+    std::vector<int64_t> repeats(out_shape.size());
+    for (size_t i = 0; i < repeats.size(); ++i)
+        repeats[i] = out_shape[i] / in_shape[i];
+
+    std::ostringstream name;
+    name << "broadcast " << in_shape << " -> " << out_shape << " x" << elem_size << "B";
+    report(
+        name.str(),
+        [&]() {
+            runtime::reference::tile(in.data(), out.data(), in_shape, out_shape, elem_size, repeats);
+        },
+        [&]() {
+            runtime::reference::broadcast(in.data(), out.data(), in_shape, out_shape, AxisSet{}, elem_size);
+        });
+}
+
+template <typename TI, typename TO>
+void convert_case(const std::string& name, size_t count) {
+    std::vector<TI> in(count);
+    for (size_t i = 0; i < count; ++i)
+        in[i] = static_cast<TI>(static_cast<float>(i % 251) - 125.f);
+    std::vector<TO> out(count);
+    report(
+        name + " " + std::to_string(count),
+        [&]() {
+            for (size_t i = 0; i < count; ++i)
+                out[i] = static_cast<TO>(in[i]);
+        },
+        [&]() {
+            runtime::reference::convert(in.data(), out.data(), count);
+        });
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc > 1)
+        repetitions = std::max(1, std::atoi(argv[1]));
+
+    std::cout << std::left << std::setw(48) << "kernel" << std::right << std::setw(12) << "scalar, ms" << std::setw(12)
+              << "fast, ms" << std::setw(11) << "speedup" << std::endl;
+
+    for (const size_t elem_size : {1, 2, 4}) {
+        transpose_case(Shape{1024, 1024}, {1, 0}, elem_size);
+        transpose_case(Shape{16, 256, 512}, {0, 2, 1}, elem_size);
+        transpose_case(Shape{8, 64, 56, 56}, {0, 2, 3, 1}, elem_size);
+        transpose_case(Shape{8, 56, 56, 64}, {0, 3, 1, 2}, elem_size);
+        transpose_case(Shape{8, 16, 128, 64}, {0, 2, 1, 3}, elem_size);
+    }
+
+    for (const size_t elem_size : {1, 2, 4}) {
+        broadcast_case(Shape{1, 4096}, Shape{1024, 4096}, elem_size);
+        broadcast_case(Shape{4096, 1}, Shape{4096, 1024}, elem_size);
+        broadcast_case(Shape{1, 64, 1, 1}, Shape{8, 64, 56, 56}, elem_size);
+    }
+
+    const size_t count = 16 * 1024 * 1024;
+    convert_case<float16, float>("convert f16 -> f32", count);
+    convert_case<float, float16>("convert f32 -> f16", count);
+    convert_case<bfloat16, float>("convert bf16 -> f32", count);
+    convert_case<float, bfloat16>("convert f32 -> bf16", count);
+    convert_case<uint8_t, float16>("convert u8 -> f16", count);
+    convert_case<float, int8_t>("convert f32 -> i8", count);
+    return 0;
+}
@@ -0,0 +1,135 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/convert.hpp"
+#include "ngraph/runtime/reference/transpose.hpp"
+#include "ngraph/shape.hpp"
+
+using namespace ngraph;
+
+namespace {
+std::vector<char> make_data(size_t size) {
+    std::vector<char> data(size);
+    for (size_t i = 0; i < size; ++i)
+        data[i] = static_cast<char>(i * 7 + i / 251);
+    return data;
+}
+
+// element by element, the output coordinates are mapped to the input ones
+std::vector<char> transpose_by_elements(const std::vector<char>& in,
+                                        const Shape& shape,
+                                        const std::vector<int64_t>& order,
+                                        size_t elem_size) {
+    const auto in_strides = row_major_strides(shape);
+    Shape out_shape(shape.size());
+    for (size_t i = 0; i < order.size(); ++i)
+        out_shape[i] = shape[order[i]];
+    std::vector<char> out(in.size());
+    for (size_t out_idx = 0; out_idx < shape_size(out_shape); ++out_idx) {
+        size_t in_idx = 0;
+        for (size_t i = out_shape.size(), rest = out_idx; i-- > 0;) {
+            in_idx += rest % out_shape[i] * in_strides[order[i]];
+            rest /= out_shape[i];
+        }
+        std::copy_n(in.begin() + in_idx * elem_size, elem_size, out.begin() + out_idx * elem_size);
+    }
+    return out;
+}
+
+std::vector<char> broadcast_by_elements(const std::vector<char>& in,
+                                        const Shape& in_shape,
+                                        const Shape& out_shape,
+                                        size_t elem_size) {
+    Shape shape(out_shape.size() - in_shape.size(), 1);
+    shape.insert(shape.end(), in_shape.begin(), in_shape.end());
+    const auto in_strides = row_major_strides(shape);
+    std::vector<char> out(shape_size(out_shape) * elem_size);
+    for (size_t out_idx = 0; out_idx < shape_size(out_shape); ++out_idx) {
+        size_t in_idx = 0;
+        for (size_t i = out_shape.size(), rest = out_idx; i-- > 0;) {
+            if (shape[i] != 1)
+                in_idx += rest % out_shape[i] * in_strides[i];
+            rest /= out_shape[i];
+        }
+        std::copy_n(in.begin() + in_idx * elem_size, elem_size, out.begin() + out_idx * elem_size);
+    }
+    return out;
+}
+}  // namespace
+
+TEST(reference_kernels, transpose) {
+    const std::vector<std::pair<Shape, std::vector<int64_t>>> cases{
+        {{1024, 96}, {1, 0}},
+        {{3, 5, 7}, {2, 0, 1}},
+        {{2, 1, 33, 17}, {0, 3, 1, 2}},
+        {{4, 64, 28, 28}, {0, 2, 3, 1}},
+        {{4, 28, 28, 64}, {0, 3, 1, 2}},
+        {{2, 16, 32, 40}, {0, 2, 1, 3}},
+        {{5, 3, 1, 2, 7, 3}, {5, 4, 3, 2, 1, 0}},
+        {{6, 5, 4}, {0, 1, 2}},
+    };
+    for (const size_t elem_size : {1, 2, 3, 4, 8}) {
+        for (const auto& test_case : cases) {
+            const auto& shape = test_case.first;
+            const auto& order = test_case.second;
+            const auto in = make_data(shape_size(shape) * elem_size);
+            Shape out_shape(shape.size());
+            for (size_t i = 0; i < order.size(); ++i)
+                out_shape[i] = shape[order[i]];
+            std::vector<char> out(in.size());
+            runtime::reference::transpose(in.data(), out.data(), shape, elem_size, order.data(), out_shape);
+            EXPECT_EQ(transpose_by_elements(in, shape, order, elem_size), out)
+                << "shape " << shape << ", element size " << elem_size;
+        }
+    }
+}
+
+TEST(reference_kernels, broadcast) {
+    const std::vector<std::pair<Shape, Shape>> cases{
+        {{1, 4096}, {256, 4096}},
+        {{4096, 1}, {4096, 48}},
+        {{1, 64, 1, 1}, {4, 64, 28, 28}},
+        {{3, 1, 5}, {2, 3, 7, 5}},
+        {{1}, {17, 3}},
+        {{2, 3}, {2, 3}},
+    };
+    for (const size_t elem_size : {1, 2, 3, 4, 8}) {
+        for (const auto& test_case : cases) {
+            const auto& in_shape = test_case.first;
+            const auto& out_shape = test_case.second;
+            AxisSet axes;
+            for (size_t i = 0; i < out_shape.size() - in_shape.size(); ++i)
+                axes.insert(i);
+            const auto in = make_data(shape_size(in_shape) * elem_size);
+            std::vector<char> out(shape_size(out_shape) * elem_size);
+            runtime::reference::broadcast(in.data(), out.data(), in_shape, out_shape, axes, elem_size);
+            EXPECT_EQ(broadcast_by_elements(in, in_shape, out_shape, elem_size), out)
+                << in_shape << " -> " << out_shape << ", element size " << elem_size;
+        }
+    }
+}
+
+TEST(reference_kernels, convert_bf16) {
+    std::vector<float> values(100000);
+    for (size_t i = 0; i < values.size(); ++i)
+        values[i] = (static_cast<float>(i) - 50000.f) * 1.2345e-3f;
+    values[0] = std::numeric_limits<float>::infinity();
+    values[1] = -std::numeric_limits<float>::max();
+
+    std::vector<bfloat16> bf16(values.size());
+    runtime::reference::convert(values.data(), bf16.data(), values.size());
+    std::vector<float> f32(values.size());
+    runtime::reference::convert(bf16.data(), f32.data(), values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(bfloat16(values[i]).to_bits(), bf16[i].to_bits()) << values[i];
+        ASSERT_EQ(static_cast<float>(bf16[i]), f32[i]) << values[i];
+    }
+}
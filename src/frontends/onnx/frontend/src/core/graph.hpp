@@ -16,6 +16,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "onnx_import/core/operator_set.hpp"
 #include "openvino/frontend/extension/holder.hpp"
+#include "utils/tensor_external_data.hpp"
 
 namespace ngraph {
 namespace onnx_import {
@@ -23,6 +24,7 @@ class Graph : public std::enable_shared_from_this<Graph> {
 public:
     Graph(const std::string& model_dir,
           const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto,
+          const bool enable_mmap,
           ov::frontend::ExtensionHolder extensions = {});
     Graph() = delete;
 
@@ -40,6 +42,9 @@ public:
     const std::string& model_dir() const {
         return m_model_dir;
     }
+    const detail::MappedMemoryHandles& get_mmap_cache() const {
+        return m_mmap_cache;
+    }
     const ParameterVector& get_ng_parameters() const {
         return m_parameters;
     }
@@ -57,6 +62,7 @@ protected:
     Graph(const std::string& model_dir,
           const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model,
           std::unique_ptr<GraphCache>&& cache,
+          detail::MappedMemoryHandles mmap_cache,
           ov::frontend::ExtensionHolder extensions = {});
 
     void set_friendly_names(const Node& onnx_node, const OutputVector& ng_subgraph_outputs) const;
@@ -77,6 +83,7 @@ protected:
 private:
     std::vector<Node> m_nodes;
     std::string m_model_dir;
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 /// \brief      Representation of ONNX subgraph. It is used for example by ONNX Loop op.
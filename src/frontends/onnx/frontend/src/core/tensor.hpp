@@ -108,10 +108,13 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor, const std::string& model_dir)
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                    const std::string& model_dir,
+                    detail::MappedMemoryHandles mmap_cache = {})
         : m_tensor_proto{&tensor},
           m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
-          m_model_dir{model_dir} {
+          m_model_dir{model_dir},
+          m_mmap_cache{std::move(mmap_cache)} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a Shape{0} stored in m_shape.
@@ -197,6 +200,11 @@ public:
         if (m_tensor_proto->has_segment()) {
             throw error::tensor::segments_unsupported{};
         }
+        if (has_external_data() && m_mmap_cache) {
+            if (auto constant = make_mapped_ng_constant()) {
+                return constant;
+            }
+        }
         switch (m_tensor_proto->data_type()) {
         case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_BOOL:
             return make_ng_constant<char>(element::boolean);
@@ -230,6 +238,31 @@ public:
     }
 
 private:
+    /// \brief Creates a constant which shares the memory of the mapped external data file,
+    ///        the external data layout is the same as the raw data one for every element type.
+    ///        Returns nullptr if the file can't be mapped, so the data is read instead.
+    std::shared_ptr<ngraph::op::Constant> make_mapped_ng_constant() const {
+        const auto& type = get_ng_type();
+        std::shared_ptr<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>> buffer;
+        try {
+            buffer = detail::TensorExternalData(*m_tensor_proto).load_external_mmap_data(m_model_dir, m_mmap_cache);
+        } catch (const error::invalid_external_data&) {
+            throw;
+        } catch (const std::runtime_error&) {
+            return nullptr;
+        }
+        if (buffer->size() != type.size() * shape_size(m_shape)) {
+            throw error::invalid_external_data(
+                "The size of the external data file does not match the byte size of an initializer '" + get_name() +
+                "' in the model");
+        }
+        auto constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+        if (m_tensor_proto->has_name()) {
+            constant->set_friendly_name(get_name());
+        }
+        return constant;
+    }
+
     template <typename T,
               typename std::enable_if<std::is_same<T, float>::value || std::is_same<T, double>::value ||
                                           std::is_same<T, int32_t>::value || std::is_same<T, int64_t>::value ||
@@ -339,6 +372,7 @@ private:
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
     Shape m_shape;
     std::string m_model_dir;
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
@@ -89,11 +89,13 @@ void convert_decoded_function(std::shared_ptr<Function> function) {
 
 std::shared_ptr<Function> import_onnx_model(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto,
                                             const std::string& model_path,
+                                            const bool enable_mmap,
                                             ov::frontend::ExtensionHolder extensions) {
     apply_transformations(*model_proto);
     NGRAPH_SUPPRESS_DEPRECATED_START
     Graph graph{file_util::get_directory(ov::util::get_absolute_file_path(model_path)),
                 model_proto,
+                enable_mmap,
                 std::move(extensions)};
     NGRAPH_SUPPRESS_DEPRECATED_END
     return graph.convert();
@@ -101,11 +103,13 @@ std::shared_ptr<Function> import_onnx_model(std::shared_ptr<ONNX_NAMESPACE::Mode
 
 std::shared_ptr<Function> decode_to_framework_nodes(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto,
                                                     const std::string& model_path,
+                                                    const bool enable_mmap,
                                                     ov::frontend::ExtensionHolder extensions) {
     apply_transformations(*model_proto);
     NGRAPH_SUPPRESS_DEPRECATED_START
     auto graph = std::make_shared<Graph>(file_util::get_directory(ov::util::get_absolute_file_path(model_path)),
                                          model_proto,
+                                         enable_mmap,
                                          extensions);
     NGRAPH_SUPPRESS_DEPRECATED_END
     return graph->decode();
@@ -6,9 +6,19 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+/// \brief Memory mappings of the external data files, every file is mapped once and shared by all its tensors
+using MappedMemoryHandles = std::shared_ptr<std::map<std::string, std::shared_ptr<ov::MappedMemory>>>;
+
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -23,6 +33,19 @@ public:
     /// \return     External binary data loaded into a std::string
     std::string load_external_data(const std::string& model_dir) const;
 
+    /// \brief      Map external data from tensor passed to constructor
+    ///
+    /// \note       The file is mapped into memory only once, the mapping is stored
+    ///             in the cache and reused by other tensors located in the same file.
+    ///             If the tensor doesn't fit into the file, the invalid_external_data
+    ///             exception is thrown. If the file can't be mapped, std::runtime_error is thrown.
+    ///
+    /// \return     Buffer which points to the tensor data in the mapped file,
+    ///             it keeps the mapping alive as long as the buffer exists
+    std::shared_ptr<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>> load_external_mmap_data(
+        const std::string& model_dir,
+        MappedMemoryHandles cache) const;
+
     /// \brief      Represets parameter of external data as string
     ///
     /// \return     State of TensorExternalData as string representation
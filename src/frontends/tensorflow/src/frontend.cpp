@@ -153,6 +153,8 @@ ov::frontend::InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& va
 
     // Last boolean flag in `variants` (if presented) is reserved for FE configuration
     size_t extra_variants_num = variants.size() > 0 && variants[variants.size() - 1].is<bool>() ? 1 : 0;
+    // For the SavedModel and MetaGraph formats the flag enables memory mapping of the variables data files
+    const bool mmap_enabled = extra_variants_num == 1 && variants[variants.size() - 1].as<bool>();
     FRONT_END_GENERAL_CHECK(variants.size() == 1 + extra_variants_num,
                             "[TensorFlow Frontend] Internal error or inconsistent input model: the frontend supports "
                             "frozen formats (.pb and .pbtxt), SavedModel and MetaGraph (.meta) formats.");
@@ -165,9 +167,12 @@ ov::frontend::InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& va
         } else if (GraphIteratorSavedModel::is_supported(model_path)) {
             std::shared_ptr<GraphIteratorSavedModel> graph_iterator;
             if (variants.size() > 1 && variants[1].is<std::string>()) {
-                graph_iterator = std::make_shared<GraphIteratorSavedModel>(model_path, variants[1].as<std::string>());
+                graph_iterator = std::make_shared<GraphIteratorSavedModel>(model_path,
+                                                                           variants[1].as<std::string>(),
+                                                                           mmap_enabled);
             } else {
-                graph_iterator = std::make_shared<GraphIteratorSavedModel>(model_path, std::string("serve"));
+                graph_iterator =
+                    std::make_shared<GraphIteratorSavedModel>(model_path, std::string("serve"), mmap_enabled);
             }
             return std::make_shared<InputModel>(graph_iterator,
                                                 m_telemetry,
@@ -176,7 +181,7 @@ ov::frontend::InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& va
                                                 graph_iterator->get_saved_model_output_names(),
                                                 true);
         } else if (GraphIteratorMeta::is_supported(model_path)) {
-            auto graph_iterator = std::make_shared<GraphIteratorMeta>(model_path);
+            auto graph_iterator = std::make_shared<GraphIteratorMeta>(model_path, mmap_enabled);
             return std::make_shared<InputModel>(graph_iterator,
                                                 m_telemetry,
                                                 graph_iterator->get_variables_index(),
@@ -199,9 +204,11 @@ ov::frontend::InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& va
             if (variants.size() > 1 && variants[1].is<std::string>()) {
                 graph_iterator = std::make_shared<GraphIteratorSavedModel>(
                     model_path,
-                    ov::util::wstring_to_string(variants[1].as<std::wstring>()));
+                    ov::util::wstring_to_string(variants[1].as<std::wstring>()),
+                    mmap_enabled);
             } else {
-                graph_iterator = std::make_shared<GraphIteratorSavedModel>(model_path, std::string("serve"));
+                graph_iterator =
+                    std::make_shared<GraphIteratorSavedModel>(model_path, std::string("serve"), mmap_enabled);
             }
             return std::make_shared<InputModel>(graph_iterator,
                                                 m_telemetry,
@@ -210,7 +217,7 @@ ov::frontend::InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& va
                                                 graph_iterator->get_saved_model_output_names(),
                                                 true);
         } else if (GraphIteratorMeta::is_supported(model_path)) {
-            auto graph_iterator = std::make_shared<GraphIteratorMeta>(model_path);
+            auto graph_iterator = std::make_shared<GraphIteratorMeta>(model_path, mmap_enabled);
             return std::make_shared<InputModel>(graph_iterator,
                                                 m_telemetry,
                                                 graph_iterator->get_variables_index(),
@@ -7,6 +7,7 @@
 #include "helper_ops/string_constant.hpp"
 #include "helper_ops/unsupported_constant.hpp"
 #include "input_model.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/opsets/opset8.hpp"
 #include "tensor_bundle.pb.h"
 
@@ -31,10 +32,28 @@ static std::shared_ptr<ov::Node> read_variable(std::shared_ptr<VariablesIndex> v
     for (uint64_t i = 0; i < shape.size(); ++i) {
         size *= static_cast<google::protobuf::int64>(shape[i]);
     }
-    var_data.resize(size);
     TENSORFLOW_OP_VALIDATION(node,
                              size == static_cast<google::protobuf::int64>(entry.size() / sizeof(T)),
                              "[TensorFlow Frontend] Internal error: Available data size isn't equal to calculated.");
+    if (var_index->is_mmap_enabled()) {
+        if (size == 0) {
+            return std::make_shared<Constant>(ov_type, shape, var_data);
+        }
+        // The constant shares the mapped shard, pages are read on the first access to the data
+        auto mapped_memory = var_index->get_data_mmap(entry.shard_id());
+        TENSORFLOW_OP_VALIDATION(node,
+                                 mapped_memory.get(),
+                                 "[TensorFlow Frontend] Internal error: Cannot get shard file.");
+        TENSORFLOW_OP_VALIDATION(node,
+                                 static_cast<uint64_t>(entry.offset()) + entry.size() <= mapped_memory->size(),
+                                 "[TensorFlow Frontend] Internal error: Variable data is out of the shard file.");
+        auto shared_buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+            mapped_memory->data() + entry.offset(),
+            entry.size(),
+            mapped_memory);
+        return std::make_shared<Constant>(ov_type, shape, shared_buffer);
+    }
+    var_data.resize(size);
     auto fs = var_index->get_data_file(entry.shard_id());
     if (!fs.get()) {
         TENSORFLOW_OP_VALIDATION(node, var_index, "[TensorFlow Frontend] Internal error: Cannot get shard file.");
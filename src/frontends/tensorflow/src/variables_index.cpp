@@ -223,25 +223,34 @@ void VariablesIndex::read_checkpointable_object_graph() {
 
     FRONT_END_GENERAL_CHECK(entry.slices().empty(), "CMO: Slices are not supported");
 
-    auto shard = m_data_files.find(entry.shard_id());
-    FRONT_END_GENERAL_CHECK(shard != m_data_files.end(), "CMO: data files isn't found");
-
-    std::vector<char> data(entry.size());
     ::tensorflow::TrackableObjectGraph tog;
 
     // TODO: have to understand this offset
     // It looks like reinterpret_cast artifact
     // https://github.com/tensorflow/tensorflow/blob/d90f1947ebcf510b23c238f43c2191e5b3817cb3/tensorflow/cc/experimental/libexport/load.cc#L70
     int chg = 6;
-    shard->second->seekg(entry.offset() + chg);
-    shard->second->read(data.data(), entry.size() - chg);
 
     // Might be need to remove this verification:
     // https://github.com/tensorflow/tensorflow/blob/d90f1947ebcf510b23c238f43c2191e5b3817cb3/tensorflow/cc/experimental/libexport/load.cc#L73
     // FRONT_END_GENERAL_CHECK(tog.ParseFromArray(data.data(), static_cast<int>(data.size()) - chg), "CMO: Trackable
     // Object Graph couldn't be read");
 
-    tog.ParseFromArray(data.data(), static_cast<int>(data.size()) - chg);
+    if (m_mmap_enabled) {
+        auto shard = m_data_files_mmap.find(entry.shard_id());
+        FRONT_END_GENERAL_CHECK(shard != m_data_files_mmap.end(), "CMO: data files isn't found");
+        FRONT_END_GENERAL_CHECK(static_cast<uint64_t>(entry.offset() + entry.size()) <= shard->second->size(),
+                                "CMO: data is out of the data file");
+        tog.ParseFromArray(shard->second->data() + entry.offset() + chg, static_cast<int>(entry.size()) - chg);
+    } else {
+        auto shard = m_data_files.find(entry.shard_id());
+        FRONT_END_GENERAL_CHECK(shard != m_data_files.end(), "CMO: data files isn't found");
+
+        std::vector<char> data(entry.size());
+        shard->second->seekg(entry.offset() + chg);
+        shard->second->read(data.data(), entry.size() - chg);
+
+        tog.ParseFromArray(data.data(), static_cast<int>(data.size()) - chg);
+    }
 
     for (const auto& node : tog.nodes()) {
         for (const auto& attr : node.attributes()) {
@@ -250,6 +259,17 @@ void VariablesIndex::read_checkpointable_object_graph() {
     }
 }
 
+template <typename T>
+static std::shared_ptr<ov::MappedMemory> load_data_file_mmap(const std::basic_string<T>& path) {
+    std::shared_ptr<ov::MappedMemory> mapped_memory;
+    try {
+        mapped_memory = ov::load_mmap_object(path);
+    } catch (const std::exception& ex) {
+        FRONT_END_THROW(std::string("Variable index data file cannot be mapped: ") + ex.what());
+    }
+    return mapped_memory;
+}
+
 bool VariablesIndex::read_variables(std::ifstream& vi_stream, const std::string& path, const bool is_saved_model) {
     m_variables_index.clear();
     read_variables_index(vi_stream, m_variables_index);
@@ -264,9 +284,13 @@ bool VariablesIndex::read_variables(std::ifstream& vi_stream, const std::string&
         } else {
             fullPath = path + "." + suffix.data();
         }
-        m_data_files[shard] = std::shared_ptr<std::ifstream>(
-            new std::ifstream(fullPath.c_str(), std::ifstream::in | std::ifstream::binary));
-        FRONT_END_GENERAL_CHECK(m_data_files[shard]->is_open(), "Variable index data file does not exist");
+        if (m_mmap_enabled) {
+            m_data_files_mmap[shard] = load_data_file_mmap(fullPath);
+        } else {
+            m_data_files[shard] = std::shared_ptr<std::ifstream>(
+                new std::ifstream(fullPath.c_str(), std::ifstream::in | std::ifstream::binary));
+            FRONT_END_GENERAL_CHECK(m_data_files[shard]->is_open(), "Variable index data file does not exist");
+        }
     }
 
     read_checkpointable_object_graph();
@@ -288,9 +312,13 @@ bool VariablesIndex::read_variables(std::ifstream& vi_stream, const std::wstring
         } else {
             fullPath = path + L"." + suffix.data();
         }
-        m_data_files[shard] = std::shared_ptr<std::ifstream>(
-            new std::ifstream(fullPath.c_str(), std::ifstream::in | std::ifstream::binary));
-        FRONT_END_GENERAL_CHECK(m_data_files[shard]->is_open(), "Variable index data file does not exist");
+        if (m_mmap_enabled) {
+            m_data_files_mmap[shard] = load_data_file_mmap(fullPath);
+        } else {
+            m_data_files[shard] = std::shared_ptr<std::ifstream>(
+                new std::ifstream(fullPath.c_str(), std::ifstream::in | std::ifstream::binary));
+            FRONT_END_GENERAL_CHECK(m_data_files[shard]->is_open(), "Variable index data file does not exist");
+        }
     }
 
     read_checkpointable_object_graph();
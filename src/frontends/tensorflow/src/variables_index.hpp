@@ -8,6 +8,7 @@
 
 #include "graph_iterator_proto.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "saved_model.pb.h"
 
 namespace ov {
@@ -22,14 +23,22 @@ class VariablesIndex {
     size_t m_variables_index_size;
     // Contains maximum amount of shards, used for creating corrext extension
     int32_t m_total_shards;
+    // Flag shows data files are mapped into memory instead of opening as streams
+    bool m_mmap_enabled;
     // Contains BundleEntryProto variables list, readed from .index file
     std::map<std::string, std::vector<char>> m_variables_index;
     // List of opened data files for using with BundleEntryProto
     std::map<int32_t, std::shared_ptr<std::ifstream>> m_data_files;
+    // List of memory mapped data files for using with BundleEntryProto, filled in case of enabled mmap
+    std::map<int32_t, std::shared_ptr<ov::MappedMemory>> m_data_files_mmap;
     // List of mapped variables which could be read using TrackableObjectGraph
     std::map<std::string, std::string> m_variables_map;
 
 public:
+    /// \brief Creates an empty variables index
+    /// \param mmap_enabled Data files will be mapped into memory instead of reading by streams
+    explicit VariablesIndex(const bool mmap_enabled = false) : m_mmap_enabled(mmap_enabled) {}
+
     /// \brief Reads variables from opened variable index file. Can cause an asserts in case of issues.
     /// \param vi_stream Opened stream file, file pointer doesn't matter, it will be rewind internally.
     /// \param path A path to file with variables data
@@ -93,6 +102,19 @@ public:
         return result != m_data_files.end() ? result->second : nullptr;
     }
 
+    /// \brief Returns true if data files are mapped into memory, they are accessible by get_data_mmap only
+    bool is_mmap_enabled() const {
+        return m_mmap_enabled;
+    }
+
+    /// \brief Returns shared pointer to a memory mapped shard_id, or nullptr in case of shard_id isn't found
+    /// \param shard_id Requested shard_id
+    /// \returns Valid shared_ptr with MappedMemory or with nullptr if shard isn't found
+    std::shared_ptr<ov::MappedMemory> get_data_mmap(const int32_t shard_id) const {
+        auto result = m_data_files_mmap.find(shard_id);
+        return result != m_data_files_mmap.end() ? result->second : nullptr;
+    }
+
     /// \brief Adds variable mapping to the variables map
     /// \param var_name Variable full name (from .index file)
     /// \param map_name Mapped name
@@ -2,12 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <openvino/frontend/manager.hpp>
 #include <openvino/opsets/opset10.hpp>
 
 #include "conversion_with_reference.hpp"
 #include "gtest/gtest.h"
 #include "test_common.hpp"
 #include "tf_utils.hpp"
+#include "utils.hpp"
 
 using namespace std;
 using namespace ov;
@@ -52,6 +54,28 @@ TEST_F(FrontEndConversionWithReferenceTestsF, SavedModelVariables) {
     }
 }
 
+TEST_F(FrontEndConversionWithReferenceTestsF, SavedModelVariablesMmap) {
+    {
+        // the last flag enables memory mapping of the variables data files
+        ov::frontend::FrontEndManager fem;
+        auto front_end = fem.load_by_framework(TF_FE);
+        ASSERT_NE(front_end, nullptr);
+        auto model_filename =
+            FrontEndTestUtils::make_model_path(string(TEST_TENSORFLOW_MODELS_DIRNAME) + "saved_model_variables");
+        auto input_model = front_end->load(model_filename, true);
+        ASSERT_NE(input_model, nullptr);
+        model = front_end->convert(input_model);
+    }
+    {
+        // create a reference graph
+        auto x = make_shared<Parameter>(element::f32, Shape{1});
+        auto y = make_shared<Constant>(element::f32, Shape{}, vector<float>{123});
+        auto multiply = make_shared<Multiply>(x, y);
+
+        model_ref = make_shared<Model>(OutputVector{multiply}, ParameterVector{x});
+    }
+}
+
 TEST_F(FrontEndConversionWithReferenceTestsF, SavedModelWithInputIntegerType) {
     {
         model = convert_model("saved_model_with_gather",
@@ -88,6 +88,127 @@ DECLARE_CONFIG_KEY(SMALL_CORE_OFFSET);
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Enables sharing of the CPU runtime parameters cache between all the streams and compiled models of the process,
+ * so the primitives are created once for the same shapes. Only the stateless oneDNN primitives are shared, the
+ * executors keeping a state between the calls stay in the cache of the stream. The capacity of the shared cache is
+ * defined by the first compiled model which creates it.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_SHARING);
+
+/**
+ * @brief Defines how many shape buckets the CPU plugin keeps precomputed memory plans for while executing models with
+ * dynamic shapes. Each bucket is described by the observed max shapes of the model inputs. Zero disables the feature.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_SHAPE_BUCKETS);
+
+/**
+ * @brief Allows the CPU plugin to consume model constants directly from the model weights buffer (e.g. the mmapped IR
+ * weights file) and to skip the weights reordering when the plain layout is already expected by the primitive.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_ZERO_COPY);
+
+/**
+ * @brief Path to a directory where the CPU plugin stores the reordered weights. The files are named by the hash of the
+ * source weights and the target layout and are mapped into memory by the subsequent model compilations.
+ * An empty value disables the feature.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_CACHE_DIR);
+
+/**
+ * @brief Defines how many elements along the dynamic axis the CPU plugin reserves up front for the state of a growing
+ * variable (a variable with one dynamic dimension, e.g. a history concatenated step by step). The state is kept in a
+ * single buffer which preserves its content while growing, and the Concat appending to the state writes only the new
+ * slice. Zero disables the feature.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_STATE_RESERVE);
+
+/**
+ * @brief Defines how many nodes ahead of the executed one the CPU plugin prepares the primitives of a dynamic graph on
+ * a helper thread, so the primitive creation on a shape change overlaps with the execution. Zero disables the
+ * feature and all the primitives of a graph segment are prepared before its execution.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PREPARE_LOOKAHEAD);
+
+/**
+ * @brief Enables the always-on latency histograms in the CPU plugin. Every executed node records its execution time
+ * measured by the time stamp counter into a lock-free log-bucketed histogram. The p50, p99 and max latencies of the
+ * nodes are reported by the ov::intel_cpu::latency_percentiles compiled model property. Unlike PERF_COUNT, the feature
+ * doesn't allocate during the inference.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_LATENCY_HISTOGRAMS);
+
+/**
+ * @brief Defines how many independent branches of a static graph the CPU plugin may execute concurrently. The graph is
+ * split into stages of independent branches, the branches of a stage are distributed over the lanes which run in
+ * their own task arenas sharing the threads of the stream. Zero and one disable the feature.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_INTER_OP_PARALLELISM);
+
+/**
+ * @brief Enables the shared memory mode of the If node in the CPU plugin. The body inputs and outputs are bound to the
+ * memory of the If node instead of copying the data, and on an input shape change the primitives of the branch which
+ * is not taken are prepared as well, so the alternating branches don't pay for the primitive creation.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_IF_SHARED_MEMORY);
+
+/**
+ * @brief Enables the threshold select mode of the TopK node in the CPU plugin for the long sorting axes and the large K.
+ * The threshold is found by the radix histograms of the values, and only the elements which pass it are sorted.
+ * The mode is disabled by default.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_TOPK_RADIX_SELECT);
+
+/**
+ * @brief Path prefix of the inference traces of the CPU plugin. The sampled inferences are written in the Chrome trace
+ * event format to "<prefix><sequence number>.json": the input push, the execution of every node with its thread, the
+ * touched bytes and the formats of the inserted reorders, and the output pull. The trace metadata report the time spent
+ * in every category and the critical path of the nodes. The tracing is disabled if the prefix is empty (default).
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_INFERENCE_TRACE);
+
+/**
+ * @brief Sampling period of the CPU inference traces: the first inference of every graph and then every N-th one are
+ * traced. Defaults to 100.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_INFERENCE_TRACE_PERIOD);
+
+/**
+ * @brief Enables the parallel constant folding in the transformation pipeline of the CPU plugin: the independent nodes
+ * of the constant sub-graphs are folded concurrently and the large elementwise folds are split between the threads.
+ * Disabled by default.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PARALLEL_CONSTANT_FOLDING);
+
+/**
+ * @brief Enables the incremental graph rewrites in the transformation pipeline of the CPU plugin: the matcher passes
+ * which run again within the pre- or post-LPT pipeline (including the nested pipelines like CommonOptimizations) visit
+ * only the nodes changed since their previous run and the model is revalidated from the changed nodes only. Disabled
+ * by default.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_INCREMENTAL_GRAPH_REWRITE);
+
+/**
+ * @brief Enables the Snippets tokenization of the elementwise subgraphs with dynamic shapes in the CPU plugin. Such
+ * subgraphs are executed by the shape-agnostic kernels. Enabled by default.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SNIPPETS_DYNAMIC_SHAPES);
+
 /**
  * @brief Internal device id for particular device (like GPU.0, GPU.1 etc)
  */
@@ -98,6 +219,12 @@ DECLARE_CONFIG_KEY(CONFIG_DEVICE_ID);
  */
 DECLARE_CONFIG_KEY(ENABLE_HYPER_THREAD);
 
+/**
+ * @brief Enables per stream lock-free task queues with work stealing in the CPU streams executor
+ * instead of the single task queue guarded by a mutex. Idle streams spin for a while before parking.
+ */
+DECLARE_CONFIG_KEY(CPU_TASK_STEALING);
+
 /**
  * @brief Defines Snippets tokenization mode
  *      @param ENABLE - default pipeline
@@ -26,4 +26,34 @@ static constexpr Property<std::vector<PropertyName>, PropertyMutability::RO> cac
  */
 static constexpr Property<bool, PropertyMutability::RW> exclusive_async_requests{"EXCLUSIVE_ASYNC_REQUESTS"};
 
+/**
+ * @brief The p99 latency target (in ms) for the requests executed via the auto-batching. When set, the timeout to
+ * collect the batch is chosen adaptively from the observed requests arrival rate and the execution latency instead of
+ * the fixed ov::auto_batch_timeout. Zero disables the adaptive timeout.
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_latency_target{"AUTO_BATCH_LATENCY_TARGET"};
+
+/**
+ * @brief Read-only property to get the timeout (in ms) to collect the batch currently used by the auto-batching
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<uint32_t, PropertyMutability::RO> auto_batch_current_timeout{"AUTO_BATCH_CURRENT_TIMEOUT"};
+
+/**
+ * @brief Read-only property to get the average ratio of the requests collected to the batch size for the batches
+ * dispatched by the auto-batching
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<float, PropertyMutability::RO> auto_batch_fill_ratio{"AUTO_BATCH_FILL_RATIO"};
+
+/**
+ * @brief Allows the auto-batching to compile the model for the power-of-two batch sizes below the batch size of the
+ * device as well, so the partially collected batch is executed with the smallest compiled batch that fits it rather
+ * than request by request once the timeout is over. The batches above the largest power of two are executed with the
+ * padded full batch
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> auto_batch_partial_batches{"AUTO_BATCH_PARTIAL_BATCHES"};
+
 }  // namespace ov
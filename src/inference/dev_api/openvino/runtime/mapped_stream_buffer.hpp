@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief File provides a stream buffer over a memory mapped file
+ * @file openvino/runtime/mapped_stream_buffer.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <streambuf>
+
+#include "openvino/util/mmap_object.hpp"
+
+namespace ov {
+
+/**
+ * @brief Read only stream buffer over a memory mapped file.
+ * Stream positions are the offsets in the mapped memory, so the stream consumers (e.g. the plugins importing a
+ * compiled model) can detect the buffer with dynamic_cast on std::istream::rdbuf() and use the mapped data directly
+ * instead of reading a copy of it.
+ */
+class MappedStreamBuffer : public std::streambuf {
+public:
+    explicit MappedStreamBuffer(std::shared_ptr<ov::MappedMemory> memory) : m_memory(std::move(memory)) {
+        if (m_memory->size() > 0) {
+            char* begin = m_memory->data();
+            setg(begin, begin, begin + m_memory->size());
+        }
+    }
+
+    /**
+     * @brief Returns the mapped memory, the memory stays valid as long as the returned object is alive
+     */
+    const std::shared_ptr<ov::MappedMemory>& get_memory() const noexcept {
+        return m_memory;
+    }
+
+protected:
+    pos_type seekoff(off_type off,
+                     std::ios_base::seekdir dir,
+                     std::ios_base::openmode which = std::ios_base::in) override {
+        if (!(which & std::ios_base::in)) {
+            return pos_type(off_type(-1));
+        }
+        off_type pos = off;
+        if (dir == std::ios_base::cur) {
+            pos += gptr() - eback();
+        } else if (dir == std::ios_base::end) {
+            pos += egptr() - eback();
+        }
+        if (pos < 0 || pos > egptr() - eback()) {
+            return pos_type(off_type(-1));
+        }
+        setg(eback(), eback() + pos, egptr());
+        return pos_type(pos);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+
+private:
+    std::shared_ptr<ov::MappedMemory> m_memory;
+};
+
+}  // namespace ov
@@ -101,6 +101,7 @@ public:
         int _threads_per_stream_small = 0;  //!< Threads per stream in small cores
         int _small_core_offset = 0;         //!< Calculate small core start offset when binding cpu cores
         bool _enable_hyper_thread = true;   //!< enable hyper thread
+        bool _task_stealing = false;        //!< per stream lock-free task queues with work stealing
         int _plugin_task = NOT_USED;
         std::vector<std::vector<int>> _orig_proc_type_table;
         std::vector<std::vector<int>> _proc_type_table;
@@ -63,5 +63,34 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
  */
 static constexpr Property<float> sparse_weights_decompression_rate{"CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
 
+/**
+ * @brief Read-only property to get the lookup statistics of the runtime primitives cache used by a compiled model
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The statistics contain the "HITS", "MISSES", "EVICTIONS" and "SIZE" counters. If the cache is shared between the
+ * compiled models, the counters are process-wide.
+ *
+ * @code
+ * auto stats = compiled_model.get_property(ov::intel_cpu::runtime_cache_statistics);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Read-only property to get the latency percentiles of the nodes of a compiled model
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The percentiles are collected when the compiled model is created with the CPU_LATENCY_HISTOGRAMS internal key. For
+ * every executed node, the property contains the "P50", "P99" and "MAX" latencies in microseconds, aggregated over
+ * the streams.
+ *
+ * @code
+ * auto latencies = compiled_model.get_property(ov::intel_cpu::latency_percentiles);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, std::map<std::string, double>>, PropertyMutability::RO>
+    latency_percentiles{"CPU_LATENCY_PERCENTILES"};
+
 }  // namespace intel_cpu
 }  // namespace ov
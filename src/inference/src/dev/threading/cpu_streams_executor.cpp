@@ -4,6 +4,7 @@
 
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 
+#include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -23,6 +24,100 @@ using namespace InferenceEngine;
 
 namespace ov {
 namespace threading {
+namespace {
+// task stealing mode: capacity of a stream queue and the number of attempts an idle stream makes before parking
+constexpr size_t stealing_queue_capacity = 1024;
+constexpr int stealing_spin_count = 64;
+
+/**
+ * @brief Bounded multi-producer multi-consumer lock-free queue (D. Vyukov's algorithm).
+ * Each cell carries a sequence number which tells whether the cell is ready to be written or read on the current lap,
+ * so producers and consumers synchronize on the cells and the positions only.
+ */
+class LockFreeTaskQueue {
+public:
+    explicit LockFreeTaskQueue(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) {
+            size *= 2;
+        }
+        _mask = size - 1;
+        _cells.reset(new Cell[size]);
+        for (size_t i = 0; i < size; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool try_push(Task& task) {
+        Cell* cell = nullptr;
+        auto pos = _enqueue._value.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto seq = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueue._value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // the queue is full
+                return false;
+            } else {
+                pos = _enqueue._value.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_task = std::move(task);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_pop(Task& task) {
+        Cell* cell = nullptr;
+        auto pos = _dequeue._value.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto seq = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeue._value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // the queue is empty
+                return false;
+            } else {
+                pos = _dequeue._value.load(std::memory_order_relaxed);
+            }
+        }
+        task = std::move(cell->_task);
+        cell->_task = nullptr;
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const {
+        return _dequeue._value.load(std::memory_order_acquire) == _enqueue._value.load(std::memory_order_acquire);
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> _sequence{0};
+        Task _task;
+    };
+
+    // the positions are placed to different cache lines to avoid false sharing between producers and consumers
+    struct PaddedPosition {
+        std::atomic<size_t> _value{0};
+        char _padding[64 - sizeof(std::atomic<size_t>)];
+    };
+
+    PaddedPosition _enqueue;
+    PaddedPosition _dequeue;
+    std::unique_ptr<Cell[]> _cells;
+    size_t _mask = 0;
+};
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO
@@ -357,9 +452,18 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        if (_config._task_stealing) {
+            for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+                _stealingQueues.emplace_back(new LockFreeTaskQueue(stealing_queue_capacity));
+            }
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+                if (_config._task_stealing) {
+                    StealingLoop(streamId);
+                    return;
+                }
                 for (bool stopped = false; !stopped;) {
                     Task task;
                     {
@@ -381,6 +485,10 @@ struct CPUStreamsExecutor::Impl {
     }
 
     void Enqueue(Task task) {
+        if (_config._task_stealing) {
+            EnqueueStealing(std::move(task));
+            return;
+        }
         {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
@@ -388,6 +496,79 @@ struct CPUStreamsExecutor::Impl {
         _queueCondVar.notify_one();
     }
 
+    void EnqueueStealing(Task task) {
+        // the tasks are spread over the stream queues in the round-robin fashion, the idle streams steal the rest
+        const auto first = _nextQueue.fetch_add(1, std::memory_order_relaxed);
+        bool pushed = false;
+        for (size_t i = 0; i < _stealingQueues.size() && !pushed; ++i) {
+            pushed = _stealingQueues[(first + i) % _stealingQueues.size()]->try_push(task);
+        }
+        if (!pushed) {
+            // all the queues are full, the overflow queue keeps the executor unbounded
+            std::lock_guard<std::mutex> lock(_mutex);
+            _taskQueue.emplace(std::move(task));
+        }
+        // pairs with the fence in StealingLoop: either the parking stream sees the task or the task sees the sleeper
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_sleepers.load(std::memory_order_relaxed) > 0) {
+            // the lock guarantees the sleeper is either waiting already or is going to re-check the queues
+            { std::lock_guard<std::mutex> lock(_mutex); }
+            _queueCondVar.notify_one();
+        }
+    }
+
+    bool TrySteal(int streamId, Task& task) {
+        const auto queuesNum = _stealingQueues.size();
+        for (size_t i = 0; i < queuesNum; ++i) {
+            if (_stealingQueues[(streamId + i) % queuesNum]->try_pop(task)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool HasStealingTasks() const {
+        for (const auto& queue : _stealingQueues) {
+            if (!queue->empty()) {
+                return true;
+            }
+        }
+        return !_taskQueue.empty();
+    }
+
+    void StealingLoop(int streamId) {
+        for (;;) {
+            Task task;
+            // own queue first, then the queues of the other streams
+            bool found = TrySteal(streamId, task);
+            for (int spin = 0; !found && spin < stealing_spin_count; ++spin) {
+                std::this_thread::yield();
+                found = TrySteal(streamId, task);
+            }
+            if (!found) {
+                std::unique_lock<std::mutex> lock(_mutex);
+                if (!_taskQueue.empty()) {
+                    task = std::move(_taskQueue.front());
+                    _taskQueue.pop();
+                    found = true;
+                } else {
+                    _sleepers.fetch_add(1, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    _queueCondVar.wait(lock, [&] {
+                        return HasStealingTasks() || _isStopped;
+                    });
+                    _sleepers.fetch_sub(1, std::memory_order_relaxed);
+                    if (_isStopped && !HasStealingTasks()) {
+                        return;
+                    }
+                }
+            }
+            if (found) {
+                Execute(task, *(_streams.local()));
+            }
+        }
+    }
+
     void Execute(const Task& task, Stream& stream) {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO
         auto& arena = stream._taskArena;
@@ -427,6 +608,9 @@ struct CPUStreamsExecutor::Impl {
     std::condition_variable _queueCondVar;
     std::queue<Task> _taskQueue;
     bool _isStopped = false;
+    std::vector<std::unique_ptr<LockFreeTaskQueue>> _stealingQueues;
+    std::atomic<size_t> _nextQueue{0};
+    std::atomic<int> _sleepers{0};
     std::vector<int> _usedNumaNodes;
     ov::threading::ThreadLocal<std::shared_ptr<Stream>> _streams;
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
@@ -214,6 +214,15 @@ void IStreamsExecutor::Config::set_property(const ov::AnyMap& property) {
             } else {
                 OPENVINO_THROW("Unsupported enable hyper thread type");
             }
+        } else if (key == CONFIG_KEY_INTERNAL(CPU_TASK_STEALING)) {
+            if (value.as<std::string>() == CONFIG_VALUE(YES)) {
+                _task_stealing = true;
+            } else if (value.as<std::string>() == CONFIG_VALUE(NO)) {
+                _task_stealing = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_TASK_STEALING)
+                           << ". Expected only YES/NO";
+            }
         } else {
             IE_THROW() << "Wrong value for property key " << key;
         }
@@ -233,6 +242,7 @@ ov::Any IStreamsExecutor::Config::get_property(const std::string& key) const {
             CONFIG_KEY_INTERNAL(THREADS_PER_STREAM_SMALL),
             CONFIG_KEY_INTERNAL(SMALL_CORE_OFFSET),
             CONFIG_KEY_INTERNAL(ENABLE_HYPER_THREAD),
+            CONFIG_KEY_INTERNAL(CPU_TASK_STEALING),
             ov::num_streams.name(),
             ov::inference_num_threads.name(),
             ov::affinity.name(),
@@ -282,6 +292,8 @@ ov::Any IStreamsExecutor::Config::get_property(const std::string& key) const {
         return {std::to_string(_small_core_offset)};
     } else if (key == CONFIG_KEY_INTERNAL(ENABLE_HYPER_THREAD)) {
         return {_enable_hyper_thread ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_TASK_STEALING)) {
+        return {_task_stealing ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
     } else {
         OPENVINO_THROW("Wrong value for property key ", key);
     }
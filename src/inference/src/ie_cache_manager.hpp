@@ -12,10 +12,12 @@
 #include <fstream>
 #include <functional>
 #include <memory>
+#include <random>
 #include <string>
 
 #include "file_utils.h"
 #include "ie_api.h"
+#include "openvino/runtime/mapped_stream_buffer.hpp"
 
 namespace ov {
 
@@ -76,6 +78,8 @@ public:
  * @brief File storage-based Implementation of ICacheManager
  *
  * Uses simple file for read/write cached models.
+ * The files are memory mapped for reading, so the plugins are able to use the blob data without copying
+ * (see ov::MappedStreamBuffer).
  *
  */
 class FileStorageCacheManager final : public ICacheManager {
@@ -100,15 +104,48 @@ public:
 
 private:
     void write_cache_entry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
+        // The blob may be mapped by the models imported before (possibly by other processes), so it's never
+        // rewritten in place. The new content is written to a temporary file which then replaces the blob.
+        // The temporary file name is unique, so the concurrent writers of the same entry don't mix their content.
+        auto blobFileName = getBlobFile(id);
+        std::random_device rd;
+        auto tmpFileName = blobFileName + "." + std::to_string(rd()) + ".tmp";
+        // removes the temporary file left by the failed write or rename, the file doesn't exist after the
+        // successful rename
+        struct TmpFileGuard {
+            const std::string& fileName;
+            ~TmpFileGuard() {
+                std::remove(fileName.c_str());
+            }
+        } tmpFileGuard{tmpFileName};
+        {
+            std::ofstream stream(tmpFileName, std::ios_base::binary | std::ofstream::out);
+            writer(stream);
+        }
+        if (std::rename(tmpFileName.c_str(), blobFileName.c_str()) != 0) {
+            // rename does not replace an existing file on Windows
+            std::remove(blobFileName.c_str());
+            std::rename(tmpFileName.c_str(), blobFileName.c_str());
+        }
     }
 
     void read_cache_entry(const std::string& id, StreamReader reader) override {
         auto blobFileName = getBlobFile(id);
         if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
+            std::shared_ptr<ov::MappedMemory> memory;
+            try {
+                memory = ov::load_mmap_object(blobFileName);
+            } catch (const std::runtime_error&) {
+                // fallback to the regular reading, e.g. for the file systems which do not support mapping
+            }
+            if (memory) {
+                ov::MappedStreamBuffer buffer(memory);
+                std::istream stream(&buffer);
+                reader(stream);
+            } else {
+                std::ifstream stream(blobFileName, std::ios_base::binary);
+                reader(stream);
+            }
         }
     }
 
@@ -5,8 +5,12 @@
 #include <gtest/gtest.h>
 #include <ie_system_conf.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <future>
 #include <ie_parallel.hpp>
+#include <iostream>
 #include <thread>
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <threading/ie_immediate_executor.hpp>
@@ -216,6 +220,16 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
 
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
+static IStreamsExecutor::Config makeStealingConfig(int streams) {
+    auto threads = parallel_get_max_threads();
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                    streams,
+                                    threads / streams,
+                                    IStreamsExecutor::ThreadBindingType::NONE};
+    config.SetConfig(CONFIG_KEY_INTERNAL(CPU_TASK_STEALING), CONFIG_VALUE(YES));
+    return config;
+}
+
 static auto Executors = ::testing::Values(
     [] {
         auto streams = getNumberOfCPUCores();
@@ -244,6 +258,9 @@ static auto Executors = ::testing::Values(
                                      threads / streams,
                                      IStreamsExecutor::ThreadBindingType::NONE});
     },
+    [] {
+        return std::make_shared<CPUStreamsExecutor>(makeStealingConfig(getNumberOfCPUCores()));
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
     });
@@ -277,6 +294,66 @@ static auto AsyncExecutors = ::testing::Values(
                                      streams,
                                      threads / streams,
                                      IStreamsExecutor::ThreadBindingType::NONE});
+    },
+    [] {
+        return std::make_shared<CPUStreamsExecutor>(makeStealingConfig(getNumberOfCPUCores()));
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
+
+TEST_F(StreamsExecutorConfigTest, canSetTaskStealing) {
+    IStreamsExecutor::Config config;
+    EXPECT_EQ(CONFIG_VALUE(NO), config.GetConfig(CONFIG_KEY_INTERNAL(CPU_TASK_STEALING)).as<std::string>());
+    config.SetConfig(CONFIG_KEY_INTERNAL(CPU_TASK_STEALING), CONFIG_VALUE(YES));
+    EXPECT_TRUE(config._task_stealing);
+    EXPECT_THROW(config.SetConfig(CONFIG_KEY_INTERNAL(CPU_TASK_STEALING), "ON"), InferenceEngine::Exception);
+}
+
+// Microbenchmark of the task submission latency (from run() call to the task start) of the default and the task
+// stealing queues, run it with --gtest_also_run_disabled_tests
+class StreamsExecutorLatencyBenchmark : public ::testing::TestWithParam<bool> {};
+
+TEST_P(StreamsExecutorLatencyBenchmark, DISABLED_submissionLatency) {
+    const auto streams = getNumberOfCPUCores();
+    auto config = makeStealingConfig(streams);
+    config._task_stealing = GetParam();
+    auto executor = std::make_shared<CPUStreamsExecutor>(config);
+
+    using clock = std::chrono::steady_clock;
+    constexpr int producers = 8;
+    constexpr int tasksPerProducer = 20000;
+    std::vector<std::vector<int64_t>> latencies(producers);
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            auto& producerLatencies = latencies[p];
+            producerLatencies.resize(tasksPerProducer);
+            std::vector<Future> futures;
+            futures.reserve(tasksPerProducer);
+            for (int i = 0; i < tasksPerProducer; ++i) {
+                const auto submitted = clock::now();
+                futures.emplace_back(async(executor, [&producerLatencies, i, submitted] {
+                    producerLatencies[i] =
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - submitted).count();
+                }));
+            }
+            for (auto& f : futures)
+                f.wait();
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    std::vector<int64_t> all;
+    for (const auto& producerLatencies : latencies)
+        all.insert(all.end(), producerLatencies.begin(), producerLatencies.end());
+    std::sort(all.begin(), all.end());
+    auto percentile = [&](double p) {
+        return all[static_cast<size_t>(p * (all.size() - 1))];
+    };
+    std::cout << (GetParam() ? "task stealing" : "default") << " queue, latency ns: p50 " << percentile(0.5)
+              << ", p99 " << percentile(0.99) << ", p99.9 " << percentile(0.999) << ", max " << all.back()
+              << std::endl;
+}
+
+INSTANTIATE_TEST_SUITE_P(StreamsExecutorLatencyBenchmark, StreamsExecutorLatencyBenchmark, ::testing::Bool());
@@ -0,0 +1,158 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdio>
+#include <istream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common_test_utils/file_utils.hpp"
+#include "ie_cache_manager.hpp"
+
+class FileStorageCacheManagerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        CommonTestUtils::createDirectory(cacheDir);
+        cacheManager = std::make_shared<ov::FileStorageCacheManager>(cacheDir);
+    }
+
+    void TearDown() override {
+        cacheManager.reset();
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeFilesWithExt(cacheDir, "tmp");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
+    void write(const std::string& id, const std::string& content) {
+        cacheManager->write_cache_entry(id, [&](std::ostream& stream) {
+            stream << content;
+        });
+    }
+
+    const std::string cacheDir = "file_storage_cache_manager_test";
+    std::shared_ptr<ov::ICacheManager> cacheManager;
+};
+
+TEST_F(FileStorageCacheManagerTest, readsMappedEntry) {
+    const std::string content = "0123456789abcdef";
+    write("entry", content);
+
+    bool isRead = false;
+    cacheManager->read_cache_entry("entry", [&](std::istream& stream) {
+        isRead = true;
+        // the plugins detect the mapped entry by the stream buffer
+        auto buffer = dynamic_cast<ov::MappedStreamBuffer*>(stream.rdbuf());
+        ASSERT_NE(nullptr, buffer);
+        ASSERT_EQ(content.size(), buffer->get_memory()->size());
+        EXPECT_EQ(content, std::string(buffer->get_memory()->data(), buffer->get_memory()->size()));
+
+        std::string actual;
+        stream >> actual;
+        EXPECT_EQ(content, actual);
+    });
+    EXPECT_TRUE(isRead);
+}
+
+TEST_F(FileStorageCacheManagerTest, missingEntryIsNotRead) {
+    bool isRead = false;
+    cacheManager->read_cache_entry("missing", [&](std::istream&) {
+        isRead = true;
+    });
+    EXPECT_FALSE(isRead);
+}
+
+// a mapped file can't be replaced on Windows, the entry is kept then
+#ifndef _WIN32
+TEST_F(FileStorageCacheManagerTest, mappedEntryIsNotChangedByRewrite) {
+    write("entry", std::string(4096, 'a'));
+
+    cacheManager->read_cache_entry("entry", [&](std::istream& stream) {
+        auto buffer = dynamic_cast<ov::MappedStreamBuffer*>(stream.rdbuf());
+        ASSERT_NE(nullptr, buffer);
+        auto memory = buffer->get_memory();
+
+        write("entry", std::string(4096, 'b'));
+        // the entry is replaced rather than rewritten in place, so the mapping keeps the old content
+        EXPECT_EQ(std::string(4096, 'a'), std::string(memory->data(), memory->size()));
+    });
+
+    cacheManager->read_cache_entry("entry", [&](std::istream& stream) {
+        std::string actual;
+        stream >> actual;
+        EXPECT_EQ(std::string(4096, 'b'), actual);
+    });
+}
+#endif
+
+TEST_F(FileStorageCacheManagerTest, failedWriteLeavesNoFiles) {
+    write("entry", "old");
+
+    EXPECT_THROW(cacheManager->write_cache_entry("entry",
+                                                 [](std::ostream& stream) {
+                                                     stream << "partial";
+                                                     throw std::runtime_error("export failed");
+                                                 }),
+                 std::runtime_error);
+    EXPECT_TRUE(CommonTestUtils::listFilesWithExt(cacheDir, "tmp").empty());
+
+    // the entry written before is kept
+    cacheManager->read_cache_entry("entry", [&](std::istream& stream) {
+        std::string actual;
+        stream >> actual;
+        EXPECT_EQ("old", actual);
+    });
+}
+
+TEST_F(FileStorageCacheManagerTest, concurrentWritersDoNotMixContent) {
+    constexpr size_t numWriters = 8;
+    constexpr size_t numWrites = 20;
+    constexpr size_t numChunks = 16;
+    constexpr size_t size = 1 << 16;
+    // whatever writer has replaced the entry last, it's read complete and not mixed with the other writers
+    auto isComplete = [&](std::istream& stream) {
+        std::string actual;
+        stream >> actual;
+        return actual.size() == size && actual == std::string(size, actual.front());
+    };
+    std::atomic<size_t> incomplete{0};
+    std::vector<std::thread> writers;
+    for (size_t w = 0; w < numWriters; w++) {
+        writers.emplace_back([&, w]() {
+            // every writer has its own cache manager as the separate Core instances do
+            ov::FileStorageCacheManager writerCacheManager(cacheDir);
+            ov::ICacheManager& manager = writerCacheManager;
+            const std::string chunk(size / numChunks, static_cast<char>('a' + w));
+            for (size_t i = 0; i < numWrites; i++) {
+                // the content is streamed by parts as the plugins export it
+                manager.write_cache_entry("entry", [&](std::ostream& stream) {
+                    for (size_t c = 0; c < numChunks; c++) {
+                        stream << chunk;
+                        stream.flush();
+                    }
+                });
+                manager.read_cache_entry("entry", [&](std::istream& stream) {
+                    if (!isComplete(stream))
+                        incomplete++;
+                });
+            }
+        });
+    }
+    for (auto& writer : writers)
+        writer.join();
+    EXPECT_EQ(0, incomplete.load());
+
+    bool isRead = false;
+    cacheManager->read_cache_entry("entry", [&](std::istream& stream) {
+        isRead = true;
+        EXPECT_TRUE(isComplete(stream));
+    });
+    EXPECT_TRUE(isRead);
+    EXPECT_TRUE(CommonTestUtils::listFilesWithExt(cacheDir, "tmp").empty());
+}
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/mapped_stream_buffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <istream>
+#include <string>
+
+class MappedStreamBufferTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::ofstream stream(fileName, std::ios_base::binary);
+        stream << content;
+    }
+
+    void TearDown() override {
+        std::remove(fileName.c_str());
+    }
+
+    const std::string fileName = "mapped_stream_buffer_test.bin";
+    const std::string content = "0123456789abcdef";
+};
+
+TEST_F(MappedStreamBufferTest, canReadAndSeek) {
+    ov::MappedStreamBuffer buffer(ov::load_mmap_object(fileName));
+    std::istream stream(&buffer);
+
+    std::string head(4, '\0');
+    stream.read(&head[0], head.size());
+    EXPECT_EQ("0123", head);
+    EXPECT_EQ(4, stream.tellg());
+
+    stream.seekg(10);
+    std::string tail;
+    stream >> tail;
+    EXPECT_EQ("abcdef", tail);
+    EXPECT_TRUE(stream.eof());
+
+    stream.clear();
+    stream.seekg(-2, std::ios_base::end);
+    EXPECT_EQ(14, stream.tellg());
+    EXPECT_EQ('e', stream.get());
+
+    stream.seekg(1, std::ios_base::end);
+    EXPECT_TRUE(stream.fail());
+}
+
+TEST_F(MappedStreamBufferTest, positionsAreMemoryOffsets) {
+    ov::MappedStreamBuffer buffer(ov::load_mmap_object(fileName));
+    std::istream stream(&buffer);
+
+    stream.seekg(8);
+    const auto& memory = buffer.get_memory();
+    ASSERT_EQ(content.size(), memory->size());
+    EXPECT_EQ('8', *(memory->data() + stream.tellg()));
+}
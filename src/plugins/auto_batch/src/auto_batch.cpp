@@ -20,6 +20,7 @@
 #include "ie_performance_hints.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/runtime/device_id_parser.hpp"
+#include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/intel_gpu/properties.hpp"
 #include "openvino/util/common_util.hpp"
 #include "transformations/common_optimizations/dimension_tracking.hpp"
@@ -32,6 +33,8 @@ using namespace InferenceEngine;
 std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG),
                                                  ov::device::priorities.name(),
                                                  CONFIG_KEY(AUTO_BATCH_TIMEOUT),
+                                                 ov::auto_batch_latency_target.name(),
+                                                 ov::auto_batch_partial_batches.name(),
                                                  CONFIG_KEY(CACHE_DIR)};
 
 template <Precision::ePrecision precision>
@@ -338,13 +341,37 @@ void AutoBatchInferRequest::CopyInputsIfNeeded() {
     for (const auto& it : _networkInputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(GetBlob(name), _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), true);
+        CopyBlobIfNeeded(GetBlob(name),
+                         _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name),
+                         true,
+                         _batchId,
+                         _batchSize);
+    }
+}
+
+void AutoBatchInferRequest::CopyInputsToPartialRequest(SoIInferRequestInternal& req, size_t slot, size_t batchSize) {
+    for (const auto& it : _networkInputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlobIfNeeded(GetBlob(name), req->GetBlob(name), true, slot, batchSize);
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsFromPartialRequest(SoIInferRequestInternal& req,
+                                                          size_t slot,
+                                                          size_t batchSize) {
+    for (const auto& it : _networkOutputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlobIfNeeded(req->GetBlob(name), GetBlob(name), false, slot, batchSize);
     }
 }
 
 void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
                                              InferenceEngine::Blob::Ptr dst,
-                                             bool bInput) {
+                                             bool bInput,
+                                             size_t batchId,
+                                             size_t batchSize) {
     auto bufferDst = dst->buffer();
     auto ptrDst = bufferDst.as<char*>();
     auto bufferSrc = src->cbuffer();
@@ -352,13 +379,13 @@ void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
     ptrdiff_t szDst = dst->byteSize();
     ptrdiff_t szSrc = src->byteSize();
     if (bInput) {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szDst / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szDst / batchSize : 0;
         if ((ptrDst + offset) == ptrSrc)
             return;
         else
             memcpy(ptrDst + offset, ptrSrc, szSrc);
     } else {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szSrc / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szSrc / batchSize : 0;
         if ((ptrSrc + offset) == ptrDst)
             return;
         else
@@ -370,7 +397,11 @@ void AutoBatchInferRequest::CopyOutputsIfNeeded() {
     for (const auto& it : _networkOutputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), GetBlob(name), false);
+        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name),
+                         GetBlob(name),
+                         false,
+                         _batchId,
+                         _batchSize);
     }
 }
 
@@ -392,7 +423,16 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
             workerInferRequest._tasks.push(t);
             // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
             const int sz = static_cast<int>(workerInferRequest._tasks.size());
-            if (sz == workerInferRequest._batchSize) {
+            const bool adaptive =
+                workerInferRequest._batchingStatistics && workerInferRequest._batchingStatistics->IsAdaptive();
+            if (adaptive) {
+                // the worker checks the queue under the mutex, so the notification below is not missed
+                std::lock_guard<std::mutex> lock(workerInferRequest._mutex);
+                workerInferRequest._interArrival.Arrived(std::chrono::steady_clock::now(), sz > 1);
+            }
+            // with the adaptive timeout the deadline is counted from the first request of the batch,
+            // so the worker is woken up to start counting
+            if (sz == workerInferRequest._batchSize || (adaptive && sz == 1)) {
                 workerInferRequest._cond.notify_one();
             }
         };
@@ -416,6 +456,9 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> AutoBatchAsyn
     CheckState();
     if (AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
         return _inferRequest->_myBatchedRequestWrapper._inferRequestBatched->GetPerformanceCounts();
+    else if (AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
+        return _inferRequest->_myBatchedRequestWrapper._partialRequests.at(_inferRequest->_partialBatchSize)
+            ->GetPerformanceCounts();
     else
         return _inferRequestWithoutBatch->GetPerformanceCounts();
 }
@@ -435,11 +478,13 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     const DeviceInformation& networkDevice,
     const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
     const std::set<std::string>& batchedInputs,
-    const std::set<std::string>& batchedOutputs)
+    const std::set<std::string>& batchedOutputs,
+    const std::map<int, InferenceEngine::SoExecutableNetworkInternal>& partialNetworks)
     : InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr,
                                                           std::make_shared<InferenceEngine::ImmediateExecutor>()),
       _network{networkWithBatch},
       _networkWithoutBatch{networkWithoutBatch},
+      _partialNetworks{partialNetworks},
       _config{config},
       _batchedInputs(batchedInputs),
       _batchedOutputs(batchedOutputs) {
@@ -448,6 +493,9 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     auto time_out = config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
     IE_ASSERT(time_out != config.end());
     _timeOut = ParseTimeoutValue(time_out->second.as<std::string>());
+    auto latency_target = config.find(ov::auto_batch_latency_target.name());
+    _batchingStatistics = std::make_shared<BatchingStatistics>(
+        latency_target != config.end() ? ParseLatencyTargetValue(latency_target->second.as<std::string>()) : 0);
 }
 
 AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
@@ -465,6 +513,14 @@ unsigned int AutoBatchExecutableNetwork::ParseTimeoutValue(const std::string& s)
     return val;
 }
 
+unsigned int AutoBatchExecutableNetwork::ParseLatencyTargetValue(const std::string& s) {
+    auto val = std::stoi(s);
+    if (val < 0)
+        IE_THROW(ParameterMismatch) << "Value for the " << ov::auto_batch_latency_target.name()
+                                    << " should be unsigned int";
+    return val;
+}
+
 std::shared_ptr<InferenceEngine::RemoteContext> AutoBatchExecutableNetwork::GetContext() const {
     return _networkWithoutBatch->GetContext();
 }
@@ -497,6 +553,42 @@ InferenceEngine::IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateIn
                                                    _batchedOutputs);
 }
 
+bool AutoBatchExecutableNetwork::ExecutePartialBatch(WorkerInferRequest& workerRequest, int sz) {
+    auto partial = workerRequest._partialRequests.lower_bound(sz);
+    if (partial == workerRequest._partialRequests.end())
+        return false;
+    const auto start = std::chrono::steady_clock::now();
+    const int partialBatchSize = partial->first;
+    auto& partialRequest = partial->second;
+    std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
+    std::vector<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> collected;
+    collected.reserve(sz);
+    for (int n = 0; n < sz; n++) {
+        IE_ASSERT(workerRequest._tasks.try_pop(t));
+        t.first->_inferRequest->CopyInputsToPartialRequest(partialRequest, n, partialBatchSize);
+        t.first->_inferRequest->_wasBatchedRequestUsed = AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+        t.first->_inferRequest->_partialBatchSize = partialBatchSize;
+        collected.push_back(std::move(t));
+    }
+    // the remaining slots of the partial batch are padding, their outputs are ignored
+    std::exception_ptr exceptionPtr;
+    try {
+        partialRequest->Infer();
+    } catch (...) {
+        exceptionPtr = std::current_exception();
+    }
+    workerRequest._batchingStatistics->BatchExecuted(partialBatchSize, std::chrono::steady_clock::now() - start);
+    for (int n = 0; n < sz; n++) {
+        auto& c = collected[n];
+        if (exceptionPtr)
+            c.first->_inferRequest->_exceptionPtr = exceptionPtr;
+        else
+            c.first->_inferRequest->CopyOutputsFromPartialRequest(partialRequest, n, partialBatchSize);
+        c.second();
+    }
+    return true;
+}
+
 std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecutableNetwork::GetWorkerInferRequest() {
     auto num = _numRequestsCreated++;
     std::lock_guard<std::mutex> lock(_workerRequestsMutex);
@@ -507,10 +599,17 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
         workerRequestPtr->_inferRequestBatched = {_network->CreateInferRequest(), _network._so};
         workerRequestPtr->_batchSize = _device.batchForDevice;
         workerRequestPtr->_completionTasks.resize(workerRequestPtr->_batchSize);
+        workerRequestPtr->_batchingStatistics = _batchingStatistics;
+        for (const auto& partial : _partialNetworks)
+            workerRequestPtr->_partialRequests[partial.first] = {partial.second->CreateInferRequest(),
+                                                                 partial.second._so};
         workerRequestPtr->_inferRequestBatched->SetCallback(
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exceptionPtr = exceptionPtr;
+                workerRequestPtr->_batchingStatistics->BatchExecuted(
+                    workerRequestPtr->_batchSize,
+                    std::chrono::steady_clock::now() - workerRequestPtr->_startTime);
                 IE_ASSERT(workerRequestPtr->_completionTasks.size() == (size_t)workerRequestPtr->_batchSize);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batchSize; c++) {
@@ -521,11 +620,33 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
             });
 
         workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
+            // the moment the first request of the batch was noticed (used by the adaptive timeout only)
+            bool collecting = false;
+            std::chrono::steady_clock::time_point collectingStart;
+            unsigned int adaptiveTimeOut = 0;
             while (1) {
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(_timeOut));
+                    if (!_batchingStatistics->IsAdaptive()) {
+                        status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(_timeOut));
+                    } else if (workerRequestPtr->_tasks.size()) {
+                        if (!collecting) {
+                            collecting = true;
+                            collectingStart = std::chrono::steady_clock::now();
+                        }
+                        adaptiveTimeOut = _batchingStatistics->GetTimeout(workerRequestPtr->_batchSize,
+                                                                          workerRequestPtr->_interArrival.Get());
+                        status = workerRequestPtr->_cond.wait_until(
+                            lock,
+                            collectingStart + std::chrono::milliseconds(adaptiveTimeOut));
+                    } else {
+                        // nothing to collect, the first arriving request wakes the worker up
+                        workerRequestPtr->_cond.wait_for(
+                            lock,
+                            std::chrono::milliseconds(_batchingStatistics->GetLatencyTarget()));
+                        status = std::cv_status::no_timeout;
+                    }
                 }
                 if (_terminate) {
                     break;
@@ -542,30 +663,48 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                             t.first->_inferRequest->_wasBatchedRequestUsed =
                                 AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        collecting = false;
+                        _batchingStatistics->BatchDispatched(sz, workerRequestPtr->_batchSize);
+                        workerRequestPtr->_startTime = std::chrono::steady_clock::now();
                         workerRequestPtr->_inferRequestBatched->StartAsync();
                     } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
+                        // timeout to collect the batch is over, have to execute the requests either with the
+                        // smallest compiled batch that fits them or in the batch1 mode
                         std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
-                        std::atomic<int> arrived = {0};
-                        std::promise<void> all_completed;
-                        auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
-                            IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            t.first->_inferRequestWithoutBatch->SetCallback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
-                                    if (p)
-                                        t.first->_inferRequest->_exceptionPtr = p;
-                                    t.second();
-                                    if (sz == ++arrived)
-                                        all_completed.set_value();
-                                });
-                            t.first->_inferRequest->_wasBatchedRequestUsed =
-                                AutoBatchInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
-                            t.first->_inferRequest->SetBlobsToAnotherRequest(t.first->_inferRequestWithoutBatch);
-                            t.first->_inferRequestWithoutBatch->StartAsync();
+                        if (collecting) {
+                            // the batch was not filled within the timeout, so the interval is at least that long
+                            if (adaptiveTimeOut) {
+                                const double interval = static_cast<double>(adaptiveTimeOut) / sz;
+                                std::lock_guard<std::mutex> lock(workerRequestPtr->_mutex);
+                                workerRequestPtr->_interArrival.AddInterval(interval);
+                            }
+                            collecting = false;
+                        }
+                        _batchingStatistics->BatchDispatched(sz, workerRequestPtr->_batchSize);
+                        if (sz == 1 || !ExecutePartialBatch(*workerRequestPtr, sz)) {
+                            // popping all tasks collected by the moment of the time-out and execute each with batch1
+                            const auto start = std::chrono::steady_clock::now();
+                            std::atomic<int> arrived = {0};
+                            std::promise<void> all_completed;
+                            auto all_completed_future = all_completed.get_future();
+                            for (int n = 0; n < sz; n++) {
+                                IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                                t.first->_inferRequestWithoutBatch->SetCallback(
+                                    [t, sz, &arrived, &all_completed](std::exception_ptr p) {
+                                        if (p)
+                                            t.first->_inferRequest->_exceptionPtr = p;
+                                        t.second();
+                                        if (sz == ++arrived)
+                                            all_completed.set_value();
+                                    });
+                                t.first->_inferRequest->_wasBatchedRequestUsed =
+                                    AutoBatchInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
+                                t.first->_inferRequest->SetBlobsToAnotherRequest(t.first->_inferRequestWithoutBatch);
+                                t.first->_inferRequestWithoutBatch->StartAsync();
+                            }
+                            all_completed_future.get();
+                            _batchingStatistics->BatchExecuted(1, std::chrono::steady_clock::now() - start);
                         }
-                        all_completed_future.get();
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
                 }
@@ -602,13 +741,19 @@ std::shared_ptr<ngraph::Function> AutoBatchExecutableNetwork::GetExecGraphInfo()
 }
 
 void AutoBatchExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter>& user_config) {
+    bool supported = !user_config.empty();
+    for (const auto& c : user_config)
+        supported &= c.first == CONFIG_KEY(AUTO_BATCH_TIMEOUT) || c.first == ov::auto_batch_latency_target.name();
+    if (!supported) {
+        IE_THROW() << "The only configs that can be changed on the fly for the AutoBatching are the "
+                   << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " and " << ov::auto_batch_latency_target.name();
+    }
     auto timeout = user_config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
-    if (timeout == user_config.end() || user_config.size() > 1) {
-        IE_THROW() << "The only config that can be changed on the fly for the AutoBatching the is the "
-                   << CONFIG_KEY(AUTO_BATCH_TIMEOUT);
-    } else {
+    if (timeout != user_config.end())
         _timeOut = ParseTimeoutValue(timeout->second.as<std::string>());
-    }
+    auto latency_target = user_config.find(ov::auto_batch_latency_target.name());
+    if (latency_target != user_config.end())
+        _batchingStatistics->SetLatencyTarget(ParseLatencyTargetValue(latency_target->second.as<std::string>()));
 }
 
 InferenceEngine::Parameter AutoBatchExecutableNetwork::GetConfig(const std::string& name) const {
@@ -649,12 +794,21 @@ InferenceEngine::Parameter AutoBatchExecutableNetwork::GetMetric(const std::stri
                               METRIC_KEY(SUPPORTED_METRICS),
                               METRIC_KEY(NETWORK_NAME),
                               METRIC_KEY(SUPPORTED_CONFIG_KEYS),
-                              ov::execution_devices.name()});
+                              ov::execution_devices.name(),
+                              ov::auto_batch_current_timeout.name(),
+                              ov::auto_batch_fill_ratio.name()});
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        // only timeouts can be changed on the fly
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS,
-                             {CONFIG_KEY(AUTO_BATCH_TIMEOUT)});  // only timeout can be changed on the fly
+                             {CONFIG_KEY(AUTO_BATCH_TIMEOUT), ov::auto_batch_latency_target.name()});
     } else if (name == ov::execution_devices) {
         return _networkWithoutBatch->GetMetric(name);
+    } else if (name == ov::auto_batch_current_timeout) {
+        const auto timeout = _batchingStatistics->IsAdaptive() ? _batchingStatistics->GetCurrentTimeout()
+                                                               : static_cast<unsigned int>(_timeOut);
+        return decltype(ov::auto_batch_current_timeout)::value_type{timeout};
+    } else if (name == ov::auto_batch_fill_ratio) {
+        return decltype(ov::auto_batch_fill_ratio)::value_type{_batchingStatistics->GetFillRatio()};
     } else {
         IE_THROW() << "Unsupported Network metric: " << name;
     }
@@ -747,15 +901,17 @@ void AutoBatchInferencePlugin::CheckConfig(const std::map<std::string, std::stri
             IE_THROW() << "Unsupported config key: " << name;
         if (name == CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) || name == ov::device::priorities.name()) {
             ParseBatchDevice(val);
-        } else if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT)) {
+        } else if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT) || name == ov::auto_batch_latency_target.name()) {
             try {
                 auto t = std::stoi(val);
                 if (t < 0)
                     IE_THROW(ParameterMismatch);
             } catch (const std::exception&) {
-                IE_THROW(ParameterMismatch)
-                    << " Expecting unsigned int value for " << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " got " << val;
+                IE_THROW(ParameterMismatch) << " Expecting unsigned int value for " << name << " got " << val;
             }
+        } else if (name == ov::auto_batch_partial_batches.name()) {
+            if (val != CONFIG_VALUE(YES) && val != CONFIG_VALUE(NO))
+                IE_THROW(ParameterMismatch) << " Expecting YES/NO value for " << name << " got " << val;
         }
     }
 }
@@ -773,6 +929,8 @@ IE_DEFINE_PLUGIN_CREATE_FUNCTION(AutoBatchInferencePlugin, version)
 AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
     _pluginName = "BATCH";
     _config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = "1000";  // default value, in ms
+    _config[ov::auto_batch_latency_target.name()] = "0";  // adaptive timeout is disabled by default
+    _config[ov::auto_batch_partial_batches.name()] = CONFIG_VALUE(NO);
 }
 
 InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(
@@ -944,27 +1102,51 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
             networkConfig.insert(c);
     }
 
+    // the clones share the constants of the original network, so the weights are not duplicated on the host
+    auto load_batched_network = [&](int batch) {
+        CNNNetwork reshaped(InferenceEngine::details::cloneNetwork(network));
+        ICNNNetwork::InputShapes shapes = reshaped.getInputShapes();
+        for (const auto& input : batched_inputs)
+            shapes[input][0] = batch;
+        reshaped.reshape(shapes);
+        return ctx ? core->LoadNetwork(reshaped, ctx, deviceConfigNoAutoBatch)
+                   : core->LoadNetwork(reshaped, deviceName, deviceConfigNoAutoBatch);
+    };
+
     InferenceEngine::SoExecutableNetworkInternal executableNetworkWithBatch;
     if (metaDevice.batchForDevice > 1 && batched_inputs.size()) {
         try {
-            CNNNetwork reshaped(InferenceEngine::details::cloneNetwork(network));
-            ICNNNetwork::InputShapes shapes = reshaped.getInputShapes();
-            for (const auto& input : batched_inputs)
-                shapes[input][0] = metaDevice.batchForDevice;
-            reshaped.reshape(shapes);
-            executableNetworkWithBatch = ctx ? core->LoadNetwork(reshaped, ctx, deviceConfigNoAutoBatch)
-                                             : core->LoadNetwork(reshaped, deviceName, deviceConfigNoAutoBatch);
+            executableNetworkWithBatch = load_batched_network(metaDevice.batchForDevice);
         } catch (const InferenceEngine::Exception&) {
             metaDevice.batchForDevice = 1;
         }
     }
 
+    // the ladder of the power-of-two batch sizes to execute the partially collected batches
+    std::map<int, InferenceEngine::SoExecutableNetworkInternal> partialNetworks;
+    const auto partial_batches = fullConfig.find(ov::auto_batch_partial_batches.name());
+    if (executableNetworkWithBatch && partial_batches != fullConfig.end() &&
+        partial_batches->second == CONFIG_VALUE(YES)) {
+        for (int batch = 2; batch < metaDevice.batchForDevice; batch *= 2) {
+            try {
+                partialNetworks[batch] = load_batched_network(batch);
+            } catch (const InferenceEngine::Exception&) {
+                // the larger batch sizes are not expected to be supported either
+                break;
+            }
+        }
+        // the top rung executes the batches above the largest power of two with the padded full batch, it gets the
+        // separate requests as the slots of the worker request are owned by the individual requests
+        partialNetworks[metaDevice.batchForDevice] = executableNetworkWithBatch;
+    }
+
     return std::make_shared<AutoBatchExecutableNetwork>(executableNetworkWithBatch,
                                                         executableNetworkWithoutBatch,
                                                         metaDevice,
                                                         networkConfig,
                                                         batched_inputs,
-                                                        batched_outputs);
+                                                        batched_outputs,
+                                                        partialNetworks);
 }
 
 InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadExeNetworkImpl(
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <map>
 #include <mutex>
 #include <string>
@@ -13,6 +14,7 @@
 #include <utility>
 #include <vector>
 
+#include "batching_statistics.hpp"
 #include "cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp"
 #include "cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp"
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
@@ -47,15 +49,26 @@ public:
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exceptionPtr;
+        BatchingStatistics::Ptr _batchingStatistics;
+        InterArrivalTime _interArrival;  // guarded by the _mutex
+        std::chrono::steady_clock::time_point _startTime;
+        // requests of the networks compiled for the smaller batch sizes and of the full batch network, by the batch
+        // size, to execute the partially collected batch
+        std::map<int, InferenceEngine::SoIInferRequestInternal> _partialRequests;
     };
 
+    // Executes the sz requests collected by the worker with the smallest compiled batch that fits them
+    // returns false if there is no such batch, the requests stay in the queue then
+    static bool ExecutePartialBatch(WorkerInferRequest& workerRequest, int sz);
+
     explicit AutoBatchExecutableNetwork(
         const InferenceEngine::SoExecutableNetworkInternal& networkForDevice,
         const InferenceEngine::SoExecutableNetworkInternal& networkForDeviceWithoutBatch,
         const DeviceInformation& networkDevices,
         const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
         const std::set<std::string>& batchedIntputs,
-        const std::set<std::string>& batchedOutputs);
+        const std::set<std::string>& batchedOutputs,
+        const std::map<int, InferenceEngine::SoExecutableNetworkInternal>& partialNetworks = {});
 
     void SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) override;
     InferenceEngine::Parameter GetConfig(const std::string& name) const override;
@@ -73,10 +86,12 @@ public:
 
 protected:
     static unsigned int ParseTimeoutValue(const std::string&);
+    static unsigned int ParseLatencyTargetValue(const std::string&);
     std::atomic_bool _terminate = {false};
     DeviceInformation _device;
     InferenceEngine::SoExecutableNetworkInternal _network;
     InferenceEngine::SoExecutableNetworkInternal _networkWithoutBatch;
+    std::map<int, InferenceEngine::SoExecutableNetworkInternal> _partialNetworks;  // by the batch size
 
     std::pair<WorkerInferRequest&, int> GetWorkerInferRequest();
     std::vector<WorkerInferRequest::Ptr> _workerRequests;
@@ -86,6 +101,7 @@ protected:
     bool _needPerfCounters = false;
     std::atomic_size_t _numRequestsCreated = {0};
     std::atomic_int _timeOut = {0};  // in ms
+    BatchingStatistics::Ptr _batchingStatistics;
 
     const std::set<std::string> _batchedInputs;
     const std::set<std::string> _batchedOutputs;
@@ -113,16 +129,25 @@ public:
     void SetBlobsToAnotherRequest(InferenceEngine::SoIInferRequestInternal& req);
     void CopyInputsIfNeeded();
     void CopyOutputsIfNeeded();
+    // Batch-Device impl specific: copies the data to/from the given slot of the request with a smaller batch size
+    void CopyInputsToPartialRequest(InferenceEngine::SoIInferRequestInternal& req, size_t slot, size_t batchSize);
+    void CopyOutputsFromPartialRequest(InferenceEngine::SoIInferRequestInternal& req, size_t slot, size_t batchSize);
     AutoBatchExecutableNetwork::WorkerInferRequest& _myBatchedRequestWrapper;
     std::exception_ptr _exceptionPtr;
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
+        PARTIAL_BATCH_EXECUTED,
         TIMEOUT_EXECUTED
     } _wasBatchedRequestUsed = eExecutionFlavor::NOT_EXECUTED;
+    int _partialBatchSize = 0;  // batch size of the request used for the PARTIAL_BATCH_EXECUTED
 
 protected:
-    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src, InferenceEngine::Blob::Ptr dst, bool bInput);
+    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
+                          InferenceEngine::Blob::Ptr dst,
+                          bool bInput,
+                          size_t batchId,
+                          size_t batchSize);
     void ShareBlobsWithBatchRequest(const std::set<std::string>& batchedIntputs,
                                     const std::set<std::string>& batchedOutputs);
     size_t _batchId;
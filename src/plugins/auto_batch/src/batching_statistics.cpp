@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "batching_statistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace AutoBatchPlugin {
+namespace {
+// weight of the new interval in the moving average
+constexpr double interArrivalSmoothing = 0.125;
+// number of the recent executions per batch size used to estimate the p99 latency
+constexpr size_t latencyWindowSize = 128;
+}  // namespace
+
+void InterArrivalTime::Arrived(Clock::time_point now, bool collecting) {
+    if (collecting && _hasArrival)
+        AddInterval(std::chrono::duration<double, std::milli>(now - _lastArrival).count());
+    _lastArrival = now;
+    _hasArrival = true;
+}
+
+void InterArrivalTime::AddInterval(double interval) {
+    _mean += interArrivalSmoothing * (interval - _mean);
+}
+
+void BatchingStatistics::BatchDispatched(int collected, int batchSize) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _collected += collected;
+    _capacity += batchSize;
+}
+
+void BatchingStatistics::BatchExecuted(int batchSize, Clock::duration latency) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& window = _latencies[batchSize];
+    const double ms = std::chrono::duration<double, std::milli>(latency).count();
+    if (window.samples.size() < latencyWindowSize) {
+        window.samples.push_back(ms);
+    } else {
+        window.samples[window.next] = ms;
+        window.next = (window.next + 1) % latencyWindowSize;
+    }
+}
+
+double BatchingStatistics::GetLatencyP99(int batchSize) const {
+    auto it = _latencies.find(batchSize);
+    if (it == _latencies.end() || it->second.samples.empty())
+        return 0.0;
+    auto samples = it->second.samples;
+    const auto idx = static_cast<size_t>(std::ceil(0.99 * samples.size())) - 1;
+    std::nth_element(samples.begin(), samples.begin() + idx, samples.end());
+    return samples[idx];
+}
+
+unsigned int BatchingStatistics::GetTimeout(int batchSize, double interArrival) {
+    unsigned int timeout = 0;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        // once the timeout is over the collected requests are executed without batching,
+        // so both the batched and the batch1 execution should fit the target
+        const double execution = std::max(GetLatencyP99(batchSize), GetLatencyP99(1));
+        const double budget = std::max(0.0, static_cast<double>(_latencyTarget) - execution);
+        const double fillTime = (batchSize - 1) * interArrival;
+        if (fillTime <= budget)
+            timeout = static_cast<unsigned int>(budget);
+    }
+    _currentTimeout = timeout;
+    return timeout;
+}
+
+float BatchingStatistics::GetFillRatio() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _capacity ? static_cast<float>(_collected) / _capacity : 0.f;
+}
+
+}  // namespace AutoBatchPlugin
@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#ifdef AUTOBATCH_UNITTEST
+#    define AutoBatchPlugin MockAutoBatchPlugin
+#endif
+
+namespace AutoBatchPlugin {
+
+/**
+ * @brief Moving average of the interval (in ms) between the requests collected into the same batch.
+ * Not thread-safe, the owner guards it.
+ */
+class InterArrivalTime {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // the idle time between the batches is not a property of the arrival rate, so only the requests arrived
+    // while the batch is collected (i.e. the queue was not empty) contribute the interval
+    void Arrived(Clock::time_point now, bool collecting);
+    void AddInterval(double interval);
+    double Get() const {
+        return _mean;
+    }
+
+private:
+    Clock::time_point _lastArrival;
+    bool _hasArrival = false;
+    double _mean = 0.0;
+};
+
+/**
+ * @brief Statistics of the batched execution shared by all the worker requests of the executable network.
+ * Keeps the recent execution latencies per batch size and the fill ratio of the dispatched batches, and derives the
+ * timeout to collect the batch that keeps the p99 latency of the requests within the latency target.
+ */
+class BatchingStatistics {
+public:
+    using Ptr = std::shared_ptr<BatchingStatistics>;
+    using Clock = std::chrono::steady_clock;
+
+    explicit BatchingStatistics(unsigned int latencyTarget) : _latencyTarget(latencyTarget) {}
+
+    void SetLatencyTarget(unsigned int latencyTarget) {
+        _latencyTarget = latencyTarget;
+    }
+    unsigned int GetLatencyTarget() const {
+        return _latencyTarget;
+    }
+    // zero latency target means the fixed timeout is used
+    bool IsAdaptive() const {
+        return _latencyTarget != 0;
+    }
+
+    void BatchDispatched(int collected, int batchSize);
+    void BatchExecuted(int batchSize, Clock::duration latency);
+
+    /**
+     * @brief Returns the timeout (in ms) to collect the batch of the given size, counted from the arrival of the
+     * first request. The largest timeout that still fits the latency target is chosen when the batch is expected to be
+     * filled in time, otherwise waiting only adds latency and the collected requests are flushed immediately.
+     */
+    unsigned int GetTimeout(int batchSize, double interArrival);
+    unsigned int GetCurrentTimeout() const {
+        return _currentTimeout;
+    }
+    float GetFillRatio() const;
+
+private:
+    struct LatencyWindow {
+        std::vector<double> samples;  // in ms
+        size_t next = 0;
+    };
+    double GetLatencyP99(int batchSize) const;
+
+    std::atomic_uint _latencyTarget;  // in ms
+    std::atomic_uint _currentTimeout = {0};
+    mutable std::mutex _mutex;
+    std::map<int, LatencyWindow> _latencies;
+    uint64_t _collected = 0;
+    uint64_t _capacity = 0;
+};
+
+}  // namespace AutoBatchPlugin
@@ -367,6 +367,162 @@ TEST_P(AutoBatchAsyncInferRequestTest, AutoBatchAsyncInferRequestStartAsyncTest)
         EXPECT_NO_THROW(req->Wait(InferRequest::WaitMode::RESULT_READY));
 }
 
+using AutoBatchPartialBatchTestParams = std::tuple<int,   // batch_size
+                                                   int,   // number of the collected requests
+                                                   int>;  // expected batch size of the execution
+class AutoBatchPartialBatchTest : public ::testing::TestWithParam<AutoBatchPartialBatchTestParams> {
+public:
+    std::shared_ptr<NiceMock<MockIInferRequestInternal>> mockInferRequestBatched;
+    std::shared_ptr<NiceMock<MockIInferRequestInternal>> mockInferRequestWithoutBatched;
+    std::map<int, std::shared_ptr<NiceMock<MockIInferRequestInternal>>> mockPartialRequests;
+
+    std::vector<std::shared_ptr<const ov::Node>> inputs, outputs;
+    std::set<std::string> batchedInputs, batchedOutputs;
+    std::shared_ptr<AutoBatchExecutableNetwork::WorkerInferRequest> workerRequestPtr;
+    std::vector<AutoBatchAsyncInferRequest::Ptr> autoBatchAsyncInferRequestVec;
+
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<AutoBatchPartialBatchTestParams> obj) {
+        int batch_size, collected, expected_batch_size;
+        std::tie(batch_size, collected, expected_batch_size) = obj.param;
+        return "batch_size_" + std::to_string(batch_size) + "_collected_" + std::to_string(collected);
+    }
+
+    void TearDown() override {
+        autoBatchAsyncInferRequestVec.clear();
+        workerRequestPtr.reset();
+        mockPartialRequests.clear();
+        mockInferRequestBatched = {};
+        mockInferRequestWithoutBatched = {};
+    }
+
+    void SetUp() override {
+        auto function = ngraph::builder::subgraph::makeMultiSingleConv({1, 3, 24, 24}, ngraph::element::f32);
+        for (auto& input : function->inputs())
+            inputs.emplace_back(input.get_node_shared_ptr());
+        for (auto& output : function->outputs())
+            outputs.emplace_back(output.get_node_shared_ptr());
+        for (const auto& param : function->get_parameters())
+            batchedInputs.insert(ov::op::util::get_ie_output_name(param->output(0)));
+        for (const auto& result : function->get_results()) {
+            const auto& node = result->input_value(0);
+            batchedOutputs.insert(
+                ov::op::util::get_ie_output_name(ov::Output<const ov::Node>(node.get_node(), node.get_index())));
+        }
+        mockInferRequestBatched = std::make_shared<NiceMock<MockIInferRequestInternal>>();
+        mockInferRequestWithoutBatched = std::make_shared<NiceMock<MockIInferRequestInternal>>();
+    }
+
+    // the blobs of the request are allocated for the batch size
+    void set_blobs(const std::shared_ptr<NiceMock<MockIInferRequestInternal>>& request, int batch_size) {
+        auto blobMap = std::make_shared<std::map<std::string, InferenceEngine::Blob::Ptr>>();
+        const auto make_blob = [batch_size](const std::shared_ptr<const ov::Node>& node) {
+            auto shape = node->get_shape();
+            shape[0] = batch_size;
+            InferenceEngine::TensorDesc tensorDesc = {InferenceEngine::details::convertPrecision(node->get_element_type()),
+                                                      shape,
+                                                      InferenceEngine::TensorDesc::getLayoutByRank(shape.size())};
+            auto blob = make_blob_with_precision(tensorDesc);
+            blob->allocate();
+            return blob;
+        };
+        (*blobMap)[*batchedInputs.begin()] = make_blob(inputs[0]);
+        (*blobMap)[*batchedOutputs.begin()] = make_blob(outputs[0]);
+        ON_CALL(*request, GetBlob(_)).WillByDefault([blobMap](const std::string& name) {
+            return blobMap->at(name);
+        });
+    }
+
+    void create_worker(int batch_size) {
+        workerRequestPtr = std::make_shared<AutoBatchExecutableNetwork::WorkerInferRequest>();
+        set_blobs(mockInferRequestBatched, batch_size);
+        workerRequestPtr->_inferRequestBatched = {mockInferRequestBatched, {}};
+        workerRequestPtr->_batchSize = batch_size;
+        workerRequestPtr->_completionTasks.resize(workerRequestPtr->_batchSize);
+        workerRequestPtr->_batchingStatistics = std::make_shared<BatchingStatistics>(0);
+        // the ladder of the power-of-two batch sizes with the full batch on the top
+        for (int batch = 2; batch < batch_size; batch *= 2)
+            add_partial_request(batch);
+        add_partial_request(batch_size);
+    }
+
+    void add_partial_request(int batch_size) {
+        mockPartialRequests[batch_size] = std::make_shared<NiceMock<MockIInferRequestInternal>>();
+        set_blobs(mockPartialRequests[batch_size], batch_size);
+        workerRequestPtr->_partialRequests[batch_size] = {mockPartialRequests[batch_size], {}};
+    }
+};
+
+TEST_P(AutoBatchPartialBatchTest, AutoBatchPartialBatchDispatchTest) {
+    int batch_size, collected, expected_batch_size;
+    std::tie(batch_size, collected, expected_batch_size) = this->GetParam();
+    create_worker(batch_size);
+    ASSERT_EQ(mockPartialRequests.rbegin()->first, batch_size);
+
+    for (const auto& partial : mockPartialRequests)
+        EXPECT_CALL(*partial.second, Infer()).Times(partial.first == expected_batch_size ? 1 : 0);
+    EXPECT_CALL(*mockInferRequestBatched, Infer()).Times(0);
+    EXPECT_CALL(*mockInferRequestBatched, StartAsync()).Times(0);
+    EXPECT_CALL(*mockInferRequestWithoutBatched, StartAsync()).Times(0);
+
+    const auto& inputName = *batchedInputs.begin();
+    int completed = 0;
+    for (int batch_id = 0; batch_id < batch_size; batch_id++) {
+        auto autoRequestImpl = std::make_shared<AutoBatchInferRequest>(inputs,
+                                                                       outputs,
+                                                                       *workerRequestPtr,
+                                                                       batch_id,
+                                                                       batch_size,
+                                                                       batchedInputs,
+                                                                       batchedOutputs);
+        InferenceEngine::SoIInferRequestInternal inferRequestWithoutBatched = {mockInferRequestWithoutBatched, {}};
+        autoBatchAsyncInferRequestVec.emplace_back(
+            std::make_shared<AutoBatchAsyncInferRequest>(autoRequestImpl, inferRequestWithoutBatched, nullptr));
+        auto input = autoRequestImpl->GetBlob(inputName);
+        auto data = input->buffer().as<float*>();
+        std::fill(data, data + input->size(), static_cast<float>(batch_id + 1));
+    }
+    // the requests are collected in the reverse order to check that they get the slots of the partial batch in the
+    // order of the collection rather than their slots in the worker request
+    for (int n = 0; n < collected; n++) {
+        workerRequestPtr->_tasks.push({autoBatchAsyncInferRequestVec[batch_size - 1 - n].get(), [&completed] {
+                                           completed++;
+                                       }});
+    }
+
+    ASSERT_TRUE(AutoBatchExecutableNetwork::ExecutePartialBatch(*workerRequestPtr, collected));
+    EXPECT_EQ(collected, completed);
+    EXPECT_EQ(0u, workerRequestPtr->_tasks.size());
+
+    auto partialInput = mockPartialRequests.at(expected_batch_size)->GetBlob(inputName);
+    const auto slotSize = partialInput->size() / expected_batch_size;
+    const auto partialData = partialInput->cbuffer().as<const float*>();
+    for (int n = 0; n < collected; n++) {
+        const auto& request = autoBatchAsyncInferRequestVec[batch_size - 1 - n]->_inferRequest;
+        EXPECT_EQ(AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED, request->_wasBatchedRequestUsed);
+        EXPECT_EQ(expected_batch_size, request->_partialBatchSize);
+        EXPECT_FALSE(request->_exceptionPtr);
+        EXPECT_EQ(static_cast<float>(batch_size - n), partialData[n * slotSize]);
+        EXPECT_EQ(static_cast<float>(batch_size - n), partialData[(n + 1) * slotSize - 1]);
+    }
+}
+
+const std::vector<AutoBatchPartialBatchTestParams> partialBatchParams = {
+    AutoBatchPartialBatchTestParams{8, 2, 2},
+    AutoBatchPartialBatchTestParams{8, 3, 4},
+    AutoBatchPartialBatchTestParams{8, 4, 4},
+    // above the largest power of two the full batch is executed with the padding
+    AutoBatchPartialBatchTestParams{8, 5, 8},
+    AutoBatchPartialBatchTestParams{8, 6, 8},
+    AutoBatchPartialBatchTestParams{8, 7, 8},
+    AutoBatchPartialBatchTestParams{6, 5, 6},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatch_BehaviorTests,
+                         AutoBatchPartialBatchTest,
+                         ::testing::ValuesIn(partialBatchParams),
+                         AutoBatchPartialBatchTest::getTestCaseName);
+
 const std::vector<ngraph::element::Type_t> element_type{ngraph::element::Type_t::f16,
                                                         ngraph::element::Type_t::f32,
                                                         ngraph::element::Type_t::f64,
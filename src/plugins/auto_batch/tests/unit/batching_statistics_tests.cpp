@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "batching_statistics.hpp"
+
+using namespace MockAutoBatchPlugin;
+
+TEST(BatchingStatisticsTest, isNotAdaptiveWithoutLatencyTarget) {
+    BatchingStatistics stats(0);
+    ASSERT_FALSE(stats.IsAdaptive());
+    stats.SetLatencyTarget(20);
+    ASSERT_TRUE(stats.IsAdaptive());
+    ASSERT_EQ(20, stats.GetLatencyTarget());
+}
+
+TEST(BatchingStatisticsTest, timeoutFitsLatencyTarget) {
+    BatchingStatistics stats(100);
+    // no statistics yet, the whole target can be spent on collecting the batch
+    ASSERT_EQ(100, stats.GetTimeout(4, 0.0));
+    stats.BatchExecuted(4, std::chrono::milliseconds(30));
+    stats.BatchExecuted(1, std::chrono::milliseconds(10));
+    ASSERT_EQ(70, stats.GetTimeout(4, 5.0));
+    ASSERT_EQ(70, stats.GetCurrentTimeout());
+    // the batch1 execution that follows the timeout is longer than the batched one
+    stats.BatchExecuted(1, std::chrono::milliseconds(40));
+    ASSERT_EQ(60, stats.GetTimeout(4, 5.0));
+}
+
+TEST(BatchingStatisticsTest, flushesImmediatelyWhenBatchIsNotExpectedToFill) {
+    BatchingStatistics stats(100);
+    stats.BatchExecuted(8, std::chrono::milliseconds(50));
+    // 7 more requests at 10ms interval need 70ms while only 50ms fit the target
+    ASSERT_EQ(0, stats.GetTimeout(8, 10.0));
+    ASSERT_EQ(50, stats.GetTimeout(8, 5.0));
+}
+
+TEST(BatchingStatisticsTest, timeoutFollowsP99Latency) {
+    BatchingStatistics stats(100);
+    for (int i = 0; i < 99; i++)
+        stats.BatchExecuted(4, std::chrono::milliseconds(10));
+    stats.BatchExecuted(4, std::chrono::milliseconds(80));
+    ASSERT_EQ(90, stats.GetTimeout(4, 0.0));
+    stats.BatchExecuted(4, std::chrono::milliseconds(80));
+    ASSERT_EQ(20, stats.GetTimeout(4, 0.0));
+}
+
+TEST(BatchingStatisticsTest, fillRatio) {
+    BatchingStatistics stats(0);
+    ASSERT_FLOAT_EQ(0.f, stats.GetFillRatio());
+    stats.BatchDispatched(4, 4);
+    stats.BatchDispatched(2, 4);
+    ASSERT_FLOAT_EQ(0.75f, stats.GetFillRatio());
+}
+
+TEST(InterArrivalTimeTest, ignoresIdleTime) {
+    InterArrivalTime interArrival;
+    const auto start = InterArrivalTime::Clock::now();
+    interArrival.Arrived(start, false);
+    interArrival.Arrived(start + std::chrono::milliseconds(8), true);
+    const auto interval = interArrival.Get();
+    ASSERT_GT(interval, 0.0);
+    interArrival.Arrived(start + std::chrono::seconds(10), false);
+    ASSERT_DOUBLE_EQ(interval, interArrival.Get());
+}
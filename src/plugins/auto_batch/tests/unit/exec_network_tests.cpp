@@ -8,6 +8,7 @@
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "mock_auto_batch_plugin.hpp"
 #include "ngraph_functions/subgraph_builders.hpp"
+#include "openvino/runtime/internal_properties.hpp"
 #include "unit_test_utils/mocks/cpp_interfaces/impl/mock_inference_plugin_internal.hpp"
 #include "unit_test_utils/mocks/cpp_interfaces/interface/mock_icore.hpp"
 #include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iexecutable_network_internal.hpp"
@@ -180,9 +181,12 @@ const std::vector<ExecNetworkParams> testConfigs = {
         ExecNetworkParams{METRIC_KEY(SUPPORTED_METRICS), 0, false},
         ExecNetworkParams{METRIC_KEY(SUPPORTED_CONFIG_KEYS), 0, false},
         ExecNetworkParams{ov::execution_devices.name(), 0, false},
+        ExecNetworkParams{ov::auto_batch_current_timeout.name(), 0, false},
+        ExecNetworkParams{ov::auto_batch_fill_ratio.name(), 0, false},
         // Config in autobatch
         ExecNetworkParams{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), 1, false},
         ExecNetworkParams{CONFIG_KEY(AUTO_BATCH_TIMEOUT), 1, false},
+        ExecNetworkParams{ov::auto_batch_latency_target.name(), 1, false},
         ExecNetworkParams{CONFIG_KEY(CACHE_DIR), 1, false},
         // Config in dependent plugin
         ExecNetworkParams{"OPTIMAL_BATCH_SIZE", 1, false},
@@ -192,6 +196,7 @@ const std::vector<ExecNetworkParams> testConfigs = {
         ExecNetworkParams{"INCORRECT_CONFIG", 1, true},
         // Set Config
         ExecNetworkParams{CONFIG_KEY(AUTO_BATCH_TIMEOUT), 2, false},
+        ExecNetworkParams{ov::auto_batch_latency_target.name(), 3, false},
         ExecNetworkParams{"INCORRECT_CONFIG", 2, true},
 };
 
@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 
 #include <dimension_tracker.hpp>
+#include <set>
 
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "mock_auto_batch_plugin.hpp"
@@ -218,6 +219,57 @@ TEST_P(PluginLoadNetworkTest, PluginLoadNetworkGetMetricTestCase) {
     ASSERT_ANY_THROW(execNet->GetMetric("XYZ"));
 }
 
+TEST_P(PluginLoadNetworkTest, PluginLoadPartialBatchNetworksTestCase) {
+    std::map<std::string, std::string> params;
+    std::map<std::string, std::string> configs;
+    int batch_size;
+    std::tie(params, configs, batch_size) = this->GetParam();
+
+    ON_CALL(*core, GetConfig(_, StrEq("PERFORMANCE_HINT"))).WillByDefault(Return(params["PERFORMANCE_HINT"]));
+    ON_CALL(*core, GetMetric(_, StrEq("OPTIMAL_BATCH_SIZE"), _)).WillByDefault(Return(params["OPTIMAL_BATCH_SIZE"]));
+    ON_CALL(*core, GetConfig(_, StrEq("PERFORMANCE_HINT_NUM_REQUESTS")))
+        .WillByDefault(Return(params["PERFORMANCE_HINT_NUM_REQUESTS"]));
+
+    ON_CALL(*core, GetMetric(_, StrEq("GPU_MEMORY_STATISTICS"), _))
+        .WillByDefault([&params](const std::string& device, const std::string& key, const ov::AnyMap& options) {
+            static int flag = 0;
+            ov::Any value = params[key];
+            uint64_t data = flag * value.as<uint64_t>();
+            std::map<std::string, uint64_t> ret = {{"xyz", data}};
+            flag = flag ? 0 : 1;
+            return ret;
+        });
+
+    ON_CALL(*core, GetMetric(_, StrEq("GPU_DEVICE_TOTAL_MEM_SIZE"), _))
+        .WillByDefault(Return(params["GPU_DEVICE_TOTAL_MEM_SIZE"]));
+
+    // the batch sizes of the compiled networks
+    std::multiset<size_t> loaded;
+    ON_CALL(*core, LoadNetwork(MatcherCast<const CNNNetwork&>(_), MatcherCast<const std::string&>(_), _))
+        .WillByDefault([this, &loaded](const CNNNetwork& network,
+                                       const std::string& deviceName,
+                                       const std::map<std::string, std::string>& config) {
+            loaded.insert(network.getInputShapes().begin()->second[0]);
+            return cpuMockExecNetwork;
+        });
+
+    auto graph = ngraph::builder::subgraph::makeMultiSingleConv();
+    auto net = CNNNetwork(graph);
+    ASSERT_NO_THROW(plugin->LoadNetworkImpl(net, {}, configs));
+
+    std::multiset<size_t> expected = {1};
+    if (batch_size > 1) {
+        const auto partial_batches = configs.find("AUTO_BATCH_PARTIAL_BATCHES");
+        if (partial_batches != configs.end() && partial_batches->second == "YES") {
+            // the power-of-two ladder, the top rung reuses the network compiled for the full batch
+            for (int batch = 2; batch < batch_size; batch *= 2)
+                expected.insert(batch);
+        }
+        expected.insert(batch_size);
+    }
+    EXPECT_EQ(expected, loaded);
+}
+
 const std::vector<PluginLoadNetworkParams> testConfigs = {
     // Case 1: explict apply batch size by config of AUTO_BATCH_DEVICE_CONFIG
     PluginLoadNetworkParams{{{"PERFORMANCE_HINT", "THROUGHPUT"},
@@ -305,6 +357,25 @@ const std::vector<PluginLoadNetworkParams> testConfigs = {
                              {"GPU_DEVICE_TOTAL_MEM_SIZE", "4096000000"}},
                             {{"AUTO_BATCH_TIMEOUT", "200"}, {"AUTO_BATCH_DEVICE_CONFIG", "CPU(32)"}},
                             32},
+    // Case 5: the networks for the partial batches are compiled as well
+    PluginLoadNetworkParams{{{"PERFORMANCE_HINT", "THROUGHPUT"},
+                             {"OPTIMAL_BATCH_SIZE", "16"},
+                             {"PERFORMANCE_HINT_NUM_REQUESTS", "12"},
+                             {"GPU_MEMORY_STATISTICS", "1024000"},
+                             {"GPU_DEVICE_TOTAL_MEM_SIZE", "4096000000"}},
+                            {{"AUTO_BATCH_TIMEOUT", "200"},
+                             {"AUTO_BATCH_DEVICE_CONFIG", "CPU(8)"},
+                             {"AUTO_BATCH_PARTIAL_BATCHES", "YES"}},
+                            8},
+    PluginLoadNetworkParams{{{"PERFORMANCE_HINT", "THROUGHPUT"},
+                             {"OPTIMAL_BATCH_SIZE", "16"},
+                             {"PERFORMANCE_HINT_NUM_REQUESTS", "12"},
+                             {"GPU_MEMORY_STATISTICS", "1024000"},
+                             {"GPU_DEVICE_TOTAL_MEM_SIZE", "4096000000"}},
+                            {{"AUTO_BATCH_TIMEOUT", "200"},
+                             {"AUTO_BATCH_DEVICE_CONFIG", "CPU(6)"},
+                             {"AUTO_BATCH_PARTIAL_BATCHES", "YES"}},
+                            6},
 };
 
 INSTANTIATE_TEST_SUITE_P(smoke_AutoBatch_BehaviorTests,
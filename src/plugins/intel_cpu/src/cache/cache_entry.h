@@ -6,7 +6,7 @@
 
 #include <memory>
 #include <functional>
-#include "lru_cache.h"
+#include "sharded_lru_cache.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -19,21 +19,22 @@ public:
     };
 public:
     virtual ~CacheEntryBase() = default;
+    virtual CacheStats getStats() const = 0;
 };
 
 /**
  * @brief Class represents a templated record in multi cache
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
- * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const KeyType&)
- *         interface and must have constructor of type ImplType(size_t).
+ * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType), ValueType get(const KeyType&) and
+ *         CacheStats getStats() interface and must have constructor of type ImplType(size_t).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
  */
 
 template<typename KeyType,
          typename ValType,
-         typename ImplType = LruCache<KeyType, ValType>>
+         typename ImplType = ShardedLruCache<KeyType, ValType>>
 class CacheEntry : public CacheEntryBase {
 public:
     using ResultType = std::pair<ValType, LookUpStatus>;
@@ -66,6 +67,10 @@ public:
         return {retVal, retStatus};
     }
 
+    CacheStats getStats() const override {
+        return _impl.getStats();
+    }
+
 public:
     ImplType _impl;
 };
@@ -9,5 +9,27 @@ namespace intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+CacheStats MultiCache::getStats() const {
+    CacheStats stats;
+    std::lock_guard<std::mutex> lock(_storageMutex);
+    for (const auto& item : _storage) {
+        stats += item.second->getStats();
+    }
+    return stats;
+}
+
+MultiCachePtr MultiCache::getSharedInstance(size_t capacity) {
+    static std::mutex instanceMutex;
+    static std::weak_ptr<MultiCache> instance;
+
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    auto cache = instance.lock();
+    if (!cache) {
+        cache = std::make_shared<MultiCache>(capacity);
+        instance = cache;
+    }
+    return cache;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
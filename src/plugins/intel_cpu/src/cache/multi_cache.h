@@ -5,17 +5,42 @@
 #pragma once
 
 #include <functional>
+#include <memory>
+#include <type_traits>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
 #include "cache_entry.h"
 
 namespace ov {
 namespace intel_cpu {
 
+class MultiCache;
+using MultiCachePtr = std::shared_ptr<MultiCache>;
+
+/**
+ * @brief Base class of the cached value types which may be used by several streams at the same time: such values
+ * keep no state between the calls and take all the buffers (including the scratchpad) with the call arguments.
+ */
+struct StatelessCacheValue {};
+
+/**
+ * @brief Opt-in marker of the stateless cached value types. The types derived from StatelessCacheValue are marked,
+ * the other types may be marked by the specialization of the template, std::shared_ptr inherits the marker of the
+ * pointee.
+ */
+template<typename T>
+struct IsStatelessCacheValue : std::is_base_of<StatelessCacheValue, T> {};
+
+template<typename T>
+struct IsStatelessCacheValue<std::shared_ptr<T>> : IsStatelessCacheValue<T> {};
+
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * The implementation is thread safe. The values marked with IsStatelessCacheValue may be shared between the streams
+ * and compiled models through the shared instance (see getSharedInstance()), the other values stay in the cache of
+ * the stream.
  */
 
 class MultiCache {
@@ -33,6 +58,16 @@ public:
     */
     explicit MultiCache(size_t capacity) : _capacity(capacity) {}
 
+    /**
+    * @param shared is the cache of the values marked with IsStatelessCacheValue, the other values are kept locally
+    */
+    MultiCache(size_t capacity, MultiCachePtr shared) : _capacity(capacity), _shared(std::move(shared)) {}
+
+    MultiCache(const MultiCache& other) : _capacity(other._capacity), _shared(other._shared) {
+        std::lock_guard<std::mutex> lock(other._storageMutex);
+        _storage = other._storage;
+    }
+
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
     *       using the key and the builder functor and adds the new record to the cache
@@ -45,10 +80,31 @@ public:
     template<typename KeyType, typename BuilderType, typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
     typename CacheEntry<KeyType, ValueType>::ResultType
     getOrCreate(const KeyType& key, BuilderType builder) {
+        if (IsStatelessCacheValue<ValueType>::value && _shared)
+            return _shared->getOrCreate(key, std::move(builder));
         auto entry = getEntry<KeyType, ValueType>();
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+    * @brief Returns lookup statistics aggregated over all the entries, the shared cache is accounted separately
+    */
+    CacheStats getStats() const;
+
+    /**
+    * @brief Returns the cache of the stateless values, nullptr if they are kept locally
+    */
+    MultiCachePtr getSharedCache() const {
+        return _shared;
+    }
+
+    /**
+    * @brief Returns the process-wide cache instance of the stateless values. The instance lives as long as there is
+    *        at least one user of it.
+    * @param capacity is used only when the instance is (re)created
+    */
+    static MultiCachePtr getSharedInstance(size_t capacity);
+
 private:
     template<typename T>
     size_t getTypeId();
@@ -58,6 +114,8 @@ private:
 private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    MultiCachePtr _shared;
+    mutable std::mutex _storageMutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -71,6 +129,7 @@ template<typename KeyType, typename ValueType>
 MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     using EntryType = EntryTypeT<KeyType, ValueType>;
     size_t id = getTypeId<EntryType>();
+    std::lock_guard<std::mutex> lock(_storageMutex);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
@@ -81,7 +140,6 @@ MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
 
 using MultiCacheWeakPtr = std::weak_ptr<MultiCache>;
 using MultiCacheWeakCPtr = std::weak_ptr<const MultiCache>;
-using MultiCachePtr = std::shared_ptr<MultiCache>;
 using MultiCacheCPtr = std::shared_ptr<const MultiCache>;
 
 }   // namespace intel_cpu
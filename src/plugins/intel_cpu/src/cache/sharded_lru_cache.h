@@ -0,0 +1,334 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief Thread safe implementation of a preemptive cache with LRU eviction policy.
+ * The records are distributed over a number of shards by the key hash, each shard is guarded by its own lock.
+ * Inside a shard the records are stored in a flat array threaded by an intrusive LRU list, the lookup is performed
+ * through an open addressing (linear probing) index table, so no allocations are performed once a shard is full.
+ * The capacity is split evenly between the shards, so the actual number of records may slightly exceed it due to rounding.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam Value is a type that must be default constructible and copy assignable
+ */
+
+namespace ov {
+namespace intel_cpu {
+
+struct CacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    uint64_t size = 0;
+
+    CacheStats& operator+=(const CacheStats& rhs) {
+        hits += rhs.hits;
+        misses += rhs.misses;
+        evictions += rhs.evictions;
+        size += rhs.size;
+        return *this;
+    }
+};
+
+template<typename Key, typename Value>
+class ShardedLruCache {
+public:
+    explicit ShardedLruCache(size_t capacity) : _capacity(capacity) {
+        constexpr size_t maxShards = 16;
+        constexpr size_t minShardCapacity = 64;
+        size_t shardsNum = 1;
+        while (shardsNum < maxShards && capacity / (shardsNum * 2) >= minShardCapacity) {
+            shardsNum *= 2;
+        }
+        _shardMask = shardsNum - 1;
+        const size_t shardCapacity = (capacity + shardsNum - 1) / shardsNum;
+        _shards.reserve(shardsNum);
+        for (size_t i = 0; i < shardsNum; ++i) {
+            _shards.emplace_back(new Shard(shardCapacity));
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     */
+    void put(const Key &key, const Value &val) {
+        if (0 == _capacity) {
+            return;
+        }
+        const uint64_t h = mix(key.hash());
+        getShard(h).put(key, val, h);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+    Value get(const Key &key) {
+        const uint64_t h = mix(key.hash());
+        return getShard(h).get(key, h);
+    }
+
+    /**
+     * @brief Evicts n least recently used cache records from each shard
+     * @param n number of records to be evicted, can be greater than capacity
+     */
+    void evict(size_t n) {
+        for (auto& shard : _shards) {
+            shard->evict(n);
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the aggregated lookup statistics of all the shards
+     */
+    CacheStats getStats() const {
+        CacheStats stats;
+        for (const auto& shard : _shards) {
+            stats += shard->getStats();
+        }
+        return stats;
+    }
+
+private:
+    static uint64_t mix(uint64_t h) {
+        // splitmix64 finalizer, user provided hashes are often poorly distributed in the low bits
+        h ^= h >> 30;
+        h *= 0xbf58476d1ce4e5b9ull;
+        h ^= h >> 27;
+        h *= 0x94d049bb133111ebull;
+        h ^= h >> 31;
+        return h;
+    }
+
+    class Shard {
+    public:
+        explicit Shard(size_t capacity) : _capacity(capacity) {
+            size_t tableSize = 1;
+            while (tableSize < 2 * capacity) {
+                tableSize *= 2;
+            }
+            _mask = tableSize - 1;
+            _table.assign(tableSize, nil);
+            _nodes.reserve(capacity);
+        }
+
+        void put(const Key& key, const Value& val, uint64_t h) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (0 == _capacity) {
+                return;
+            }
+            const size_t pos = find(key, h);
+            if (_table[pos] != nil) {
+                const auto idx = _table[pos];
+                _nodes[idx].value = val;
+                touch(idx);
+                return;
+            }
+
+            uint32_t idx = nil;
+            if (!_free.empty()) {
+                idx = _free.back();
+                _free.pop_back();
+                auto& node = _nodes[idx];
+                node.key = key;
+                node.value = val;
+                node.hash = h;
+            } else if (_nodes.size() < _capacity) {
+                idx = static_cast<uint32_t>(_nodes.size());
+                _nodes.push_back({key, val, h, nil, nil});
+            } else {
+                // reuse the least recently used record
+                idx = _tail;
+                unlink(idx);
+                erase(idx);
+                _size--;
+                _evictions++;
+                auto& node = _nodes[idx];
+                node.key = key;
+                node.value = val;
+                node.hash = h;
+            }
+            // the erase above may have shifted the probing chain, so the insertion position is looked up once again
+            _table[find(key, h)] = idx;
+            pushFront(idx);
+            _size++;
+        }
+
+        Value get(const Key& key, uint64_t h) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (0 == _capacity) {
+                _misses++;
+                return Value();
+            }
+            const size_t pos = find(key, h);
+            if (_table[pos] == nil) {
+                _misses++;
+                return Value();
+            }
+            const auto idx = _table[pos];
+            touch(idx);
+            _hits++;
+            return _nodes[idx].value;
+        }
+
+        void evict(size_t n) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (size_t i = 0; i < n && _tail != nil; ++i) {
+                const auto idx = _tail;
+                unlink(idx);
+                erase(idx);
+                // release the value right away, the slot is kept for the future records
+                _nodes[idx].value = Value();
+                _free.push_back(idx);
+                _size--;
+                _evictions++;
+            }
+            if (_size == 0) {
+                _nodes.clear();
+                _free.clear();
+            }
+        }
+
+        CacheStats getStats() const {
+            std::lock_guard<std::mutex> lock(_mutex);
+            CacheStats stats;
+            stats.hits = _hits;
+            stats.misses = _misses;
+            stats.evictions = _evictions;
+            stats.size = _size;
+            return stats;
+        }
+
+    private:
+        enum : uint32_t { nil = std::numeric_limits<uint32_t>::max() };
+
+        struct Node {
+            Key key;
+            Value value;
+            uint64_t hash;
+            uint32_t prev;
+            uint32_t next;
+        };
+
+        size_t home(uint64_t h) const {
+            return static_cast<size_t>(h) & _mask;
+        }
+
+        // returns the table position of the key or the first empty position of its probing chain
+        size_t find(const Key& key, uint64_t h) const {
+            size_t pos = home(h);
+            while (_table[pos] != nil) {
+                const auto& node = _nodes[_table[pos]];
+                if (node.hash == h && node.key == key) {
+                    break;
+                }
+                pos = (pos + 1) & _mask;
+            }
+            return pos;
+        }
+
+        // removes the node from the index table using backward shift deletion
+        void erase(uint32_t idx) {
+            size_t i = home(_nodes[idx].hash);
+            while (_table[i] != idx) {
+                i = (i + 1) & _mask;
+            }
+            _table[i] = nil;
+            size_t j = i;
+            while (true) {
+                j = (j + 1) & _mask;
+                if (_table[j] == nil) {
+                    break;
+                }
+                const size_t k = home(_nodes[_table[j]].hash);
+                const bool inRange = i <= j ? (i < k && k <= j) : (i < k || k <= j);
+                if (inRange) {
+                    continue;
+                }
+                _table[i] = _table[j];
+                _table[j] = nil;
+                i = j;
+            }
+        }
+
+        void unlink(uint32_t idx) {
+            auto& node = _nodes[idx];
+            if (node.prev != nil) {
+                _nodes[node.prev].next = node.next;
+            } else {
+                _head = node.next;
+            }
+            if (node.next != nil) {
+                _nodes[node.next].prev = node.prev;
+            } else {
+                _tail = node.prev;
+            }
+            node.prev = node.next = nil;
+        }
+
+        void pushFront(uint32_t idx) {
+            auto& node = _nodes[idx];
+            node.prev = nil;
+            node.next = _head;
+            if (_head != nil) {
+                _nodes[_head].prev = idx;
+            }
+            _head = idx;
+            if (_tail == nil) {
+                _tail = idx;
+            }
+        }
+
+        void touch(uint32_t idx) {
+            if (_head == idx) {
+                return;
+            }
+            unlink(idx);
+            pushFront(idx);
+        }
+
+        mutable std::mutex _mutex;
+        const size_t _capacity;
+        size_t _mask = 0;
+        size_t _size = 0;
+        std::vector<uint32_t> _table;
+        std::vector<Node> _nodes;
+        std::vector<uint32_t> _free;
+        uint32_t _head = nil;
+        uint32_t _tail = nil;
+        uint64_t _hits = 0;
+        uint64_t _misses = 0;
+        uint64_t _evictions = 0;
+    };
+
+    Shard& getShard(uint64_t h) {
+        return *_shards[(h >> 32) & _shardMask];
+    }
+
+    size_t _capacity;
+    size_t _shardMask = 0;
+    std::vector<std::unique_ptr<Shard>> _shards;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
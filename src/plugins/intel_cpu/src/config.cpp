@@ -219,6 +219,129 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARING == key) {
+            if (val == PluginConfigParams::YES)
+                rtCacheSharing = true;
+            else if (val == PluginConfigParams::NO)
+                rtCacheSharing = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARING
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_DYNAMIC_SHAPE_BUCKETS == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_DYNAMIC_SHAPE_BUCKETS
+                           << ". Expected only integer numbers";
+            }
+            // any negative value will be treated
+            // as zero that means disabling the bucketed memory plans
+            dynShapeBuckets = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_WEIGHTS_ZERO_COPY == key) {
+            if (val == PluginConfigParams::YES)
+                weightsZeroCopy = true;
+            else if (val == PluginConfigParams::NO)
+                weightsZeroCopy = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WEIGHTS_ZERO_COPY
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_WEIGHTS_CACHE_DIR == key) {
+            weightsCacheDir = val;
+        } else if (PluginConfigInternalParams::KEY_CPU_STATE_RESERVE == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_STATE_RESERVE
+                           << ". Expected only integer numbers";
+            }
+            // any negative value will be treated
+            // as zero that means disabling the reservation
+            stateReserve = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_PREPARE_LOOKAHEAD == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PREPARE_LOOKAHEAD
+                           << ". Expected only integer numbers";
+            }
+            // any negative value will be treated
+            // as zero that means preparing the primitives before the execution
+            prepareLookahead = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_LATENCY_HISTOGRAMS == key) {
+            if (val == PluginConfigParams::YES)
+                latencyHistograms = true;
+            else if (val == PluginConfigParams::NO)
+                latencyHistograms = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_LATENCY_HISTOGRAMS
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLELISM == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLELISM
+                           << ". Expected only integer numbers";
+            }
+            // any negative value will be treated
+            // as zero that means the sequential execution
+            interOpParallelism = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_IF_SHARED_MEMORY == key) {
+            if (val == PluginConfigParams::YES)
+                ifSharedMemory = true;
+            else if (val == PluginConfigParams::NO)
+                ifSharedMemory = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_IF_SHARED_MEMORY
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_TOPK_RADIX_SELECT == key) {
+            if (val == PluginConfigParams::YES)
+                topkRadixSelect = true;
+            else if (val == PluginConfigParams::NO)
+                topkRadixSelect = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_TOPK_RADIX_SELECT
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_INFERENCE_TRACE == key) {
+            inferenceTracePath = val;
+        } else if (PluginConfigInternalParams::KEY_CPU_INFERENCE_TRACE_PERIOD == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_INFERENCE_TRACE_PERIOD
+                           << ". Expected only integer numbers";
+            }
+            // any value less than one will be treated
+            // as one that means tracing every inference
+            inferenceTracePeriod = std::max(val_i, 1);
+        } else if (PluginConfigInternalParams::KEY_CPU_PARALLEL_CONSTANT_FOLDING == key) {
+            if (val == PluginConfigParams::YES)
+                parallelConstantFolding = true;
+            else if (val == PluginConfigParams::NO)
+                parallelConstantFolding = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PARALLEL_CONSTANT_FOLDING
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_INCREMENTAL_GRAPH_REWRITE == key) {
+            if (val == PluginConfigParams::YES)
+                incrementalGraphRewrite = true;
+            else if (val == PluginConfigParams::NO)
+                incrementalGraphRewrite = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_INCREMENTAL_GRAPH_REWRITE
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_SNIPPETS_DYNAMIC_SHAPES == key) {
+            if (val == PluginConfigParams::YES)
+                snippetsDynamicShapes = true;
+            else if (val == PluginConfigParams::NO)
+                snippetsDynamicShapes = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SNIPPETS_DYNAMIC_SHAPES
+                           << ". Expected only YES/NO";
         } else if (CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION == key) {
             if (val == PluginConfigParams::YES) {
                 denormalsOptMode = DenormalsOptMode::DO_On;
@@ -54,6 +54,21 @@ struct Config {
     // TODO: Executor cache may leads to incorrect behavior on oneDNN ACL primitives
     size_t rtCacheCapacity = 0ul;
 #endif
+    bool rtCacheSharing = false;
+    size_t dynShapeBuckets = 0ul;
+    bool weightsZeroCopy = false;
+    std::string weightsCacheDir = {};
+    size_t stateReserve = 0ul;
+    size_t prepareLookahead = 0ul;
+    bool latencyHistograms = false;
+    size_t interOpParallelism = 0ul;
+    bool ifSharedMemory = false;
+    bool topkRadixSelect = false;
+    std::string inferenceTracePath = {};
+    size_t inferenceTracePeriod = 100ul;
+    bool parallelConstantFolding = false;
+    bool incrementalGraphRewrite = false;
+    bool snippetsDynamicShapes = true;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
     bool enableCpuPinning = true;
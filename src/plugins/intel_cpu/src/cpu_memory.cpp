@@ -5,6 +5,7 @@
 #include <oneapi/dnnl/dnnl.hpp>
 #include <vector>
 #include <numeric>
+#include <algorithm>
 #include <unordered_set>
 
 #include <dnnl_types.h>
@@ -226,6 +227,44 @@ void MemoryMngrWithReuse::destroy(void *ptr) {
     dnnl::impl::free(ptr);
 }
 
+void* GrowableMemoryMngr::getRawPtr() const noexcept {
+    return _data.get();
+}
+
+void GrowableMemoryMngr::setExtBuff(void *ptr, size_t size) {
+    _useExternalStorage = true;
+    _memUpperBound = size;
+    _data = decltype(_data)(ptr, release);
+}
+
+bool GrowableMemoryMngr::resize(size_t size) {
+    constexpr int cacheLineSize = 64;
+    if (size <= _memUpperBound)
+        return false;
+
+    const size_t newSize = std::max(size, 2 * _memUpperBound);
+    void *ptr = dnnl::impl::malloc(newSize, cacheLineSize);
+    if (!ptr) {
+        IE_THROW() << "Failed to allocate " << newSize << " bytes of memory";
+    }
+    if (_data)
+        cpu_memcpy(ptr, _data.get(), _memUpperBound);
+    _memUpperBound = newSize;
+    _useExternalStorage = false;
+    _data = decltype(_data)(ptr, destroy);
+    return true;
+}
+
+bool GrowableMemoryMngr::hasExtBuffer() const noexcept {
+    return _useExternalStorage;
+}
+
+void GrowableMemoryMngr::release(void *ptr) {}
+
+void GrowableMemoryMngr::destroy(void *ptr) {
+    dnnl::impl::free(ptr);
+}
+
 void* DnnlMemoryMngr::getRawPtr() const noexcept {
     return _pMemMngr->getRawPtr();
 }
@@ -89,6 +89,27 @@ private:
     static void destroy(void *ptr);
 };
 
+/**
+ * @brief An implementation of the mem manager which keeps the content of the buffer on reallocation and grows it
+ * geometrically, so a tensor extended step by step is reallocated a logarithmic number of times.
+ */
+class GrowableMemoryMngr : public IMemoryMngr {
+public:
+    GrowableMemoryMngr() : _data(nullptr, release) {}
+    void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    bool hasExtBuffer() const noexcept override;
+
+private:
+    bool _useExternalStorage = false;
+    size_t _memUpperBound = 0ul;
+    std::unique_ptr<void, void (*)(void *)> _data;
+
+    static void release(void *ptr);
+    static void destroy(void *ptr);
+};
+
 /**
  * @brief A proxy object that additionally implements observer pattern
  */
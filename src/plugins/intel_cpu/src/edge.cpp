@@ -7,6 +7,7 @@
 #include "dnnl_extension_utils.h"
 #include <blob_factory.hpp>
 #include "nodes/input.h"
+#include "nodes/concat.h"
 
 using namespace dnnl;
 namespace ov {
@@ -648,5 +649,70 @@ bool Edge::inPlace(LOOK look) const {
     return false;
 }
 
+// The memory of the node output may be replaced with an external one if no child is in-place with it
+bool canChangeChildEdgesPtr(const NodePtr& node) {
+    auto& childEdges = node->getChildEdges();
+    for (auto& childEdge : childEdges) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            IE_THROW() << "Node " << node->getName() << " contains empty child edge";
+
+        auto& child = ce->getChild();
+
+        if (child->isConstant())
+            return false;
+
+        if (child->getType() == Type::Concatenation) {
+            auto concat = dynamic_cast<node::Concat*>(child.get());
+            if (concat && concat->isOptimized())
+                return false;
+        }
+
+        // Cannot be in-place before split because split is using different ptrs without offsets
+        if (child->getType() == Type::Split)
+            return false;
+
+        if (child->isInPlace())
+            return false;
+
+        auto& edges = child->getChildEdges();
+        for (auto& edge : edges) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << child->getName() << " contains empty child edge";
+
+            if (e->getMemory().GetData() == ce->getMemory().GetData())
+                return false;
+        }
+    }
+    return true;
+}
+
+// The memory of the node input may be replaced with an external one if no parent is in-place with it
+bool canChangeParentEdgePtr(const EdgePtr& parentEdge) {
+    void* defaultPtr = parentEdge->getMemory().GetData();
+    // Cannot be in-place after concat because concat is using different ptrs without offsets
+    auto parent = parentEdge->getParent();
+    NodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace())
+            return false;
+
+        auto& parentEdges = parent->getParentEdges();
+        for (auto& edge : parentEdges) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
+
+            if (e->getMemory().GetData() == defaultPtr) {
+                parent = e->getParent();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+    return true;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -112,6 +112,11 @@ private:
     friend class Graph;
 };
 
+// The memory of the node output may be replaced with an external one if no child is in-place with it
+bool canChangeChildEdgesPtr(const std::shared_ptr<Node>& node);
+// The memory of the node input may be replaced with an external one if no parent is in-place with it
+bool canChangeParentEdgePtr(const EdgePtr& parentEdge);
+
 }   // namespace intel_cpu
 }   // namespace ov
 
@@ -22,6 +22,11 @@ namespace intel_cpu {
 
 namespace {
 constexpr size_t gpr_size = 8;
+
+// LoopBegin of a shape-agnostic kernel jumps to this label (placed before finalization offsets) if the Loop is skipped
+std::string get_loop_end_label(size_t runtime_args_idx) {
+    return "snippets_loop_end_" + std::to_string(runtime_args_idx);
+}
 } // namespace
 
 inline static void transform_idxs_to_regs(const std::vector<size_t>& idxs, std::vector<Reg64>& regs) {
@@ -180,9 +185,11 @@ KernelEmitter::KernelEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl:
     for (const auto& abstract_to_physical : gpr_map_pool.first)
         data_ptr_regs_idx.push_back(abstract_to_physical.second);
     // However we can use reg_indexes_idx and reg_const_params_idx for other operations since we won't need them
-    // after offsets calculation
+    // after offsets calculation.
+    // Shape-agnostic kernels are an exception: reg_const_params holds the pointer to the runtime Loop args till the end
     gpr_map_pool.second.push_back(reg_indexes_idx);
-    gpr_map_pool.second.push_back(reg_const_params_idx);
+    if (!jcp.shape_agnostic)
+        gpr_map_pool.second.push_back(reg_const_params_idx);
     map_abstract_registers(gpr_map_pool, vec_map_pool, general_exprs);
 }
 
@@ -250,6 +257,9 @@ void KernelEmitter::init_data_pointers(size_t num_inputs, size_t num_params, siz
     // master_shape size must be valid in both static and dynamic cases
     std::function<void(Reg64, const std::vector<size_t>&, Reg64)> init_ptr_with_offset;
     init_ptr_with_offset = [&](Reg64 pointer, const std::vector<size_t>& offsets, Reg64 reg_tmp) {
+        // the caller of a shape-agnostic kernel passes data pointers with the offsets already applied
+        if (jcp.shape_agnostic)
+            return;
         for (int j = 0; j < offset_rank; j++) {
             if (jcp.master_shape[j] != 1 && offsets[j] != 0) {
                 h->mov(reg_tmp, offsets[j]);
@@ -300,6 +310,8 @@ void KernelEmitter::emit_impl(const std::vector<size_t>& in,
     transform_idxs_to_regs(data_ptr_regs_idx, data_ptr_regs);
 
     init_data_pointers(num_inputs, num_inputs + num_outputs, num_unique_buffer, reg_indexes, reg_const_params, data_ptr_regs);
+    if (jcp.shape_agnostic)
+        h->mov(reg_const_params, h->ptr[reg_const_params + GET_OFF(loop_args)]);
     for (const auto& expression : body) {
         const auto& emitter = expression->get_emitter();
         std::vector<size_t> in_regs, out_regs;
@@ -323,7 +335,9 @@ LoopBeginEmitter::LoopBeginEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl:
     if (!loop_end)
         IE_THROW() << "LoopBeginEmitter invoked with invalid configuration: the last output must be LoopEnd";
     work_amount = loop_end->get_work_amount();
+    wa_increment = loop_end->get_increment();
     evaluate_once = loop_end->get_evaluate_once();
+    runtime_args_idx = loop_end->runtime_args_idx;
     in_out_type_ = emitter_in_out_map::gpr_to_gpr;
 }
 
@@ -346,8 +360,15 @@ void LoopBeginEmitter::emit_impl(const std::vector<size_t>& in,
     // todo: In dynamic case we will also need to set broadcasting info here
     Reg64 reg_work_amount = Reg64(static_cast<int>(out.back()));
     Label for_body;
-    // save previous register state (if there is an outer loop that uses this reg for example)
-    if (!evaluate_once) {
+    if (runtime_args_idx != snippets::op::LoopEnd::NO_RUNTIME_ARGS) {
+        // KernelEmitter keeps the pointer to the runtime Loop args of shape-agnostic kernels in abi_param2.
+        // The Loop is skipped if its work amount isn't enough even for a single iteration.
+        const auto args_offset = runtime_args_idx * sizeof(jit_snippets_loop_args);
+        h->mov(reg_work_amount, h->ptr[abi_param2 + args_offset + GET_LOOP_OFF(work_amount)]);
+        h->cmp(reg_work_amount, wa_increment);
+        h->jl(get_loop_end_label(runtime_args_idx), T_NEAR);
+    } else if (!evaluate_once) {
+        // save previous register state (if there is an outer loop that uses this reg for example)
         h->mov(reg_work_amount, work_amount);
     }
     // Note: loop address is not calculated at this point, so need to call calcJmpAddress() which is protected
@@ -374,6 +395,7 @@ LoopEndEmitter::LoopEndEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::imp
     finalization_offsets = loop_end->get_finalization_offsets();
     evaluate_once = loop_end->get_evaluate_once();
     io_data_size = loop_end->get_element_type_sizes();
+    runtime_args_idx = loop_end->runtime_args_idx;
     in_out_type_ = emitter_in_out_map::gpr_to_gpr;
 }
 
@@ -406,6 +428,19 @@ void LoopEndEmitter::emit_impl(const std::vector<size_t>& in,
     std::vector<Reg64> data_ptr_regs;
     transform_idxs_to_regs(data_ptr_reg_idxs, data_ptr_regs);
     Reg64 reg_work_amount = Reg64(in.back());
+    if (runtime_args_idx != snippets::op::LoopEnd::NO_RUNTIME_ARGS) {
+        // the increments and offsets of shape-agnostic kernels are in bytes, see jit_snippets_loop_args
+        const auto args_offset = runtime_args_idx * sizeof(jit_snippets_loop_args);
+        for (size_t idx = 0; idx < data_ptr_regs.size(); idx++)
+            h->add(data_ptr_regs[idx], h->ptr[abi_param2 + args_offset + GET_LOOP_OFF(ptr_increments) + idx * sizeof(int64_t)]);
+        h->sub(reg_work_amount, wa_increment);
+        h->cmp(reg_work_amount, wa_increment);
+        h->jge(loop_begin->begin_address);
+        h->L(get_loop_end_label(runtime_args_idx));
+        for (size_t idx = 0; idx < data_ptr_regs.size(); idx++)
+            h->add(data_ptr_regs[idx], h->ptr[abi_param2 + args_offset + GET_LOOP_OFF(finalization_offsets) + idx * sizeof(int64_t)]);
+        return;
+    }
     if (!evaluate_once) {
         for (int idx = 0; idx < data_ptr_regs.size(); idx++) {
             if (ptr_increments[idx] != 0)
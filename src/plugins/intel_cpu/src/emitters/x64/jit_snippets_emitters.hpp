@@ -27,15 +27,29 @@ namespace intel_cpu {
 #define SNIPPETS_MAX_TILE_RANK 2
 #define SNIPPETS_DYNAMIC_MASTER_SHAPE_RANK 6
 #define GET_OFF(field) offsetof(jit_snippets_call_args, field)
+#define GET_LOOP_OFF(field) offsetof(jit_snippets_loop_args, field)
+// Runtime parameters of a Loop of a shape-agnostic kernel. Pointer increments and offsets are in bytes,
+// the increments are applied on every iteration (they already account for the Loop increment)
+struct jit_snippets_loop_args {
+    int64_t work_amount = 0;
+    int64_t ptr_increments[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
+    int64_t finalization_offsets[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
+};
+
 struct jit_snippets_call_args {
     const void *src_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     void *dst_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     void *buffer_scratchpad_ptr = nullptr;
+    // shape-agnostic kernels only: parameters of the Loops in the order of snippets::Schedule::runtime_loops
+    const jit_snippets_loop_args *loop_args = nullptr;
 };
 
 struct jit_snippets_compile_args {
     std::vector<size_t> master_shape{};
     size_t tile_rank = 0;
+    // the kernel doesn't depend on the shapes: data pointers are passed with the applied offsets,
+    // Loop parameters are read from jit_snippets_call_args::loop_args
+    bool shape_agnostic = false;
 };
 ///
 /// \brief jit_container_emitter designed to wrap Emitters that contain other Emitters (for example, KernelEmitter)
@@ -127,6 +141,8 @@ private:
     std::shared_ptr<snippets::op::LoopBegin> loop_begin;
     bool evaluate_once = false;
     size_t work_amount = 0; // need to store work_amount explicitly, since two loops can work on the same dim (e.g. vector + scalar)
+    size_t wa_increment = 0;
+    size_t runtime_args_idx = 0;
 };
 
 class LoopEndEmitter : public jit_emitter {
@@ -157,6 +173,7 @@ private:
     bool evaluate_once = false;
     std::vector<int64_t> ptr_increments;
     std::vector<int64_t> finalization_offsets;
+    size_t runtime_args_idx = 0;
 };
 
 class NopEmitter : public jit_emitter {
@@ -156,7 +156,10 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                 if (suffix_idx != std::string::npos)
                     state_name = state_name.substr(0, suffix_idx);
 
-                memoryStates.emplace_back(new VariableState(state_name, state_store));
+                memoryStates.emplace_back(new VariableState(state_name,
+                                                            state_store,
+                                                            memoryNode->getBaseMemDescAtOutputPort(0),
+                                                            memoryNode->getReservedStateSize()));
             }
         }
     }
@@ -313,6 +316,8 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::execution_devices.name()),
             RO_property(ov::intel_cpu::denormals_optimization.name()),
             RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+            RO_property(ov::intel_cpu::runtime_cache_statistics.name()),
+            RO_property(ov::intel_cpu::latency_percentiles.name()),
         };
     }
 
@@ -372,6 +377,38 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
         return decltype(ov::intel_cpu::denormals_optimization)::value_type(config.denormalsOptMode == Config::DenormalsOptMode::DO_On);
     } else if (name == ov::intel_cpu::sparse_weights_decompression_rate) {
         return decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type(config.fcSparseWeiDecompressionRate);
+    } else if (name == ov::intel_cpu::runtime_cache_statistics) {
+        // the per stream caches are aggregated, the shared one is accounted only once
+        std::unordered_set<const MultiCache*> visited;
+        CacheStats stats;
+        for (auto& streamGraph : _graphs) {
+            if (!streamGraph.IsReady())
+                continue;
+            const auto cache = streamGraph.getGraphContext()->getParamsCache();
+            if (!cache)
+                continue;
+            for (const auto& c : {cache, cache->getSharedCache()}) {
+                if (c && visited.insert(c.get()).second)
+                    stats += c->getStats();
+            }
+        }
+        return decltype(ov::intel_cpu::runtime_cache_statistics)::value_type{{"HITS", stats.hits},
+                                                                            {"MISSES", stats.misses},
+                                                                            {"EVICTIONS", stats.evictions},
+                                                                            {"SIZE", stats.size}};
+    } else if (name == ov::intel_cpu::latency_percentiles) {
+        std::map<std::string, LatencyHistogram> histograms;
+        for (auto& streamGraph : _graphs) {
+            if (streamGraph.IsReady())
+                streamGraph.GetLatencyHistograms(histograms);
+        }
+        decltype(ov::intel_cpu::latency_percentiles)::value_type latencies;
+        for (const auto& histogram : histograms) {
+            latencies[histogram.first] = {{"P50", PerfClock::toMicroseconds(histogram.second.percentile(0.5))},
+                                          {"P99", PerfClock::toMicroseconds(histogram.second.percentile(0.99))},
+                                          {"MAX", PerfClock::toMicroseconds(histogram.second.max())}};
+        }
+        return latencies;
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <string>
 #include <map>
+#include <set>
 #include <vector>
 #include <tuple>
 #include <unordered_set>
@@ -13,6 +14,9 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <atomic>
+#include <exception>
+#include <thread>
 
 #include "graph.h"
 #include "graph_dumper.h"
@@ -54,6 +58,13 @@
 #include <common/primitive_desc_iface.hpp>
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
 #   include <tbb/task.h>
+#   include <tbb/task_arena.h>
+#   include <tbb/task_group.h>
+#   include <tbb/task_scheduler_observer.h>
+#endif
+#if defined(__linux__)
+#   include <sched.h>
+#   include <unistd.h>
 #endif
 
 using namespace dnnl;
@@ -386,6 +397,8 @@ void Graph::InitGraph() {
     // we disable io mem reuse for the case of dynamic shapes.
     if (haveDynNodes) {
         this->reuse_io_tensors = false;
+    } else {
+        ScheduleInterOp();
     }
 
     Allocate();
@@ -479,9 +492,262 @@ void Graph::ExtractExecutableNodes() {
             if (itr != syncNodesInds.end()) {
                 itr->second = executableGraphNodes.size();
             }
+            if (getConfig().latencyHistograms)
+                graphNode->PerfCounter().enableHistogram();
             executableGraphNodes.emplace_back(graphNode);
         }
     }
+
+    if (interOpSlots.empty())
+        return;
+
+    interOpStages.resize(interOpStageBounds.size());
+    for (const auto& node : executableGraphNodes) {
+        const auto& slot = interOpSlots[node->execIndex];
+        auto& stage = interOpStages[slot.first];
+        if (stage.size() <= static_cast<size_t>(slot.second))
+            stage.resize(slot.second + 1);
+        stage[slot.second].push_back(node);
+    }
+    // the lanes and the stages consisting of the non executable nodes only are dropped
+    bool isParallel = false;
+    for (auto& stage : interOpStages) {
+        stage.erase(std::remove_if(stage.begin(), stage.end(), [](const std::vector<NodePtr>& lane) {
+                        return lane.empty();
+                    }), stage.end());
+        isParallel |= stage.size() > 1;
+    }
+    interOpStages.erase(std::remove_if(interOpStages.begin(), interOpStages.end(),
+                                       [](const std::vector<std::vector<NodePtr>>& stage) {
+                                           return stage.empty();
+                                       }), interOpStages.end());
+    if (!isParallel)
+        interOpStages.clear();
+}
+
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+namespace {
+#if defined(__linux__)
+std::vector<int> getAffinity(pid_t pid) {
+    std::vector<int> cpus;
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if (sched_getaffinity(pid, sizeof(mask), &mask) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &mask))
+                cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+void pinCurrentThread(const std::vector<int>& cpus) {
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    for (const auto cpu : cpus)
+        CPU_SET(cpu, &mask);
+    sched_setaffinity(0, sizeof(mask), &mask);
+}
+
+// Splits the cpus of the calling stream between the lanes. The stream executor pins the threads when they enter the
+// arena of the stream, so the cpus are collected from all the threads of the stream. Empty if the stream isn't pinned.
+std::vector<std::vector<int>> splitStreamCpus(size_t numLanes) {
+    std::vector<std::vector<int>> threadCpus(parallel_get_max_threads());
+    parallel_nt(static_cast<int>(threadCpus.size()), [&](int ithr, int) {
+        threadCpus[ithr] = getAffinity(0);
+    });
+    std::set<int> uniqueCpus;
+    for (const auto& cpus : threadCpus)
+        uniqueCpus.insert(cpus.begin(), cpus.end());
+    const std::vector<int> streamCpus(uniqueCpus.begin(), uniqueCpus.end());
+    if (streamCpus.empty() || streamCpus == getAffinity(getpid()))
+        return {};
+
+    // the lanes share the cpus if there are less cpus than lanes
+    std::vector<std::vector<int>> laneCpus(numLanes);
+    const auto numCpus = streamCpus.size();
+    for (size_t i = 0; i < numLanes; i++) {
+        const auto begin = std::min(i * numCpus / numLanes, numCpus - 1);
+        const auto end = std::max(begin + 1, (i + 1) * numCpus / numLanes);
+        laneCpus[i].assign(streamCpus.begin() + begin, streamCpus.begin() + end);
+    }
+    return laneCpus;
+}
+
+// Pins the threads entering the arena of a lane to the cpus of the lane. The threads may come from another arena
+// (e.g. the one of the stream), so their previous affinity is restored on exit.
+class LanePinningObserver : public tbb::task_scheduler_observer {
+public:
+    LanePinningObserver(tbb::task_arena& arena, std::vector<int> cpus)
+        : tbb::task_scheduler_observer(arena), cpus(std::move(cpus)) {
+        observe(true);
+    }
+
+    ~LanePinningObserver() override {
+        observe(false);
+    }
+
+    void on_scheduler_entry(bool) override {
+        savedCpus().push_back(getAffinity(0));
+        pinCurrentThread(cpus);
+    }
+
+    void on_scheduler_exit(bool) override {
+        auto& saved = savedCpus();
+        if (saved.empty())
+            return;
+        pinCurrentThread(saved.back());
+        saved.pop_back();
+    }
+
+private:
+    static std::vector<std::vector<int>>& savedCpus() {
+        thread_local std::vector<std::vector<int>> saved;
+        return saved;
+    }
+
+    std::vector<int> cpus;
+};
+#endif
+}   // namespace
+
+struct Graph::InterOpArenas {
+    std::vector<std::unique_ptr<tbb::task_arena>> lanes;
+    std::vector<dnnl::stream> streams;
+#if defined(__linux__)
+    // are destroyed before the arenas they observe
+    std::vector<std::unique_ptr<LanePinningObserver>> observers;
+#endif
+};
+#else
+struct Graph::InterOpArenas {};
+#endif
+
+void Graph::ScheduleInterOp() {
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    const size_t maxLanes = getConfig().interOpParallelism;
+    if (maxLanes < 2)
+        return;
+    // the execution order of the state nodes is not expressed by the edges,
+    // and the inner graphs use the scratch pads of the outer one
+    for (const auto& node : graphNodes) {
+        if (one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput, Type::TensorIterator, Type::If))
+            return;
+    }
+
+    // The graph is split into branches: the chains of the nodes where each node is the only consumer of the previous
+    // one. Every branch belongs to the stage next to the latest stage of the branches it consumes, so the branches of
+    // the same stage are independent. The constant nodes are executed on the graph creation and are not scheduled.
+    struct Branch {
+        std::vector<NodePtr> nodes;
+        size_t stage;
+    };
+    std::vector<Branch> branches;
+    std::unordered_map<Node*, size_t> nodeBranch;
+    auto countConsumers = [](const Node* node) {
+        std::vector<const Node*> consumers;
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            const auto child = node->getChildEdgeAt(i)->getChild().get();
+            if (!child->isConstant() && std::find(consumers.begin(), consumers.end(), child) == consumers.end())
+                consumers.push_back(child);
+        }
+        return consumers.size();
+    };
+    size_t numStages = 0;
+    for (const auto& node : graphNodes) {
+        if (node->isConstant())
+            continue;
+        std::vector<Node*> producers;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto parent = node->getParentEdgeAt(i)->getParent().get();
+            if (!parent->isConstant() && std::find(producers.begin(), producers.end(), parent) == producers.end())
+                producers.push_back(parent);
+        }
+        if (producers.size() == 1 && countConsumers(producers.front()) == 1) {
+            const auto branchIdx = nodeBranch.at(producers.front());
+            branches[branchIdx].nodes.push_back(node);
+            nodeBranch[node.get()] = branchIdx;
+            continue;
+        }
+        size_t stage = 0;
+        for (const auto producer : producers)
+            stage = std::max(stage, branches[nodeBranch.at(producer)].stage + 1);
+        nodeBranch[node.get()] = branches.size();
+        branches.push_back({{node}, stage});
+        numStages = std::max(numStages, stage + 1);
+    }
+
+    std::vector<std::vector<size_t>> stageBranches(numStages);
+    for (size_t i = 0; i < branches.size(); i++)
+        stageBranches[branches[i].stage].push_back(i);
+    if (std::all_of(stageBranches.begin(), stageBranches.end(), [](const std::vector<size_t>& stage) {
+            return stage.size() < 2;
+        })) {
+        return;
+    }
+
+    // The nodes are reordered stage by stage and lane by lane, so the execution indices of a stage are contiguous.
+    // The branches of a stage are distributed over the lanes starting from the largest one to the least loaded lane.
+    std::vector<NodePtr> sorted;
+    for (const auto& node : graphNodes) {
+        if (node->isConstant())
+            sorted.push_back(node);
+    }
+    interOpSlots.assign(sorted.size(), {-1, -1});
+    size_t usedLanes = 1;
+    for (size_t stageIdx = 0; stageIdx < numStages; stageIdx++) {
+        auto& stage = stageBranches[stageIdx];
+        std::stable_sort(stage.begin(), stage.end(), [&](size_t lhs, size_t rhs) {
+            return branches[lhs].nodes.size() > branches[rhs].nodes.size();
+        });
+        const size_t numLanes = std::min(maxLanes, stage.size());
+        usedLanes = std::max(usedLanes, numLanes);
+        std::vector<std::vector<size_t>> lanes(numLanes);
+        std::vector<size_t> laneSizes(numLanes, 0);
+        for (const auto branchIdx : stage) {
+            const auto lane = std::distance(laneSizes.begin(), std::min_element(laneSizes.begin(), laneSizes.end()));
+            lanes[lane].push_back(branchIdx);
+            laneSizes[lane] += branches[branchIdx].nodes.size();
+        }
+
+        const int first = static_cast<int>(sorted.size());
+        for (size_t lane = 0; lane < numLanes; lane++) {
+            for (const auto branchIdx : lanes[lane]) {
+                for (const auto& node : branches[branchIdx].nodes) {
+                    // the concurrently executed nodes must not share the scratch pad
+                    if (numLanes > 1)
+                        node->scratchPadIndex = static_cast<int>(lane);
+                    sorted.push_back(node);
+                    interOpSlots.emplace_back(static_cast<int>(stageIdx), static_cast<int>(lane));
+                }
+            }
+        }
+        const int last = static_cast<int>(sorted.size()) - 1;
+        interOpStageBounds.emplace_back(numLanes > 1 ? std::make_pair(first, last) : std::make_pair(-1, -1));
+    }
+
+    for (size_t i = 0; i < sorted.size(); i++)
+        sorted[i]->execIndex = static_cast<int>(i);
+    graphNodes.swap(sorted);
+
+    // The arenas and the streams of the lanes are created once, the graph is created by the thread of its stream.
+    // The threads of the stream are shared evenly between the lanes, and so are its cpus if the stream is pinned.
+    interOpArenas = std::make_shared<InterOpArenas>();
+    const auto laneThreads = std::max(1, parallel_get_max_threads() / static_cast<int>(usedLanes));
+#if defined(__linux__)
+    const auto laneCpus = splitStreamCpus(usedLanes);
+#endif
+    for (size_t i = 0; i < usedLanes; i++) {
+        interOpArenas->lanes.emplace_back(new tbb::task_arena(laneThreads));
+        interOpArenas->streams.emplace_back(getEngine());
+#if defined(__linux__)
+        if (!laneCpus.empty()) {
+            interOpArenas->lanes.back()->initialize();
+            interOpArenas->observers.emplace_back(new LanePinningObserver(*interOpArenas->lanes.back(), laneCpus[i]));
+        }
+#endif
+    }
+#endif
 }
 
 void Graph::CreatePrimitivesAndExecConstants() const {
@@ -710,14 +976,23 @@ void Graph::AllocateWithReuse() {
 
     const int64_t alignment = 32;  // 32 bytes
 
+    // The nodes of the concurrently executed lanes may run in any order relative to each other, so a tensor
+    // produced or consumed by such a node is considered alive during the whole stage of the node
+    auto stageBounds = [this](int execIndex) {
+        if (interOpSlots.empty() || interOpSlots[execIndex].first < 0)
+            return std::make_pair(execIndex, execIndex);
+        const auto& bounds = interOpStageBounds[interOpSlots[execIndex].first];
+        return bounds.first < 0 ? std::make_pair(execIndex, execIndex) : bounds;
+    };
+
     std::vector<MemorySolver::Box> definedBoxes;
     std::vector<MemorySolver::Box> undefinedBoxes;
     for (int i = 0; i < edge_clusters.size(); i++) {
         MemorySolver::Box box = { std::numeric_limits<int>::max(), 0, 0, i };
         int64_t boxSize = 0;
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = stageBounds(edge->getParent()->execIndex).first;
+            int e_finish = stageBounds(edge->getChild()->execIndex).second;
 
             if (boxSize != -1 && edge->getDesc().isDefined()) {
                 int64_t e_size = edge->getDesc().getCurrentMemSize();  // size in bytes (from the beginning of data to the last element)
@@ -818,9 +1093,43 @@ void Graph::AllocateWithReuse() {
 
         MemorySolver::normalizeBoxes(undefinedBoxes);
 
+        if (getConfig().dynShapeBuckets > 0) {
+            // The intermediate tensors get their own memory managers which are bound to the arena of the shape bucket
+            // selected on each inference. Input and output tensors are excluded, since their memory is filled
+            // (or may be replaced by the user memory) outside of the nodes execution.
+            dynMemPlan = std::make_shared<ShapeBucketsMemPlan>(getEngine(), getConfig().dynShapeBuckets, alignment);
+            auto isIOBox = [&](const MemorySolver::Box& box) {
+                for (auto& edge : edge_clusters[box.id]) {
+                    if (edge->getChild()->getType() == Type::Output || edge->getParent()->getType() == Type::Input)
+                        return true;
+                }
+                return false;
+            };
+            std::vector<MemorySolver::Box> ioBoxes;
+            for (auto& box : undefinedBoxes) {
+                if (isIOBox(box)) {
+                    ioBoxes.push_back(box);
+                    continue;
+                }
+                auto boxMemMngr =
+                    std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse()));
+                std::vector<EdgePtr> boxEdges;
+                for (auto& edge : edge_clusters[box.id]) {
+                    if (edge->getStatus() == Edge::Status::NeedAllocation) {
+                        edge->allocate(boxMemMngr);
+                    }
+                    boxEdges.push_back(edge);
+                }
+                dynMemPlan->addBox(box, boxMemMngr, std::move(boxEdges));
+            }
+            undefinedBoxes.swap(ioBoxes);
+        }
+
         std::vector<std::vector<MemorySolver::Box>> groups; //groups of nonoverlapping boxes
         constexpr bool enableMemReuse = true; // set false to disable mem reuse for debug purposes
-        if (enableMemReuse) {
+        if (undefinedBoxes.empty()) {
+            // all the boxes are handled by the shape buckets memory plan
+        } else if (enableMemReuse) {
             groups.push_back({undefinedBoxes.front()});
             for (size_t i = 1; i < undefinedBoxes.size(); ++i) {
                 const auto& box = undefinedBoxes[i];
@@ -888,6 +1197,10 @@ void Graph::PushInputData(const std::string& name, const InferenceEngine::Blob::
         const void *ext_data_ptr = in->cbuffer();
         void *inter_data_ptr = childEdge->getMemory().GetData();
 
+        InferTraceDataHelper trace(inferTrace, InferenceTrace::Category::Input, name);
+        if (trace.active())
+            trace.setDetails(in->byteSize(), {{"copy", ext_data_ptr != inter_data_ptr ? "true" : "false"}});
+
         if (ext_data_ptr != inter_data_ptr) {
             auto ext_tdesc = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(in->getTensorDesc());
 
@@ -920,6 +1233,7 @@ void Graph::PullOutputData(BlobMap &out) {
         auto node = outputMap.second;
         auto parentEdge = node->getParentEdgeAt(0);
         const Memory& intr_blob = parentEdge->getMemory();
+        InferTraceDataHelper trace(inferTrace, InferenceTrace::Category::Output, name);
 
         const auto ext_blob_map = out.find(name);
         const auto ext_blob = ext_blob_map->second;
@@ -968,6 +1282,13 @@ void Graph::PullOutputData(BlobMap &out) {
         void *ext_blob_ptr = ext_blob->buffer();
         void *intr_blob_ptr = intr_blob.GetData();
 
+        if (trace.active()) {
+            const bool reorder = actualDesc.getBlockingDesc() != expectedDesc.getBlockingDesc() && !isScalarOutput;
+            trace.setDetails(intr_blob.GetSize(), {{"copy", ext_blob_ptr != intr_blob_ptr ? "true" : "false"},
+                                                   {"convert", srcPrec != dstPrec ? "true" : "false"},
+                                                   {"reorder", reorder ? "true" : "false"}});
+        }
+
         // That is the same memory. No need to copy
         if (ext_blob_ptr == intr_blob_ptr) continue;
 
@@ -1002,7 +1323,8 @@ void Graph::InferStatic(InferRequestBase* request) {
 
     for (const auto& node : executableGraphNodes) {
         VERBOSE(node, getConfig().debugCaps.verbose);
-        PERF(node, getConfig().collectPerfCounters);
+        PERF(node, getConfig().collectPerfCounters || getConfig().latencyHistograms);
+        INFER_TRACE(inferTrace, node);
 
         if (request)
             request->ThrowIfCanceled();
@@ -1010,11 +1332,60 @@ void Graph::InferStatic(InferRequestBase* request) {
     }
 }
 
+void Graph::InferInterOp(InferRequestBase* request) {
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    auto executeLane = [&](const std::vector<NodePtr>& lane, const dnnl::stream& stream) {
+        for (const auto& node : lane) {
+            VERBOSE(node, getConfig().debugCaps.verbose);
+            PERF(node, getConfig().collectPerfCounters || getConfig().latencyHistograms);
+            INFER_TRACE(inferTrace, node);
+
+            if (request)
+                request->ThrowIfCanceled();
+            ExecuteNode(node, stream);
+        }
+    };
+
+    for (const auto& stage : interOpStages) {
+        if (stage.size() == 1) {
+            // the single lane uses all the threads of the stream
+            executeLane(stage.front(), interOpArenas->streams.front());
+            continue;
+        }
+        tbb::task_group lanes;
+        for (size_t i = 1; i < stage.size(); i++) {
+            lanes.run([&, i] {
+                interOpArenas->lanes[i]->execute([&] {
+                    executeLane(stage[i], interOpArenas->streams[i]);
+                });
+            });
+        }
+        // the other lanes refer to the stage, so they are waited for even if the first one fails
+        std::exception_ptr error;
+        try {
+            interOpArenas->lanes[0]->execute([&] {
+                executeLane(stage.front(), interOpArenas->streams.front());
+            });
+        } catch (...) {
+            error = std::current_exception();
+        }
+        lanes.wait();
+        if (error)
+            std::rethrow_exception(error);
+    }
+#else
+    InferStatic(request);
+#endif
+}
+
 namespace {
 
 class IUpdateNodes {
 public:
     virtual void run(size_t stopIndx) = 0;
+    // the node is ready to be executed once the call returns
+    virtual void prepare(size_t /*nodeIndx*/) {}
+    virtual void executed(size_t /*nodeIndx*/) {}
     virtual ~IUpdateNodes() = default;
 };
 
@@ -1177,6 +1548,139 @@ public:
 #endif
 #endif
 
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+/**
+ * Updates the shapes of the segment nodes on the calling thread like the other implementations do, while the
+ * primitives are prepared by a helper task which runs ahead of the execution by up to 'lookahead' nodes.
+ * The memory may be reallocated by the shape update, so the shapes of the whole segment are still updated
+ * before its execution. The nodes closer than 'lookahead + 1' by the execution index use different scratch pads,
+ * so the node prepared by the helper never reallocates the scratch pad of the node being executed.
+ * The helper never blocks: it quits once it reaches the end of the window and is resumed when the execution moves
+ * forward, the node not prepared by the helper yet is prepared by the executing thread itself.
+ */
+class UpdateNodesPipelined : public IUpdateNodes {
+public:
+    UpdateNodesPipelined(std::vector<NodePtr>& executableGraphNodes, size_t lookahead)
+        : m_executableGraphNodes(executableGraphNodes), m_lookahead(lookahead) {}
+
+    ~UpdateNodesPipelined() override {
+        m_cancelled.store(true);
+        m_helper->wait();
+    }
+
+    void run(size_t stopIndx) override {
+        m_helper->wait();
+        m_stopIndx = stopIndx;
+        for (size_t i = m_shapesCounter.load(); i < stopIndx; i++) {
+            const auto& node = m_executableGraphNodes[i];
+            if (node->isDynamicNode()) {
+                node->updateShapes();
+            }
+            m_shapesCounter.store(i + 1, std::memory_order_release);
+            resume();
+        }
+    }
+
+    void prepare(size_t nodeIndx) override {
+        size_t expected = nodeIndx;
+        if (m_claimCounter.compare_exchange_strong(expected, nodeIndx + 1)) {
+            updateParams(nodeIndx);
+            return;
+        }
+        while (m_preparedCounter.load(std::memory_order_acquire) <= nodeIndx) {
+            if (m_failed.load(std::memory_order_acquire)) {
+                std::rethrow_exception(m_error);
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    void executed(size_t nodeIndx) override {
+        m_executedCounter.store(nodeIndx + 1, std::memory_order_release);
+        resume();
+    }
+
+private:
+    void updateParams(size_t nodeIndx) {
+        const auto& node = m_executableGraphNodes[nodeIndx];
+        if (node->isDynamicNode()) {
+            node->updateDynamicParams();
+        }
+        // the node may be prepared by the executing thread while the helper prepares the next one
+        size_t prepared = m_preparedCounter.load(std::memory_order_relaxed);
+        while (prepared <= nodeIndx &&
+               !m_preparedCounter.compare_exchange_weak(prepared, nodeIndx + 1, std::memory_order_release)) {}
+    }
+
+    bool canPrepare(size_t nodeIndx) const {
+        if (m_cancelled.load(std::memory_order_relaxed) || m_failed.load(std::memory_order_relaxed) ||
+            nodeIndx >= m_stopIndx || nodeIndx >= m_shapesCounter.load(std::memory_order_acquire)) {
+            return false;
+        }
+        const size_t executing = m_executedCounter.load(std::memory_order_acquire);
+        if (nodeIndx == executing) {
+            // the node is waited for, so nothing is being executed
+            return true;
+        }
+        const auto distance = m_executableGraphNodes[nodeIndx]->getExecIndex() -
+                              m_executableGraphNodes[executing]->getExecIndex();
+        if (distance > static_cast<int>(m_lookahead)) {
+            return false;
+        }
+        // the inner graphs share the scratch pads of the outer one, so nothing is prepared ahead of them
+        for (size_t i = executing; i <= nodeIndx; i++) {
+            if (one_of(m_executableGraphNodes[i]->getType(), Type::TensorIterator, Type::If)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void prepareAhead() {
+        while (true) {
+            try {
+                size_t nodeIndx = m_claimCounter.load(std::memory_order_acquire);
+                while (canPrepare(nodeIndx)) {
+                    if (m_claimCounter.compare_exchange_weak(nodeIndx, nodeIndx + 1)) {
+                        updateParams(nodeIndx++);
+                    }
+                }
+            } catch (...) {
+                m_error = std::current_exception();
+                m_failed.store(true, std::memory_order_release);
+            }
+            m_helperActive.store(false);
+            // the execution might move forward after the last check without resuming the helper
+            if (!canPrepare(m_claimCounter.load()) || m_helperActive.exchange(true)) {
+                break;
+            }
+        }
+    }
+
+    void resume() {
+        if (canPrepare(m_claimCounter.load()) && !m_helperActive.exchange(true)) {
+            m_helper->run([this] {
+                prepareAhead();
+            });
+        }
+    }
+
+    std::vector<NodePtr>& m_executableGraphNodes;
+    const size_t m_lookahead;
+    size_t m_stopIndx = 0;
+    std::atomic<size_t> m_shapesCounter{0};
+    std::atomic<size_t> m_claimCounter{0};
+    std::atomic<size_t> m_preparedCounter{0};
+    std::atomic<size_t> m_executedCounter{0};
+    std::atomic<bool> m_helperActive{false};
+    std::atomic<bool> m_cancelled{false};
+    std::atomic<bool> m_failed{false};
+    std::exception_ptr m_error;
+    // the destructor of the task group may throw, while the one of the updater is not allowed to
+    std::unique_ptr<tbb::task_group> m_helper{new tbb::task_group};
+};
+#endif
+
 #if (OV_THREAD == OV_THREAD_OMP)
 class UpdateNodes : public UpdateNodesBase {
 public:
@@ -1220,24 +1724,75 @@ void Graph::InferDynamic(InferRequestBase* request) {
 
     std::unique_ptr<IUpdateNodes> updateNodes{};
     if (parallel_get_max_threads() > 1) {
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+        if (getConfig().prepareLookahead > 0) {
+            updateNodes.reset(new UpdateNodesPipelined(executableGraphNodes, getConfig().prepareLookahead));
+        } else {
+            updateNodes.reset(new UpdateNodes(executableGraphNodes));
+        }
+#else
         updateNodes.reset(new UpdateNodes(executableGraphNodes));
+#endif
     } else {
         updateNodes.reset(new UpdateNodesSeq(executableGraphNodes));
     }
     size_t inferCounter = 0;
 
+    if (dynMemPlan) {
+        std::vector<VectorDims> inputDims;
+        inputDims.reserve(inputNodesMap.size());
+        for (const auto& input : inputNodesMap) {
+            const auto& node = input.second;
+            inputDims.push_back(node->getChildEdges().empty() ? VectorDims{}
+                                                              : node->getChildEdgeAt(0)->getMemory().getStaticDims());
+        }
+        dynMemPlan->select(inputDims);
+    }
+
     for (auto stopIndx : syncIndsWorkSet) {
         updateNodes->run(stopIndx);
         for (; inferCounter < stopIndx; ++inferCounter) {
             auto& node = executableGraphNodes[inferCounter];
             VERBOSE(node, getConfig().debugCaps.verbose);
-            PERF(node, getConfig().collectPerfCounters);
+            PERF(node, getConfig().collectPerfCounters || getConfig().latencyHistograms);
+            INFER_TRACE(inferTrace, node);
 
             if (request)
                 request->ThrowIfCanceled();
+            updateNodes->prepare(inferCounter);
             ExecuteNode(node, stream);
+            updateNodes->executed(inferCounter);
         }
     }
+
+    if (dynMemPlan) {
+        dynMemPlan->update();
+    }
+}
+
+void Graph::PrepareDynamic() {
+    if (Status::ReadyDynamic != status)
+        return;
+
+    size_t stopIndx = executableGraphNodes.size();
+    for (const auto& nodeIndx : syncNodesInds)
+        stopIndx = std::min(stopIndx, nodeIndx.second);
+
+    try {
+        UpdateNodesSeq(executableGraphNodes).run(stopIndx);
+    } catch (...) {
+        // the shapes and the primitives of the nodes may be partially updated, so they are reset completely
+        for (const auto& node : executableGraphNodes)
+            node->lastInputDims.clear();
+        throw;
+    }
+    // the prepared nodes are in the same state as the executed ones, otherwise the next inference with the shapes of
+    // the previous execution would skip the shape inference of the nodes which outputs are redefined here
+    for (size_t i = 0; i < stopIndx; i++) {
+        const auto& node = executableGraphNodes[i];
+        if (node->isDynamicNode())
+            node->updateLastInputDims();
+    }
 }
 
 inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const {
@@ -1261,7 +1816,10 @@ void Graph::Infer(InferRequestBase* request) {
     if (Status::ReadyDynamic == status) {
         InferDynamic(request);
     } else if (Status::ReadyStatic == status) {
-        InferStatic(request);
+        if (interOpStages.empty())
+            InferStatic(request);
+        else
+            InferInterOp(request);
     } else {
         IE_THROW() << "Unknown ov::intel_cpu::Graph state: " << static_cast<size_t>(status);
     }
@@ -1269,6 +1827,20 @@ void Graph::Infer(InferRequestBase* request) {
     if (infer_count != -1) infer_count++;
 }
 
+void Graph::StartTrace() {
+    if (getConfig().inferenceTracePath.empty())
+        return;
+    if (!inferTrace)
+        inferTrace = std::make_shared<InferenceTrace>(getConfig().inferenceTracePath, getConfig().inferenceTracePeriod,
+                                                      _name, graphNodes);
+    inferTrace->start();
+}
+
+void Graph::FinishTrace() {
+    if (inferTrace)
+        inferTrace->finish();
+}
+
 void Graph::VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -1387,6 +1959,14 @@ void Graph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEnginePr
     }
 }
 
+void Graph::GetLatencyHistograms(std::map<std::string, LatencyHistogram> &histograms) const {
+    for (const auto& node : executableGraphNodes) {
+        const auto histogram = node->PerfCounter().getHistogram();
+        if (histogram && histogram->count() > 0)
+            histograms[node->getName()].merge(*histogram);
+    }
+}
+
 void Graph::RemoveEdge(EdgePtr& edge) {
     for (auto it = graphEdges.begin(); it != graphEdges.end(); it++) {
         if ((*it) == edge) {
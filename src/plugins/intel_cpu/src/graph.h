@@ -13,6 +13,9 @@
 #include "cache/multi_cache.h"
 #include "dnnl_scratch_pad.h"
 #include "graph_context.h"
+#include "shape_buckets_mem_plan.h"
+#include "infer_trace.h"
+#include "perf_count.h"
 #include <map>
 #include <string>
 #include <vector>
@@ -63,6 +66,19 @@ public:
 
     void Infer(InferRequestBase* request = nullptr);
 
+    // Starts the trace of the inference if it is sampled (see Config::inferenceTracePath), must be called before the
+    // input data are pushed
+    void StartTrace();
+    // Hands the trace of the sampled inference to the background writer, must be called after the output data are
+    // pulled
+    void FinishTrace();
+
+    // Updates the shapes and prepares the primitives of a dynamic graph without executing it. The nodes are prepared up
+    // to the first one which output shapes depend on the data, so only the input shapes must be defined.
+    // The prepared nodes are not prepared again by the next inference with the same input shapes. If the preparation
+    // fails, all the nodes are prepared again by the next inference and the exception is rethrown.
+    void PrepareDynamic();
+
     const std::vector<NodePtr>& GetNodes() const {
         return graphNodes;
     }
@@ -114,6 +130,8 @@ public:
     }
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
+    // Merges the latency histograms of the executed nodes into the histograms by the node name
+    void GetLatencyHistograms(std::map<std::string, LatencyHistogram> &histograms) const;
 
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
@@ -213,6 +231,12 @@ protected:
         graphEdges.clear();
         _normalizePreprocMap.clear();
         syncNodesInds.clear();
+        dynMemPlan.reset();
+        interOpStages.clear();
+        interOpSlots.clear();
+        interOpStageBounds.clear();
+        interOpArenas.reset();
+        inferTrace.reset();
     }
     Status status { Status::NotReady };
 
@@ -223,6 +247,10 @@ protected:
     bool reuse_io_tensors = true;
 
     MemoryPtr memWorkspace;
+    // precomputed memory plans for the dynamic tensors, is not used for static graphs
+    ShapeBucketsMemPlan::Ptr dynMemPlan;
+    // timeline of the sampled inferences, created on the first traced inference
+    InferenceTrace::Ptr inferTrace;
 
     std::vector<NodePtr> graphNodes;
     std::vector<EdgePtr> graphEdges;
@@ -244,7 +272,9 @@ protected:
     void ExtractExecutableNodes();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
     void CreatePrimitivesAndExecConstants() const;
+    void ScheduleInterOp();
     void InferStatic(InferRequestBase* request);
+    void InferInterOp(InferRequestBase* request);
     void InferDynamic(InferRequestBase* request);
 
     friend class LegacyInferRequest;
@@ -264,6 +294,18 @@ private:
 
     std::unordered_map<Node*, size_t> syncNodesInds;
 
+    // The inter-op parallel execution plan of a static graph. The stages are executed one after another,
+    // the lanes of a stage are executed concurrently and each lane executes its nodes sequentially.
+    // Empty if the graph is executed sequentially.
+    std::vector<std::vector<std::vector<NodePtr>>> interOpStages;
+    // the stage and the lane of every non constant node indexed by the execution index
+    std::vector<std::pair<int, int>> interOpSlots;
+    // the first and the last execution indices of every stage
+    std::vector<std::pair<int, int>> interOpStageBounds;
+    // the arenas and the streams of the lanes, created with the plan and pinned to the cpus of the graph's stream
+    struct InterOpArenas;
+    std::shared_ptr<InterOpArenas> interOpArenas;
+
     GraphContext::CPtr context;
 
     // this field stores the dynamic batch value to provide backward compatibility
@@ -9,6 +9,10 @@
 #include "dnnl_scratch_pad.h"
 #include "extension_mngr.h"
 #include "weights_cache.hpp"
+#include "weights_file_cache.hpp"
+
+#include <algorithm>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
@@ -26,8 +30,17 @@ public:
           extensionManager(extensionManager),
           weightsCache(w_cache),
           isGraphQuantizedFlag(isGraphQuantized) {
-        rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
-        rtScratchPad = std::make_shared<DnnlScratchPad>(eng);
+        // only the stateless values are shared, the stateful executors stay in the cache of the stream
+        rtParamsCache = config.rtCacheSharing
+                            ? std::make_shared<MultiCache>(config.rtCacheCapacity,
+                                                           MultiCache::getSharedInstance(config.rtCacheCapacity))
+                            : std::make_shared<MultiCache>(config.rtCacheCapacity);
+        // nodes prepared ahead of the executed one must not share its scratch pad,
+        // so every node of the lookahead window gets its own one, as well as every lane of the inter-op execution
+        for (size_t i = 0; i < std::max(config.prepareLookahead + 1, config.interOpParallelism); i++)
+            rtScratchPads.push_back(std::make_shared<DnnlScratchPad>(eng));
+        if (!config.weightsCacheDir.empty())
+            weightsFileCache = std::make_shared<WeightsFileCache>(config.weightsCacheDir);
     }
 
     const Config& getConfig() const {
@@ -42,13 +55,16 @@ public:
         return weightsCache;
     }
 
+    WeightsFileCache::Ptr getWeightsFileCache() const {
+        return weightsFileCache;
+    }
 
     MultiCachePtr getParamsCache() const {
         return rtParamsCache;
     }
 
-    DnnlScratchPadPtr getScratchPad() const {
-        return rtScratchPad;
+    DnnlScratchPadPtr getScratchPad(size_t idx = 0) const {
+        return rtScratchPads[idx % rtScratchPads.size()];
     }
 
     dnnl::engine getEngine() const {
@@ -64,9 +80,11 @@ private:
 
     ExtensionManager::Ptr extensionManager;
     WeightsSharing::Ptr weightsCache;         // per NUMA node caches for sharing weights data
+    WeightsFileCache::Ptr weightsFileCache;   // persistent storage of the reordered weights
 
     MultiCachePtr rtParamsCache;     // primitive cache
-    DnnlScratchPadPtr rtScratchPad;  // scratch pad
+    std::vector<DnnlScratchPadPtr> rtScratchPads;  // scratch pads, one per node of the prepare lookahead window
+                                                   // or per lane of the inter-op execution
 
     bool isGraphQuantizedFlag = false;
     static dnnl::engine eng;  // onednn engine (singleton)
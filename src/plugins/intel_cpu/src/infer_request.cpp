@@ -7,6 +7,7 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <unordered_set>
 #include <blob_factory.hpp>
 #include "nodes/concat.h"
 #include "nodes/split.h"
@@ -56,7 +57,10 @@ void InferRequestBase::CreateInferRequest() {
             if (suffix_idx != std::string::npos)
                 state_name = state_name.substr(0, suffix_idx);
 
-            memoryStates.emplace_back(new VariableState(state_name, state_store));
+            memoryStates.emplace_back(new VariableState(state_name,
+                                                        state_store,
+                                                        memoryNode->getBaseMemDescAtOutputPort(0),
+                                                        memoryNode->getReservedStateSize()));
         }
     }
 }
@@ -92,7 +96,51 @@ void InferRequestBase::pushInput(const std::string& inputName, InferenceEngine::
     graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
 }
 
+static inline void changeEdgePtr(const EdgePtr &edge, void *newPtr) {
+    edge->getMemoryPtr()->setDataHandle(newPtr);
+}
+
+static std::shared_ptr<VariableState> findState(
+        const std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>>& memoryStates,
+        const std::string& id) {
+    for (const auto& state : memoryStates) {
+        if (state->GetName() == id) {
+            auto cpuState = std::dynamic_pointer_cast<VariableState>(state);
+            if (!cpuState) {
+                IE_THROW() << "Cannot cast variable state " << id << " to the CPU VariableState";
+            }
+            return cpuState;
+        }
+    }
+    return nullptr;
+}
+
 void InferRequestBase::PushStates() {
+    // the graph reads and writes the state buffers of this request directly, so there is nothing to copy
+    std::unordered_set<std::string> assigned;
+    for (auto &node : graph->GetNodes()) {
+        if (node->getType() == Type::MemoryOutput) {
+            auto cur_node = dynamic_cast<node::MemoryOutput*>(node.get());
+            if (!cur_node) {
+                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryOutput";
+            }
+            auto cur_state = findState(memoryStates, cur_node->getId());
+            if (!cur_state)
+                continue;
+            assigned.insert(cur_node->getId());
+            // the memory of the dynamic state is bound by the MemoryInput node
+            if (node->isDynamicNode())
+                continue;
+            auto cur_state_mem = cur_state->getNextMemory();
+            auto parentEdge = cur_node->getParentEdgeAt(0);
+            if (parentEdge->getMemory().GetData() != cur_state_mem->GetData() &&
+                parentEdge->getMemory().getDesc().isCompatible(cur_state_mem->getDesc()) &&
+                canChangeParentEdgePtr(parentEdge)) {
+                changeEdgePtr(parentEdge, cur_state_mem->GetData());
+            }
+        }
+    }
+
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == Type::MemoryInput) {
             auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
@@ -100,14 +148,24 @@ void InferRequestBase::PushStates() {
                 IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
             }
             auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+            auto cur_state = findState(memoryStates, cur_id);
+            if (!cur_state)
+                continue;
+            auto cur_state_mem = cur_state->getCurrentMemory();
+            // the variable without Assign keeps its value
+            cur_node->setStateMemory(cur_state_mem,
+                                     assigned.count(cur_id) ? cur_state->getNextMemory() : cur_state_mem);
+            if (node->isDynamicNode())
+                continue;
+            // the parent edge of the Assign may be the same one, it is already redirected to the next state then
+            if (cur_node->getChildEdgeAt(0)->getMemory().GetData() != cur_state->getNextMemory()->GetData() &&
+                canChangeChildEdgesPtr(node)) {
+                for (auto& edge : node->getChildEdges()) {
+                    auto e = edge.lock();
+                    if (!e)
+                        IE_THROW() << "Node " << node->getName() << " contains empty child edge";
+
+                    changeEdgePtr(e, cur_state_mem->GetData());
                 }
             }
         }
@@ -116,22 +174,14 @@ void InferRequestBase::PushStates() {
 
 void InferRequestBase::PullStates() {
     for (auto &node : graph->GetNodes()) {
-        if (node->getType() == Type::MemoryInput) {
-            auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
+        if (node->getType() == Type::MemoryOutput) {
+            auto cur_node = dynamic_cast<node::MemoryOutput*>(node.get());
             if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
+                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryOutput";
             }
+            auto cur_state = findState(memoryStates, cur_node->getId());
+            if (cur_state)
+                cur_state->commit();
         }
     }
 }
@@ -168,6 +218,7 @@ void InferRequestBase::InferImpl() {
 
     ThrowIfCanceled();
 
+    graph->StartTrace();
     PushInputData();
 
     if (memoryStates.size() != 0) {
@@ -183,6 +234,7 @@ void InferRequestBase::InferImpl() {
     ThrowIfCanceled();
 
     graph->PullOutputData(_outputs);
+    graph->FinishTrace();
 }
 
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> InferRequestBase::GetPerformanceCounts() const {
@@ -193,10 +245,6 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> InferRequestB
     return perfMap;
 }
 
-static inline void changeEdgePtr(const EdgePtr &edge, void *newPtr) {
-    edge->getMemoryPtr()->setDataHandle(newPtr);
-}
-
 void InferRequestBase::changeDefaultPtr() {
     for (auto& it : externalPtr) {
         const auto& inputNodesMap = graph->GetInputNodesMap();
@@ -205,57 +253,9 @@ void InferRequestBase::changeDefaultPtr() {
             NodePtr inputNodePtr = input->second;
             if (inputNodePtr->getChildEdgeAt(0)->getMemory().GetData() == it.second)
                 continue;
-            auto& childEdges = inputNodePtr->getChildEdges();
             // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
-            for (auto& childEdge : childEdges) {
-                auto ce = childEdge.lock();
-                if (!ce)
-                    IE_THROW() << "Node " << inputNodePtr->getName() << " contains empty child edge";
-
-                auto& child = ce->getChild();
-
-                if (child->isConstant()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                if (child->getType() == Type::Concatenation) {
-                    auto concat = dynamic_cast<node::Concat*>(child.get());
-                    if (concat && concat->isOptimized()) {
-                        canBeInPlace = false;
-                        break;
-                    }
-                }
-
-                // Cannot be in-place before split because split is using different ptrs without offsets
-                if (child->getType() == Type::Split) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                if (child->isInPlace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                auto& edges = child->getChildEdges();
-                for (auto& edge : edges) {
-                    auto e = edge.lock();
-                    if (!e)
-                        IE_THROW() << "Node " << child->getName() << " contains empty child edge";
-
-                    if (e->getMemory().GetData() == ce->getMemory().GetData()) {
-                        canBeInPlace = false;
-                        break;
-                    }
-                }
-
-                if (!canBeInPlace)
-                    break;
-            }
-            if (canBeInPlace) {
-                for (auto& edge : childEdges) {
+            if (canChangeChildEdgesPtr(inputNodePtr)) {
+                for (auto& edge : inputNodePtr->getChildEdges()) {
                     auto e = edge.lock();
                     if (!e)
                         IE_THROW() << "Node " << inputNodePtr->getName() << " contains empty child edge";
@@ -274,31 +274,7 @@ void InferRequestBase::changeDefaultPtr() {
             if (parentEdge->getMemory().GetData() == it.second)
                 continue;
 
-            bool canBeInPlace = true;
-            void* defaultPtr = parentEdge->getMemory().GetData();
-            // Cannot be in-place after concat because concat is using different ptrs without offsets
-            auto parent = parentEdge->getParent();
-            NodePtr previousParent;
-            do {
-                previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                auto& parentEdges = parent->getParentEdges();
-                for (auto& edge : parentEdges) {
-                    auto e = edge.lock();
-                    if (!e)
-                        IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
-
-                    if (e->getMemory().GetData() == defaultPtr) {
-                        parent = e->getParent();
-                        break;
-                    }
-                }
-            } while (previousParent != parent);
-            if (canBeInPlace)
+            if (canChangeParentEdgePtr(parentEdge))
                 changeEdgePtr(parentEdge, it.second);
             continue;
         }
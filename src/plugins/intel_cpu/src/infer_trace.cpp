@@ -0,0 +1,297 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "infer_trace.h"
+
+#include "edge.h"
+#include "onednn/iml_type_mapper.h"
+
+#include <ie_common.h>
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <unordered_set>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+std::string escape(const std::string& str) {
+    std::string result;
+    result.reserve(str.size());
+    for (const char c : str) {
+        switch (c) {
+        case '"': result += "\\\""; break;
+        case '\\': result += "\\\\"; break;
+        case '\n': result += "\\n"; break;
+        case '\t': result += "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                std::ostringstream code;
+                code << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c);
+                result += code.str();
+            } else {
+                result += c;
+            }
+        }
+    }
+    return result;
+}
+
+const char* categoryName(InferenceTrace::Category category) {
+    switch (category) {
+    case InferenceTrace::Category::Input: return "input";
+    case InferenceTrace::Category::Reorder: return "reorder";
+    case InferenceTrace::Category::Output: return "output";
+    default: return "node";
+    }
+}
+
+std::string formatOf(const EdgePtr& edge) {
+    const auto& desc = edge->getMemory().getDesc();
+    return desc.serializeFormat() + ":" + desc.getPrecision().name();
+}
+
+}   // namespace
+
+InferenceTrace::InferenceTrace(std::string pathPrefix, size_t period, std::string graphName,
+                               const std::vector<NodePtr>& graphNodes)
+    : pathPrefix(std::move(pathPrefix)), period(std::max<size_t>(period, 1)), graphName(std::move(graphName)),
+      nodes(graphNodes), nodeEvents(graphNodes.size()) {
+    for (const auto& node : nodes) {
+        if (node->getExecIndex() < 0 || static_cast<size_t>(node->getExecIndex()) >= nodeEvents.size())
+            IE_THROW() << "Unexpected execution index of the node " << node->getName() << " in the inference trace";
+        auto& event = nodeEvents[node->getExecIndex()];
+        event.name = node->getName();
+        event.type = node->getTypeStr();
+        event.category = node->getType() == Type::Reorder ? Category::Reorder : Category::Node;
+    }
+}
+
+InferenceTrace::~InferenceTrace() {
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        stopping = true;
+    }
+    pendingCond.notify_one();
+    if (writer.joinable())
+        writer.join();
+}
+
+int InferenceTrace::threadId() {
+    static std::atomic<int> threadsNum{0};
+    thread_local int id = threadsNum++;
+    return id;
+}
+
+void InferenceTrace::start() {
+    isActive = inferences++ % period == 0;
+    if (!isActive)
+        return;
+    for (auto& event : nodeEvents) {
+        event.begin = event.end = 0;
+        event.thread = -1;
+    }
+    dataEvents.clear();
+    traceBegin = PerfClock::now();
+}
+
+void InferenceTrace::finish() {
+    if (!isActive)
+        return;
+    traceEnd = PerfClock::now();
+    isActive = false;
+    collectNodeDetails();
+    auto record = makeRecord();
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        pending.push_back(std::move(record));
+    }
+    pendingCond.notify_one();
+    if (!writer.joinable())
+        writer = std::thread(&InferenceTrace::writerLoop, this);
+}
+
+void InferenceTrace::writerLoop() {
+    std::unique_lock<std::mutex> lock(pendingMutex);
+    while (true) {
+        pendingCond.wait(lock, [this] { return stopping || !pending.empty(); });
+        if (pending.empty())
+            return;
+        auto record = std::move(pending.front());
+        pending.pop_front();
+        lock.unlock();
+        write(record);
+        lock.lock();
+    }
+}
+
+void InferenceTrace::addDataEvent(Category category, const std::string& name, uint64_t begin, size_t bytes,
+                                  std::string details) {
+    Event event;
+    event.name = name;
+    event.type = category == Category::Input ? "Input" : "Output";
+    event.category = category;
+    event.begin = begin;
+    event.end = PerfClock::now();
+    event.thread = threadId();
+    event.bytes = bytes;
+    event.details = std::move(details);
+    dataEvents.push_back(std::move(event));
+}
+
+bool InferenceTrace::executed(const Node* node) const {
+    const auto idx = node->getExecIndex();
+    return idx >= 0 && static_cast<size_t>(idx) < nodeEvents.size() && nodeEvents[idx].end != 0;
+}
+
+void InferenceTrace::collectNodeDetails() {
+    for (const auto& node : nodes) {
+        if (!executed(node.get()))
+            continue;
+        auto& event = nodeEvents[node->getExecIndex()];
+
+        // the in-place tensors are counted once
+        std::unordered_set<const void*> tensors;
+        event.bytes = 0;
+        auto addEdge = [&](const EdgePtr& edge) {
+            if (!edge)
+                return;
+            const auto& mem = edge->getMemory();
+            if (tensors.insert(mem.GetData()).second)
+                event.bytes += mem.GetSize();
+        };
+        for (size_t i = 0; i < node->getParentEdges().size(); i++)
+            addEdge(node->getParentEdgeAt(i));
+        for (size_t i = 0; i < node->getChildEdges().size(); i++)
+            addEdge(node->getChildEdgeAt(i));
+
+        if (event.category == Category::Reorder) {
+            event.details = "\"src\":\"" + escape(formatOf(node->getParentEdgeAt(0))) + "\",\"dst\":\"" +
+                            escape(formatOf(node->getChildEdgeAt(0))) + "\"";
+        } else if (const auto pd = node->getSelectedPrimitiveDescriptor()) {
+            event.details = std::string("\"impl\":\"") + impl_type_to_string(pd->getImplementationType()) + "\"";
+        }
+    }
+}
+
+std::vector<const Node*> InferenceTrace::criticalPath() const {
+    // the latest finished executed producer of every node, the not executed nodes (inputs, optimized out nodes) are
+    // passed through
+    std::vector<const Node*> producers(nodeEvents.size(), nullptr);
+    std::vector<bool> visited(nodeEvents.size(), false);
+    std::function<const Node*(const Node*)> latestProducer = [&](const Node* node) -> const Node* {
+        const auto idx = node->getExecIndex();
+        if (visited[idx])
+            return producers[idx];
+        visited[idx] = true;
+        const Node* latest = nullptr;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto edge = node->getParentEdgeAt(i);
+            if (!edge)
+                continue;
+            const Node* parent = edge->getParent().get();
+            const Node* candidate = executed(parent) ? parent : latestProducer(parent);
+            if (candidate && (!latest || nodeEvents[candidate->getExecIndex()].end > nodeEvents[latest->getExecIndex()].end))
+                latest = candidate;
+        }
+        producers[idx] = latest;
+        return latest;
+    };
+
+    const Node* last = nullptr;
+    for (const auto& node : nodes) {
+        if (executed(node.get()) &&
+            (!last || nodeEvents[node->getExecIndex()].end > nodeEvents[last->getExecIndex()].end))
+            last = node.get();
+    }
+
+    std::vector<const Node*> path;
+    for (auto node = last; node; node = latestProducer(node))
+        path.push_back(node);
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+InferenceTrace::Record InferenceTrace::makeRecord() const {
+    static std::atomic<size_t> tracesNum{0};
+
+    Record record;
+    record.fileName = pathPrefix + std::to_string(tracesNum++) + ".json";
+    record.inference = inferences - 1;
+    record.traceBegin = traceBegin;
+    record.traceEnd = traceEnd;
+    for (const auto& event : dataEvents) {
+        if (event.category == Category::Input)
+            record.events.push_back(event);
+    }
+    for (const auto& node : nodes) {
+        if (executed(node.get()))
+            record.events.push_back(nodeEvents[node->getExecIndex()]);
+    }
+    for (const auto& event : dataEvents) {
+        if (event.category == Category::Output)
+            record.events.push_back(event);
+    }
+    for (const auto node : criticalPath()) {
+        const auto& event = nodeEvents[node->getExecIndex()];
+        record.criticalPath.push_back(node->getName());
+        record.criticalPathUs += PerfClock::toMicroseconds(event.end - event.begin);
+    }
+    return record;
+}
+
+void InferenceTrace::write(const Record& record) const {
+    auto toUs = [&record](uint64_t ticks) {
+        return PerfClock::toMicroseconds(ticks > record.traceBegin ? ticks - record.traceBegin : 0);
+    };
+    auto duration = [](const Event& event) {
+        return PerfClock::toMicroseconds(event.end - event.begin);
+    };
+
+    std::ostringstream events;
+    events << std::fixed << std::setprecision(3);
+    double categoryUs[4] = {0, 0, 0, 0};
+    for (size_t i = 0; i < record.events.size(); i++) {
+        const auto& event = record.events[i];
+        categoryUs[static_cast<size_t>(event.category)] += duration(event);
+        events << (i ? ",\n" : "\n") << "{\"name\":\"" << escape(event.name) << "\",\"cat\":\""
+               << categoryName(event.category) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread
+               << ",\"ts\":" << toUs(event.begin) << ",\"dur\":" << duration(event) << ",\"args\":{\"type\":\""
+               << escape(event.type) << "\",\"bytes\":" << event.bytes
+               << (event.details.empty() ? "" : ",") << event.details << "}}";
+    }
+
+    std::ostringstream pathNames;
+    for (size_t i = 0; i < record.criticalPath.size(); i++)
+        pathNames << (i ? "," : "") << "\"" << escape(record.criticalPath[i]) << "\"";
+
+    // the failed trace must not fail the inferences, so it's only reported
+    std::ofstream file(record.fileName);
+    if (!file) {
+        std::cerr << "Cannot open the inference trace file " << record.fileName << ", the trace is dropped"
+                  << std::endl;
+        return;
+    }
+    file << std::fixed << std::setprecision(3);
+    file << "{\"displayTimeUnit\":\"ns\",\n\"otherData\":{\"graph\":\"" << escape(graphName)
+         << "\",\"inference\":" << record.inference
+         << ",\"wall_us\":" << toUs(record.traceEnd)
+         << ",\"input_us\":" << categoryUs[static_cast<size_t>(Category::Input)]
+         << ",\"nodes_us\":" << categoryUs[static_cast<size_t>(Category::Node)]
+         << ",\"reorders_us\":" << categoryUs[static_cast<size_t>(Category::Reorder)]
+         << ",\"output_us\":" << categoryUs[static_cast<size_t>(Category::Output)]
+         << ",\"critical_path_us\":" << record.criticalPathUs
+         << ",\"critical_path\":[" << pathNames.str() << "]},\n\"traceEvents\":[" << events.str() << "\n]}\n";
+    if (!file)
+        std::cerr << "Cannot write the inference trace file " << record.fileName << std::endl;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,207 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "node.h"
+#include "perf_count.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Records the timeline of the sampled inferences of a graph and exports it in the Chrome trace event format
+ * (chrome://tracing, Perfetto).
+ *
+ * Every period-th inference is traced: the input push, the execution of every node and the output pull are recorded
+ * with their start and end time stamps and the thread. The nodes write the time stamps to their own preallocated slots,
+ * so the concurrently executed nodes don't synchronize. The bytes touched by the nodes, the formats of the inserted
+ * reorders, the time attribution and the critical path are computed after the inference. The finished trace is written
+ * by a background thread, so the file output doesn't delay the inference, and a failed write only drops the trace.
+ * The pending traces are written before the destruction completes.
+ *
+ * Is NOT thread safe except the node events, the owner graph is expected to serialize the inferences.
+ */
+class InferenceTrace {
+public:
+    using Ptr = std::shared_ptr<InferenceTrace>;
+
+    enum class Category {
+        Input,
+        Node,
+        Reorder,
+        Output
+    };
+
+    struct Event {
+        std::string name;
+        std::string type;
+        Category category = Category::Node;
+        uint64_t begin = 0;
+        uint64_t end = 0;
+        int thread = -1;
+        size_t bytes = 0;
+        // the category specific members of the event arguments in JSON
+        std::string details;
+    };
+
+    /**
+     * @param pathPrefix the traces are written to <pathPrefix><sequence number>.json
+     * @param period every period-th inference is traced, starting from the first one
+     * @param graphName reported in the trace metadata
+     * @param graphNodes all the nodes of the graph, the node events are indexed by their execution indices
+     */
+    InferenceTrace(std::string pathPrefix, size_t period, std::string graphName, const std::vector<NodePtr>& graphNodes);
+    ~InferenceTrace();
+
+    InferenceTrace(const InferenceTrace&) = delete;
+    InferenceTrace& operator=(const InferenceTrace&) = delete;
+
+    /**
+     * @brief Decides whether the next inference is traced and resets the events. Must be called before the input push.
+     */
+    void start();
+
+    /**
+     * @brief Hands the trace of the sampled inference to the writer thread. Must be called after the output pull.
+     */
+    void finish();
+
+    bool active() const {
+        return isActive;
+    }
+
+    void addDataEvent(Category category, const std::string& name, uint64_t begin, size_t bytes, std::string details);
+
+    void nodeStarted(const Node* node) {
+        nodeEvents[node->getExecIndex()].begin = PerfClock::now();
+    }
+
+    void nodeFinished(const Node* node) {
+        auto& event = nodeEvents[node->getExecIndex()];
+        event.end = PerfClock::now();
+        event.thread = threadId();
+    }
+
+    // sequential id of the calling thread, stable for the process lifetime
+    static int threadId();
+
+private:
+    // the finished trace which doesn't refer to the graph
+    struct Record {
+        std::string fileName;
+        size_t inference = 0;
+        uint64_t traceBegin = 0;
+        uint64_t traceEnd = 0;
+        // in the order of the trace file
+        std::vector<Event> events;
+        std::vector<std::string> criticalPath;
+        double criticalPathUs = 0;
+    };
+
+    void collectNodeDetails();
+    std::vector<const Node*> criticalPath() const;
+    bool executed(const Node* node) const;
+    Record makeRecord() const;
+    void write(const Record& record) const;
+    void writerLoop();
+
+    std::string pathPrefix;
+    size_t period;
+    std::string graphName;
+    std::vector<NodePtr> nodes;
+
+    size_t inferences = 0;
+    bool isActive = false;
+    uint64_t traceBegin = 0;
+    uint64_t traceEnd = 0;
+
+    std::vector<Event> nodeEvents;
+    std::vector<Event> dataEvents;
+
+    // the writer thread is started by the first finished trace
+    std::thread writer;
+    std::mutex pendingMutex;
+    std::condition_variable pendingCond;
+    std::deque<Record> pending;
+    bool stopping = false;
+};
+
+/**
+ * @brief Records the execution of a node if the inference is traced
+ */
+class InferTraceHelper {
+    InferenceTrace* trace;
+    const Node* node;
+
+public:
+    InferTraceHelper(const InferenceTrace::Ptr& inferTrace, const NodePtr& tracedNode)
+        : trace(inferTrace && inferTrace->active() ? inferTrace.get() : nullptr), node(tracedNode.get()) {
+        if (trace)
+            trace->nodeStarted(node);
+    }
+
+    ~InferTraceHelper() {
+        if (trace)
+            trace->nodeFinished(node);
+    }
+
+    InferTraceHelper(const InferTraceHelper&) = delete;
+    InferTraceHelper& operator=(const InferTraceHelper&) = delete;
+};
+
+/**
+ * @brief Records the transfer of an input or an output tensor if the inference is traced
+ */
+class InferTraceDataHelper {
+    InferenceTrace* trace;
+    InferenceTrace::Category category;
+    const std::string& name;
+    uint64_t begin = 0;
+    size_t bytes = 0;
+    std::string details;
+
+public:
+    InferTraceDataHelper(const InferenceTrace::Ptr& inferTrace, InferenceTrace::Category dataCategory,
+                         const std::string& dataName)
+        : trace(inferTrace && inferTrace->active() ? inferTrace.get() : nullptr), category(dataCategory), name(dataName) {
+        if (trace)
+            begin = PerfClock::now();
+    }
+
+    ~InferTraceDataHelper() {
+        if (trace)
+            trace->addDataEvent(category, name, begin, bytes, std::move(details));
+    }
+
+    bool active() const {
+        return trace != nullptr;
+    }
+
+    // the members of the event arguments, the values are JSON literals
+    void setDetails(size_t dataBytes, const std::vector<std::pair<const char*, std::string>>& args) {
+        bytes = dataBytes;
+        details.clear();
+        for (const auto& arg : args)
+            details += (details.empty() ? "\"" : ",\"") + std::string(arg.first) + "\":" + arg.second;
+    }
+
+    InferTraceDataHelper(const InferTraceDataHelper&) = delete;
+    InferTraceDataHelper& operator=(const InferTraceDataHelper&) = delete;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
+
+#define INFER_TRACE(_trace, _node) InferTraceHelper traceHelper(_trace, _node);
@@ -6,15 +6,65 @@
 #include "dnnl_extension_utils.h"
 #include "blob_factory.hpp"
 
+#include <algorithm>
+
 using namespace InferenceEngine;
 
 namespace ov {
 namespace intel_cpu {
 
+VariableState::VariableState(std::string name, MemoryPtr storage, MemoryDescPtr desc, size_t reservedSize)
+    : InferenceEngine::IVariableStateInternal{name}, desc(desc), initialDims(storage->getStaticDims()) {
+    if (reservedSize) {
+        auto mem = std::make_shared<Memory>(storage->getEngine(),
+                                            std::unique_ptr<GrowableMemoryMngr>(new GrowableMemoryMngr()));
+        mem->getDnnlMemoryMngr()->resize(reservedSize);
+        buffers[0] = buffers[1] = mem;
+    } else {
+        for (size_t i = 0; i < 2; i++)
+            buffers[i] = std::make_shared<Memory>(storage->getEngine());
+    }
+    for (size_t i = 0; i < 2; i++)
+        buffers[i]->Create(storage->getDesc());
+    if (storage->GetSize())
+        cpu_memcpy(buffers[current]->GetData(), storage->GetData(), storage->GetSize());
+    if (!isGrowable())
+        getNextMemory()->FillZero();
+}
+
+void VariableState::redefine(const MemoryPtr& mem, const VectorDims& dims) const {
+    if (mem->getStaticDims() == dims)
+        return;
+    const bool hasZeroDims = std::count(dims.begin(), dims.end(), 0) > 0;
+    mem->redefineDesc(desc->cloneWithNewDims(dims, hasZeroDims));
+}
+
 void VariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+    auto mem = getCurrentMemory();
+    redefine(mem, initialDims);
+    mem->FillZero();
+}
+
+void VariableState::SetState(const Blob::Ptr& newState) {
+    if (!newState)
+        IE_THROW() << "Failed to set empty state for the variable " << GetName();
+    auto mem = getCurrentMemory();
+    const auto& dims = newState->getTensorDesc().getDims();
+    if (!desc->getShape().isCompatible(dims))
+        IE_THROW() << "Failed to set the state for the variable " << GetName() << ": the shape "
+                   << MemoryDescUtils::dims2str(dims) << " is incompatible with " << desc->getShape().toString();
+    redefine(mem, dims);
+    if (newState->byteSize() != mem->GetSize())
+        IE_THROW() << "Failed to set the state for the variable " << GetName() << ": expected " << mem->GetSize()
+                   << " bytes but got " << newState->byteSize();
+    if (mem->GetSize())
+        cpu_memcpy(mem->GetData(), newState->cbuffer().as<const void*>(), mem->GetSize());
+}
+
+Blob::CPtr VariableState::GetState() const {
+    auto mem = getCurrentMemory();
+    return make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(mem->getDesc()), mem->GetData());
 }
 
 }   // namespace intel_cpu
 }   // namespace ov
-
@@ -15,16 +15,50 @@
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief The state owns two buffers: the MemoryInput node reads the current one and the MemoryOutput node writes
+ * the next one, so the buffers are swapped after the inference instead of copying the state in and out of the graph.
+ *
+ * The state of a growing variable (a variable with a dynamic shape and the capacity reserved up front) is kept in a
+ * single buffer instead, which preserves its content while growing, so the graph may append to the state in place.
+ */
 class VariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    VariableState(std::string name, MemoryPtr storage)
-        : InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
-    }
+    /**
+     * @param storage the initial value of the state
+     * @param desc the descriptor of the variable, the dynamic one if the shape of the state changes between inferences
+     * @param reservedSize the size in bytes allocated up front for the state of a growing variable, zero means the
+     *        state is double-buffered
+     */
+    VariableState(std::string name, MemoryPtr storage, MemoryDescPtr desc, size_t reservedSize = 0);
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    // returns a view of the current buffer
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    MemoryPtr getCurrentMemory() const {
+        return buffers[current];
+    }
+    MemoryPtr getNextMemory() const {
+        return buffers[current ^ 1];
+    }
+    bool isGrowable() const {
+        return buffers[0] == buffers[1];
+    }
+    // makes the state written by the last inference the current one
+    void commit() {
+        if (!isGrowable())
+            current ^= 1;
+    }
+
+private:
+    void redefine(const MemoryPtr& mem, const VectorDims& dims) const;
+
+    MemoryDescPtr desc;
+    VectorDims initialDims;
+    MemoryPtr buffers[2];
+    size_t current = 0;
 };
 
 }   // namespace intel_cpu
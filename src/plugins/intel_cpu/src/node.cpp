@@ -846,17 +846,22 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
     auto constDnnlMemOutDesc = edgeMem->GetDescWithType<DnnlMemoryDesc>();
     auto weightSrcDesc = constDnnlMemOutDesc->getDnnlDesc();
     weightSrcDesc = weightSrcDesc.reshape(weightDesc->getDnnlDesc().get_dims());
+    auto newSrcDesc = DnnlExtensionUtils::makeDescriptor(weightSrcDesc);
     auto create = [&] () {
-        auto newSrcDesc = DnnlExtensionUtils::makeDescriptor(weightSrcDesc);
-
         Memory srcMemory{ getEngine() };
         srcMemory.Create(newSrcDesc, edgeMem->GetData());
 
-        MemoryPtr _ptr = std::make_shared<Memory>(getEngine());
-        _ptr->Create(weightDesc);
-        node::Reorder::reorderData(srcMemory, *_ptr, context->getParamsCache());
+        auto reorder = [&] () {
+            MemoryPtr _ptr = std::make_shared<Memory>(getEngine());
+            _ptr->Create(weightDesc);
+            node::Reorder::reorderData(srcMemory, *_ptr, context->getParamsCache());
+            return _ptr;
+        };
 
-        return _ptr;
+        if (auto weightsFileCache = context->getWeightsFileCache())
+            return weightsFileCache->findOrCreate(srcMemory, *weightDesc, reorder);
+
+        return reorder();
     };
 
     MemoryPtr ptr;
@@ -864,6 +869,11 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
     auto itr = privateWeightCache.find(format);
     if (privateWeightCache.end() != itr) {
         ptr = itr->second;
+    } else if (context->getConfig().weightsZeroCopy && newSrcDesc->isCompatible(*weightDesc)) {
+        // the constant layout is already expected by the primitive, so the weights are consumed in place
+        ptr = std::make_shared<Memory>(getEngine());
+        ptr->Create(weightDesc, edgeMem->GetData());
+        privateWeightCache[format] = ptr;
     } else {
         auto weightCache = context->getWeightsCache();
         if (weightCache != nullptr) {
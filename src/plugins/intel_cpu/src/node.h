@@ -678,7 +678,8 @@ protected:
 
     MemoryPtr getScratchPadMem(const DnnlMemoryDescPtr& desc) {
         if (!scratchpadMem || !scratchpadMem->getDesc().isCompatible(*desc)) {
-            scratchpadMem = context->getScratchPad()->createScratchPadMem(desc);
+            const auto scratchPad = context->getScratchPad(scratchPadIndex >= 0 ? scratchPadIndex : execIndex);
+            scratchpadMem = scratchPad->createScratchPadMem(desc);
         }
         return scratchpadMem;
     }
@@ -702,6 +703,8 @@ private:
     std::string typeStr;
     Type type;
     int execIndex = -1;
+    // the scratch pad used by the node if it differs from the one selected by the execution index
+    int scratchPadIndex = -1;
 
     std::string typeToStr(Type type);
 
@@ -6,11 +6,13 @@
 
 #include <cpu_memory.h>
 #include <onednn/iml_type_mapper.h>
+#include "cache/multi_cache.h"
 
 namespace ov {
 namespace intel_cpu {
 
-class DnnlExecutor {
+// the primitives take the scratchpad and the intermediate buffers with the call, so they are shared between the streams
+class DnnlExecutor : public StatelessCacheValue {
     protected:
         class IntermReorder {
             public:
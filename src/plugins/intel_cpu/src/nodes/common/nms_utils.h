@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Sorts the next candidates of the NMS on demand. The hard suppression stops as soon as enough boxes are selected,
+ * so with thousands of candidates passing the score threshold only the beginning of the sorted list is usually
+ * visited. The candidates in [sortedEnd, end) are not sorted yet, the next count of the best ones are moved to the
+ * beginning of this range and sorted.
+ * @return the new end of the sorted range
+ */
+template <typename Iterator, typename Compare>
+Iterator sortNextCandidates(Iterator sortedEnd, Iterator end, size_t count, const Compare& comp) {
+    if (static_cast<size_t>(std::distance(sortedEnd, end)) <= count) {
+        std::sort(sortedEnd, end, comp);
+        return end;
+    }
+    const auto next = sortedEnd + count;
+    std::nth_element(sortedEnd, next, end, comp);
+    std::sort(sortedEnd, next, comp);
+    return next;
+}
+
+/**
+ * The NMS kernel orders the corners of the boxes in the corner encoding. The boxes with the ordered corners and a
+ * positive area give the same IoU as the reference MatrixNms and MulticlassNms implementations, which use the
+ * corners as is.
+ * @param box corners of the box, [y1, x1, y2, x2] or [x1, y1, x2, y2]
+ * @param coordOffset 1 for the not normalized boxes, 0 otherwise
+ */
+inline bool isOrderedBox(const float* box, float coordOffset) {
+    return box[2] >= box[0] && box[3] >= box[1] &&
+           box[2] - box[0] + coordOffset > 0.f && box[3] - box[1] + coordOffset > 0.f;
+}
+
+/**
+ * Coordinates of the boxes in the SoA layout of the NMS kernel, each coordinate is stored in its own array.
+ */
+struct NmsBoxesSoA {
+    explicit NmsBoxesSoA(size_t capacity) {
+        for (auto& c : coord)
+            c.resize(capacity);
+    }
+
+    void set(size_t idx, const float* box) {
+        for (size_t c = 0; c < 4; c++)
+            coord[c][idx] = box[c];
+    }
+
+    std::vector<float> coord[4];
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
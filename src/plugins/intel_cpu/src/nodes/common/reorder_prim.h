@@ -12,6 +12,10 @@
 namespace ov {
 namespace intel_cpu {
 
+// the reorder primitives keep no state between the calls, so they are shared between the streams
+template<>
+struct IsStatelessCacheValue<dnnl::reorder> : std::true_type {};
+
 dnnl::reorder getReorderPrim(MultiCachePtr cache,
                              const dnnl::engine& engine,
                              const dnnl::memory::desc& src,
@@ -348,6 +348,17 @@ bool Concat::isOptimized() const {
     return getSelectedPrimitiveDescriptor() && getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].inPlace() >= 0;
 }
 
+bool Concat::canAppendInPlace() const {
+    if (isOptimized() || !canExecRef || canOptimizeNspc)
+        return false;
+    const auto& outDesc = getSelectedPrimitiveDescriptor()->getConfig().outConfs[0].getMemDesc();
+    if (!outDesc->hasLayoutType(LayoutType::ncsp))
+        return false;
+    // the inputs are contiguous parts of the output only if there is no outer loop
+    const auto& dims = getOutputShapeAtPort(0).getDims();
+    return std::all_of(dims.begin(), dims.begin() + axis, [](Dim dim) { return dim == 1; });
+}
+
 bool Concat::needPrepareParams() const {
     if (canOptimizeNspc) {
         return false;
@@ -644,11 +655,16 @@ void Concat::execRef() {
             for (size_t a = 0; a < srcPtrs.size(); ++a) {
                 const auto inData = srcPtrs[a];
                 auto outputData = &dstPtr[dstOffset[a]];
+                // the input already resides in the output, see canAppendInPlace()
+                if (inData == outputData)
+                    continue;
                 std::memcpy(outputData, inData, nelemToCopy[a]);
             }
         } else {
             parallel_nt(nthr, [&](int ithr, int nthr) {
                 for (size_t a = 0; a < srcPtrs.size(); ++a) {
+                    if (srcPtrs[a] == dstPtr + dstOffset[a])
+                        continue;
                     size_t start = 0, end = 0;
                     splitter(nelemToCopy[a], nthr, ithr, start, end);
                     const uint8_t* i = srcPtrs[a] + start;
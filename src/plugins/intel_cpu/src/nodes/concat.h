@@ -28,6 +28,11 @@ public:
     void executeDynamicImpl(dnnl::stream strm) override { execute(strm); }
 
     bool isOptimized() const;
+    /**
+     * @brief the first input may reside at the head of the output memory, e.g. when the state of a growing variable
+     * is appended in place, the input is not copied then
+     */
+    bool canAppendInPlace() const;
 
     InferenceEngine::Precision getRuntimePrecision() const override;
 
@@ -8,9 +8,11 @@
 #include "ie_ngraph_utils.hpp"
 #include "transformations/utils/utils.hpp"
 #include "common/cpu_memcpy.h"
+#include "utils/debug_capabilities.h"
 #include <utils/shape_inference/shape_inference_internal_dyn.hpp>
 
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace ov {
@@ -45,6 +47,34 @@ void If::PortMapHelper::redefineTo() {
     }
 }
 
+If::PortBindHelper::PortBindHelper(const MemoryPtr &from, const std::deque<MemoryPtr>& to,
+                                   const dnnl::engine& eng) : PortMapHelper(from, to, eng) {}
+
+void If::PortBindHelper::execute(dnnl::stream& strm) {
+    redefineTo();
+}
+
+void If::PortBindHelper::redefineTo() {
+    auto data = srcMemPtr->GetData();
+    for (auto& dstMemPtr : dstMemPtrs) {
+        // the binding is applied only if no other body tensor shares the memory, see the checks at the mappers creation
+        dstMemPtr->setDataHandle(data);
+        const auto &currDesc = dstMemPtr->getDesc();
+        if (currDesc.getShape().isDynamic() || currDesc.getShape().getStaticDims() != srcMemPtr->getStaticDims())
+            dstMemPtr->Create(srcMemPtr->getDescPtr(), data);
+    }
+}
+
+bool If::PortBindHelper::isApplicable(const MemoryPtr& from, const MemoryPtr& to) {
+    const auto &fromDesc = from->getDesc();
+    const auto &toDesc = to->getDesc();
+    if (fromDesc.getPrecision() != toDesc.getPrecision() ||
+        !fromDesc.hasLayoutType(LayoutType::ncsp) || !toDesc.hasLayoutType(LayoutType::ncsp))
+        return false;
+    // the shapes of the dynamic memory are checked at the binding
+    return !fromDesc.isDefined() || !toDesc.isDefined() || fromDesc.isCompatible(toDesc);
+}
+
 bool If::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!one_of(op->get_type_info(), ov::op::v8::If::get_type_info_static())) {
@@ -79,6 +109,7 @@ void If::getSupportedDescriptors() {
         auto inNode = inMapThen.find(param->get_friendly_name());
         if (inNode != inMapThen.end()) {
             inputMemThen.push_back(getToMemories(inNode->second.get(), 0));
+            inputNodesThen.push_back(inNode->second);
         } else {
             IE_THROW() << "Then body of node If with name " << getName() << " does not have input with name: "
                     << param->get_friendly_name();
@@ -90,6 +121,7 @@ void If::getSupportedDescriptors() {
         auto inNode = inMapElse.find(param->get_friendly_name());
         if (inNode != inMapElse.end()) {
             inputMemElse.push_back(getToMemories(inNode->second.get(), 0));
+            inputNodesElse.push_back(inNode->second);
         } else {
             IE_THROW() << "Else body of node If with name " << getName() << " does not have input with name: "
                     << param->get_friendly_name();
@@ -104,6 +136,7 @@ void If::getSupportedDescriptors() {
         if (outNode != outMapThen.end()) {
             auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
             outputMemThen.push_back(outMem);
+            outputEdgesThen.push_back(outNode->second->getParentEdgeAt(0));
         } else {
             IE_THROW() << "Then body of node If with name " << getName() << " does not have output with name: "
                     << inputID;
@@ -118,6 +151,7 @@ void If::getSupportedDescriptors() {
         if (outNode != outMapElse.end()) {
             auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
             outputMemElse.push_back(outMem);
+            outputEdgesElse.push_back(outNode->second->getParentEdgeAt(0));
         } else {
             IE_THROW() << "Else body of node If with name " << getName() << " does not have output with name: "
                     << inputID;
@@ -175,6 +209,7 @@ void If::initSupportedPrimitiveDescriptors() {
 
 void If::createPrimitive() {
     const auto& eng = getEngine();
+    sharedMemory = context->getConfig().ifSharedMemory;
     prepareBeforeMappers(true, eng);
     prepareBeforeMappers(false, eng);
     prepareAfterMappers(true, eng);
@@ -188,27 +223,66 @@ void If::createPrimitive() {
 void If::prepareBeforeMappers(const bool isThen, const dnnl::engine& eng) {
     auto &inputPortMap = isThen ? thenInputPortMap : elseInputPortMap;
     auto &inputMems = isThen ? inputMemThen : inputMemElse;
+    auto &inputNodes = isThen ? inputNodesThen : inputNodesElse;
     auto &beforeMappers = isThen ? beforeThenMappers : beforeElseMappers;
     for (auto& map_rule : inputPortMap) {
         auto &fromMem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &toMems = inputMems[map_rule.to];
 
-        beforeMappers.emplace_back(std::make_shared<PortMapHelper>(fromMem, toMems, eng));
+        if (sharedMemory && !toMems.empty() && PortBindHelper::isApplicable(fromMem, toMems.front()) &&
+            canChangeChildEdgesPtr(inputNodes[map_rule.to])) {
+            beforeMappers.emplace_back(std::make_shared<PortBindHelper>(fromMem, toMems, eng));
+        } else {
+            beforeMappers.emplace_back(std::make_shared<PortMapHelper>(fromMem, toMems, eng));
+        }
     }
 }
 
 void If::prepareAfterMappers(const bool isThen, const dnnl::engine& eng) {
     auto &outputPortMap = isThen ? thenOutputPortMap : elseOutputPortMap;
     auto &outputMems = isThen ? outputMemThen : outputMemElse;
+    auto &outputEdges = isThen ? outputEdgesThen : outputEdgesElse;
+    auto &inputMems = isThen ? inputMemThen : inputMemElse;
+    auto &beforeMappers = isThen ? beforeThenMappers : beforeElseMappers;
     auto &afterMappers = isThen ? afterThenMappers : afterElseMappers;
+
+    auto isBodyInputMemory = [&inputMems](const MemoryPtr& mem) {
+        for (const auto& mems : inputMems) {
+            for (const auto& inputMem : mems) {
+                if (inputMem == mem || inputMem->GetData() == mem->GetData())
+                    return true;
+            }
+        }
+        return false;
+    };
+
+    // the body outputs of a static If are bound to the If outputs before the body execution, so the body writes them in
+    // place. The output shapes of a dynamic If are known only after the body execution, so the data is copied.
+    std::unordered_set<const void*> boundMems;
     for (auto& map_rule : outputPortMap) {
         auto toMems = getToMemories(this, map_rule.from);
         auto &fromMem = outputMems[map_rule.to];
 
-        afterMappers.emplace_back(std::make_shared<PortMapHelper>(fromMem, toMems, eng));
+        if (sharedMemory && !isDynamicNode() && !toMems.empty() &&
+            PortBindHelper::isApplicable(toMems.front(), fromMem) && !isBodyInputMemory(fromMem) &&
+            canChangeParentEdgePtr(outputEdges[map_rule.to]) && boundMems.insert(fromMem->GetData()).second) {
+            const std::deque<MemoryPtr> bodyMems{fromMem};
+            beforeMappers.emplace_back(std::make_shared<PortBindHelper>(toMems.front(), bodyMems, eng));
+        } else {
+            afterMappers.emplace_back(std::make_shared<PortMapHelper>(fromMem, toMems, eng));
+        }
     }
 }
 
+void If::prepareBranch(const bool isThen) {
+    auto &beforeMappers = isThen ? beforeThenMappers : beforeElseMappers;
+    auto &subGraph = isThen ? subGraphThen : subGraphElse;
+
+    for (auto &mapper : beforeMappers)
+        mapper->redefineTo();
+    subGraph.PrepareDynamic();
+}
+
 std::deque<MemoryPtr> If::getToMemories(const Node* node, const size_t port) const {
     std::deque<MemoryPtr> memories;
     for (auto edge : node->getChildEdgesAtPort(port))
@@ -216,8 +290,12 @@ std::deque<MemoryPtr> If::getToMemories(const Node* node, const size_t port) con
     return memories;
 }
 
+bool If::getCondition() const {
+    return static_cast<const bool>((reinterpret_cast<const uint8_t*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr()))[0]);
+}
+
 void If::execute(dnnl::stream strm) {
-    const bool condition = static_cast<const bool>((reinterpret_cast<const uint8_t*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr()))[0]);
+    const bool condition = getCondition();
 
     auto& beforeMappers = condition ? beforeThenMappers : beforeElseMappers;
     auto& afterMappers = condition ? afterThenMappers : afterElseMappers;
@@ -232,7 +310,18 @@ void If::execute(dnnl::stream strm) {
 }
 
 void If::executeDynamicImpl(dnnl::stream strm) {
+    // on the input shapes change the branch which is not taken is prepared for the new shapes as well,
+    // so its primitives are already in the cache when the condition alternates
+    const bool prepareOtherBranch = sharedMemory && inputShapesModified();
     execute(strm);
+    if (prepareOtherBranch) {
+        try {
+            prepareBranch(!getCondition());
+        } catch (const std::exception& ex) {
+            // If often guards a branch which is invalid for the current shapes, such a branch is prepared when it's taken
+            DEBUG_LOG("The branch which is not taken isn't prepared for ", getName(), ": ", ex.what());
+        }
+    }
 }
 
 bool If::created() const {
@@ -35,6 +35,8 @@ protected:
 private:
     void prepareBeforeMappers(const bool isThen, const dnnl::engine& eng);
     void prepareAfterMappers(const bool isThen, const dnnl::engine& eng);
+    void prepareBranch(const bool isThen);
+    bool getCondition() const;
 
     std::deque<MemoryPtr> getToMemories(const Node* node, const size_t port) const;
 
@@ -46,23 +48,40 @@ private:
     class PortMapHelper {
     public:
         PortMapHelper(const MemoryPtr& from, const std::deque<MemoryPtr>& to, const dnnl::engine& eng);
-        ~PortMapHelper() = default;
-        void execute(dnnl::stream& strm);
-
-    private:
-        void redefineTo();
+        virtual ~PortMapHelper() = default;
+        virtual void execute(dnnl::stream& strm);
+        // updates the descriptors of the destination memory without copying the data
+        virtual void redefineTo();
 
+    protected:
         MemoryPtr srcMemPtr;
         std::deque<MemoryPtr> dstMemPtrs;
 
         ptrdiff_t size;
     };
 
+    /**
+     * Binds the destination memory to the data of the source one instead of copying it. It is used in the shared memory
+     * mode for the body inputs, which are bound to the If inputs, and for the body outputs of a static If, which are
+     * bound to the If outputs before the body is executed.
+     */
+    class PortBindHelper : public PortMapHelper {
+    public:
+        PortBindHelper(const MemoryPtr& from, const std::deque<MemoryPtr>& to, const dnnl::engine& eng);
+        void execute(dnnl::stream& strm) override;
+        void redefineTo() override;
+
+        static bool isApplicable(const MemoryPtr& from, const MemoryPtr& to);
+    };
+
     ExtensionManager::Ptr ext_mng;
     Graph subGraphThen;
     Graph subGraphElse;
     std::vector<std::deque<MemoryPtr>> inputMemThen, inputMemElse;
     std::deque<MemoryPtr> outputMemThen, outputMemElse;
+    std::vector<NodePtr> inputNodesThen, inputNodesElse;
+    std::vector<EdgePtr> outputEdgesThen, outputEdgesElse;
+    bool sharedMemory = false;
 
     std::vector<std::shared_ptr<PortMapHelper>>
         beforeThenMappers,
@@ -363,16 +363,30 @@ void Input::cloneBlobIfRequired() {
                 + "_" + ptr;
     };
 
-    auto weightCache = context->getWeightsCache();
-    if (weightCache) {
-        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
-        memoryPtr = std::const_pointer_cast<const Memory>(ptr);
     // IRs already have all subnormals flushed to zero, but in
     // read_model scenario with directly loaded original model still can have subnormals
-    } else if (isBlobAligned() && (!needFlushDenormalsToZero || !hasSubnormals()) && !isWA()) {
-        auto ptr = new Memory(getEngine());
+    auto canBeShared = [&, this] () {
+        return constOp->get_byte_size() >= memDesc.getCurrentMemSize() &&
+               isBlobAligned() && (!needFlushDenormalsToZero || !hasSubnormals()) && !isWA();
+    };
+
+    auto shareBlob = [&, this] () {
+        MemoryPtr ptr = std::make_shared<Memory>(getEngine());
         ptr->Create(memDesc, constOp->get_data_ptr());
-        memoryPtr = MemoryCPtr(ptr);
+        return ptr;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache) {
+        // In the zero copy mode the streams share the original constant data (e.g. the mmapped IR weights)
+        // instead of a cached copy of it
+        auto create = [&] () {
+            return context->getConfig().weightsZeroCopy && canBeShared() ? shareBlob() : cloneBlob();
+        };
+        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), create);
+        memoryPtr = std::const_pointer_cast<const Memory>(ptr);
+    } else if (canBeShared()) {
+        memoryPtr = std::const_pointer_cast<const Memory>(shareBlob());
     } else {
         memoryPtr = std::const_pointer_cast<const Memory>(cloneBlob());
     }
@@ -0,0 +1,168 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// The kernel compares one candidate box with the boxes stored in SoA layout (each coordinate in its own array), so
+// the IoU is computed for a vector of boxes at once. It is shared by NonMaxSuppression, MulticlassNms and MatrixNms:
+// - the suppression mode checks the candidate against the selected boxes from the last to the first one and exits
+//   on the first box which suppresses it (hard NMS) or when the decayed score drops below the threshold (soft NMS);
+// - the IoU storing mode writes the IoU with every box to the output row (matrix NMS).
+
+#pragma once
+
+#include <cassert>
+#include <memory>
+#include <vector>
+
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cpu/x64/jit_generator.hpp>
+#include <cpu/x64/injectors/jit_uni_eltwise_injector.hpp>
+#include "emitters/x64/jit_load_store_emitters.hpp"
+
+#define BOX_COORD_NUM 4
+
+namespace ov {
+namespace intel_cpu {
+
+enum class NMSBoxEncodeType {
+    CORNER,
+    CENTER
+};
+
+enum NMSCandidateStatus {
+    SUPPRESSED = 0,
+    SELECTED = 1,
+    UPDATED = 2
+};
+
+struct jit_nms_config_params {
+    NMSBoxEncodeType box_encode_type;
+    bool is_soft_suppressed_by_iou;
+    // added to the box sizes and the intersection sizes, 1 for the boxes in the not normalized pixel coordinates
+    float coord_offset;
+    // write the IoU with every box to jit_nms_args::iou instead of the candidate suppression
+    bool store_iou;
+};
+
+struct jit_nms_args {
+    const void* selected_boxes_coord[BOX_COORD_NUM];
+    size_t selected_boxes_num;
+    const void* candidate_box;
+    const void* iou_threshold;
+    void* candidate_status;
+    // for soft suppression, score *= scale * iou * iou;
+    const void* score_threshold;
+    const void* scale;
+    void* score;
+    // for the IoU storing mode, selected_boxes_num values
+    void* iou;
+};
+
+struct jit_uni_nms_kernel {
+    void (*ker_)(const jit_nms_args *);
+
+    void operator()(const jit_nms_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_nms_kernel(jit_nms_config_params jcp_) : ker_(nullptr), jcp(jcp_) {}
+    virtual ~jit_uni_nms_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_nms_config_params jcp;
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jit_uni_nms_kernel_f32 : public jit_uni_nms_kernel, public dnnl::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_nms_kernel_f32)
+
+    explicit jit_uni_nms_kernel_f32(jit_nms_config_params jcp_);
+
+    void create_ker() override;
+    void generate() override;
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                                         Xbyak::Xmm,
+                                                         isa == dnnl::impl::cpu::x64::avx2,
+                                                         Xbyak::Ymm,
+                                                         Xbyak::Zmm>::type;
+    uint32_t vlen = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen;
+    const int vector_step = vlen / sizeof(float);
+    const int scalar_step = 1;
+
+    Xbyak::Reg64 reg_boxes_coord0 = r8;
+    Xbyak::Reg64 reg_boxes_coord1 = r9;
+    Xbyak::Reg64 reg_boxes_coord2 = r10;
+    Xbyak::Reg64 reg_boxes_coord3 = r11;
+    Xbyak::Reg64 reg_candidate_box = r12;
+    Xbyak::Reg64 reg_candidate_status = r13;
+    Xbyak::Reg64 reg_boxes_num = r14;
+    Xbyak::Reg64 reg_iou_threshold = r15;
+    // more for soft
+    Xbyak::Reg64 reg_score_threshold = rdx;
+    Xbyak::Reg64 reg_score = rbp;
+    Xbyak::Reg64 reg_scale = rsi;
+    // the IoU storing mode doesn't use the soft suppression
+    Xbyak::Reg64 reg_iou = rbp;
+
+    Xbyak::Reg64 reg_load_table = rax;
+    Xbyak::Reg64 reg_load_store_mask = rbx;
+
+    // reuse
+    Xbyak::Label l_table_constant;
+    Xbyak::Reg64 reg_table = rcx;
+    Xbyak::Reg64 reg_temp_64 = rdi;
+    Xbyak::Reg32 reg_temp_32 = edi;
+
+    Xbyak::Reg64 reg_params = Xbyak::Reg64(dnnl::impl::cpu::x64::abi_param_regs[0]);
+
+    std::unique_ptr<jit_load_emitter> load_vector_emitter = nullptr;
+    std::unique_ptr<jit_load_emitter> load_scalar_emitter = nullptr;
+
+    std::vector<size_t> store_pool_gpr_idxs;
+    std::vector<size_t> store_pool_vec_idxs;
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    Vmm vmm_boxes_coord0 = Vmm(1);
+    Vmm vmm_boxes_coord1 = Vmm(2);
+    Vmm vmm_boxes_coord2 = Vmm(3);
+    Vmm vmm_boxes_coord3 = Vmm(4);
+    Vmm vmm_candidate_coord0 = Vmm(5);
+    Vmm vmm_candidate_coord1 = Vmm(6);
+    Vmm vmm_candidate_coord2 = Vmm(7);
+    Vmm vmm_candidate_coord3 = Vmm(8);
+    Vmm vmm_temp1 = Vmm(9);
+    Vmm vmm_temp2 = Vmm(10);
+    Vmm vmm_temp3 = Vmm(11);
+    Vmm vmm_temp4 = Vmm(12);
+
+    Vmm vmm_iou_threshold = Vmm(13);
+    Vmm vmm_zero = Vmm(15);
+
+    // soft
+    Vmm vmm_score_threshold = Vmm(14);
+    Vmm vmm_scale = Vmm(0);
+
+    Xbyak::Opmask k_mask = Xbyak::Opmask(7);
+    Xbyak::Opmask k_mask_one = Xbyak::Opmask(6);
+
+    std::shared_ptr<dnnl::impl::cpu::x64::jit_uni_eltwise_injector_f32<isa>> exp_injector;
+
+    void hard_nms();
+    void soft_nms();
+    void iou_row();
+    void suppressed_by_iou(bool is_scalar);
+    void suppressed_by_score();
+    void iou(int ele_num);
+    void add_coord_offset(const Vmm& vmm);
+    void soft_coeff();
+    void horizontal_mul_xmm(const Xbyak::Xmm &xmm_weight, const Xbyak::Xmm &xmm_aux);
+    void horizontal_mul();
+    void prepare_table();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
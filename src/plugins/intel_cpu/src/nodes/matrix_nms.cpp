@@ -14,9 +14,13 @@
 #include "ie_parallel.hpp"
 #include "ngraph/opsets/opset8.hpp"
 #include "utils/general_utils.h"
+#include "common/nms_utils.h"
+#include "cpu/x64/jit_generator.hpp"
 #include <utils/shape_inference/shape_inference_internal_dyn.hpp>
 
 using namespace InferenceEngine;
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::x64;
 
 namespace ov {
 namespace intel_cpu {
@@ -131,6 +135,33 @@ void MatrixNms::initSupportedPrimitiveDescriptors() {
                           {LayoutType::ncsp, Precision::I32},
                           {LayoutType::ncsp, Precision::I32}},
                          impl_desc_type::ref_any);
+
+    // the kernel doesn't depend on the shapes, so it's created once
+    createJitKernel();
+}
+
+void MatrixNms::createJitKernel() {
+#if defined(OPENVINO_ARCH_X86_64)
+    // the kernel clamps the intersection sizes after the addition of 1 for the not normalized boxes, while the
+    // reference returns 0 for the boxes which don't overlap before the addition
+    if (!m_normalized)
+        return;
+
+    auto jcp = jit_nms_config_params();
+    jcp.box_encode_type = NMSBoxEncodeType::CORNER;
+    jcp.store_iou = true;
+
+    if (mayiuse(cpu::x64::avx512_core)) {
+        m_nmsKernel.reset(new jit_uni_nms_kernel_f32<cpu::x64::avx512_core>(jcp));
+    } else if (mayiuse(cpu::x64::avx2)) {
+        m_nmsKernel.reset(new jit_uni_nms_kernel_f32<cpu::x64::avx2>(jcp));
+    } else if (mayiuse(cpu::x64::sse41)) {
+        m_nmsKernel.reset(new jit_uni_nms_kernel_f32<cpu::x64::sse41>(jcp));
+    }
+
+    if (m_nmsKernel)
+        m_nmsKernel->create_ker();
+#endif
 }
 
 bool MatrixNms::created() const {
@@ -194,16 +225,40 @@ size_t MatrixNms::nmsMatrix(const float* boxesData, const float* scoresData, Box
     std::vector<float> iouMatrix((originalSize * (originalSize - 1)) >> 1);
     std::vector<float> iouMax(originalSize);
 
+    // the kernel computes the row of the IoU matrix for the candidates in SoA layout, the reference IoU is used if
+    // any candidate has the corners which the kernel would reorder
+    bool useKernel = m_nmsKernel != nullptr;
+    for (int64_t i = 0; i < originalSize && useKernel; i++)
+        useKernel = isOrderedBox(boxesData + candidateIndex[i] * 4, 0.f);
+    NmsBoxesSoA candidateCoord(useKernel ? originalSize : 0);
+    if (useKernel) {
+        for (int64_t i = 0; i < originalSize; i++)
+            candidateCoord.set(i, boxesData + candidateIndex[i] * 4);
+    }
+
     iouMax[0] = 0.;
     InferenceEngine::parallel_for(originalSize - 1, [&](size_t i) {
         float max_iou = 0.;
         size_t actual_index = i + 1;
         auto idx_a = candidateIndex[actual_index];
-        for (size_t j = 0; j < actual_index; j++) {
-            auto idx_b = candidateIndex[j];
-            auto iou = intersectionOverUnion(boxesData + idx_a * 4, boxesData + idx_b * 4, m_normalized);
-            max_iou = std::max(max_iou, iou);
-            iouMatrix[actual_index * (actual_index - 1) / 2 + j] = iou;
+        float* iouRow = &iouMatrix[actual_index * (actual_index - 1) / 2];
+        if (useKernel) {
+            auto arg = jit_nms_args();
+            for (size_t c = 0; c < BOX_COORD_NUM; c++)
+                arg.selected_boxes_coord[c] = candidateCoord.coord[c].data();
+            arg.selected_boxes_num = actual_index;
+            arg.candidate_box = boxesData + idx_a * 4;
+            arg.iou = iouRow;
+            (*m_nmsKernel)(&arg);
+            for (size_t j = 0; j < actual_index; j++)
+                max_iou = std::max(max_iou, iouRow[j]);
+        } else {
+            for (size_t j = 0; j < actual_index; j++) {
+                auto idx_b = candidateIndex[j];
+                auto iou = intersectionOverUnion(boxesData + idx_a * 4, boxesData + idx_b * 4, m_normalized);
+                max_iou = std::max(max_iou, iou);
+                iouRow[j] = iou;
+            }
         }
         iouMax[actual_index] = max_iou;
     });
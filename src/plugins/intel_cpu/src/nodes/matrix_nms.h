@@ -10,6 +10,7 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include "kernels/x64/nms_kernel.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -104,6 +105,9 @@ private:
                         const std::string type);
 
     size_t nmsMatrix(const float* boxesData, const float* scoresData, BoxInfo* filterBoxes, const int64_t batchIdx, const int64_t classIdx);
+
+    void createJitKernel();
+    std::shared_ptr<jit_uni_nms_kernel> m_nmsKernel = nullptr;
 };
 
 }   // namespace node
@@ -2,10 +2,12 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <string>
 #include <dnnl_types.h>
 #include <dnnl_extension_utils.h>
 #include "memory.hpp"
+#include "concat.h"
 #include "common/cpu_convert.h"
 #include "common/cpu_memcpy.h"
 #include "utils/general_utils.h"
@@ -31,11 +33,6 @@ MemoryNode::MemoryNode(const std::shared_ptr<ngraph::Node>& op) {
 
 bool MemoryOutput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         if (!one_of(op->get_type_info(),
                 ngraph::op::v3::Assign::get_type_info_static(),
                 ngraph::op::v6::Assign::get_type_info_static())) {
@@ -88,11 +85,6 @@ void MemoryOutput::execute(dnnl::stream strm)  {
 
 bool MemoryInput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         if (!one_of(op->get_type_info(),
                 ngraph::op::v3::ReadValue::get_type_info_static(),
                 ngraph::op::v6::ReadValue::get_type_info_static())) {
@@ -106,7 +98,8 @@ bool MemoryInput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>
 }
 
 MemoryInput::MemoryInput(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr ctx)
-        : Input(op, ctx), MemoryNode(op), dataStore(new Memory{ctx->getEngine()}) {
+        : Input(op, ctx), MemoryNode(op), dataStore(new Memory{ctx->getEngine()}), currentState(dataStore),
+          nextState(dataStore) {
     std::string errorMessage;
     if (!isSupportedOperation(op, errorMessage)) {
         IE_THROW(NotImplemented) << errorMessage;
@@ -119,7 +112,16 @@ MemoryInput::MemoryInput(const std::shared_ptr<ngraph::Node>& op, const GraphCon
 void MemoryInput::createPrimitive() {
     Input::createPrimitive();
 
-    dataStore->Create(getChildEdgeAt(0)->getMemory().getDesc());
+    if (isDynamicNode()) {
+        // the state of a variable with a dynamic shape is empty along the dynamic axes by default
+        const auto& dims = getOutputShapeAtPort(0).getMinDims();
+        const bool hasZeroDims = std::count(dims.begin(), dims.end(), 0) > 0;
+        dataStore->Create(getBaseMemDescAtOutputPort(0)->cloneWithNewDims(dims, hasZeroDims));
+        if (getReservedStateSize())
+            appendingConcat = findAppendingConcat();
+    } else {
+        dataStore->Create(getChildEdgeAt(0)->getMemory().getDesc());
+    }
 
     // default memory state is zero filled
     if (dataStore->getDesc().hasDefinedMaxSize())
@@ -137,6 +139,10 @@ static void simple_copy(const Memory& dst, const Memory& src) {
     auto srcPtr = static_cast<uint8_t*>(src.GetPtr());
     auto dstPtr = static_cast<uint8_t*>(dst.GetPtr());
     if (src.GetDataType() == dst.GetDataType()) {
+        // the memory is shared with the state, nothing to copy
+        if (srcPtr == dstPtr)
+            return;
+
         auto srcSizeInByte = src.GetSize();
         auto dstSizeInByte = dst.GetSize();
 
@@ -157,18 +163,94 @@ MemoryPtr MemoryInput::getStore() {
     return dataStore;
 }
 
+size_t MemoryInput::getReservedStateSize() const {
+    const auto reserve = context->getConfig().stateReserve;
+    const auto& shape = getOutputShapeAtPort(0);
+    const auto& dims = shape.getDims();
+    // the capacity is reserved along the only dynamic axis
+    if (!reserve || std::count(dims.begin(), dims.end(), Shape::UNDEFINED_DIM) != 1)
+        return 0;
+
+    size_t size = dataStore->getDesc().getPrecision().size();
+    for (size_t i = 0; i < dims.size(); i++)
+        size *= dims[i] == Shape::UNDEFINED_DIM ? std::min(reserve, shape.getMaxDims()[i]) : dims[i];
+    return size;
+}
+
+Node* MemoryInput::findAppendingConcat() {
+    // the Concat has to be the only consumer, since the state buffer may be reallocated when the Concat output grows
+    if (getChildEdges().size() != 1)
+        return nullptr;
+
+    auto childEdge = getChildEdgeAt(0);
+    auto concat = std::dynamic_pointer_cast<Concat>(childEdge->getChild());
+    if (!concat || childEdge->getOutputNum() != 0 || !concat->canAppendInPlace())
+        return nullptr;
+
+    const auto& stateDesc = dataStore->getDesc();
+    auto canShareOutput = [&stateDesc](const Node& node) {
+        const auto& desc = node.getChildEdgeAt(0)->getMemory().getDesc();
+        if (!desc.hasLayoutType(LayoutType::ncsp) || desc.getPrecision() != stateDesc.getPrecision())
+            return false;
+        for (size_t i = 0; i < node.getChildEdges().size(); i++) {
+            auto child = node.getChildEdgeAt(i)->getChild();
+            if (child->isConstant() || child->isInPlace())
+                return false;
+        }
+        return true;
+    };
+    if (!canShareOutput(*this) || !canShareOutput(*concat))
+        return nullptr;
+
+    for (size_t i = 0; i < concat->getChildEdges().size(); i++) {
+        auto assign = std::dynamic_pointer_cast<MemoryOutput>(concat->getChildEdgeAt(i)->getChild());
+        if (assign && assign->getId() == getId())
+            return concat.get();
+    }
+    return nullptr;
+}
+
+// places the memory of the node outputs into the buffer of the given manager
+static void shareOutputMemory(const Node& node, const DnnlMemoryMngrPtr& mngr) {
+    for (size_t i = 0; i < node.getChildEdges().size(); i++) {
+        auto mem = node.getChildEdgeAt(i)->getMemoryPtr();
+        if (mem->getDnnlMemoryMngr() != mngr)
+            mem->Create(mem->getDescPtr(), mngr);
+    }
+}
+
+void MemoryInput::setStateMemory(MemoryPtr current, MemoryPtr next) {
+    currentState = current;
+    nextState = next;
+    if (!isDynamicNode())
+        return;
+
+    // the growing state is appended by the Concat in place, so the memory nodes have nothing to copy
+    if (appendingConcat && current == next) {
+        shareOutputMemory(*this, current->getDnnlMemoryMngr());
+        shareOutputMemory(*appendingConcat, current->getDnnlMemoryMngr());
+    }
+    redefineOutputMemory({current->getStaticDims()});
+}
+
 void MemoryInput::storeState(const Memory &new_state) {
+    // the shape of the dynamic state follows the assigned value
+    if (isDynamicNode() && nextState->getStaticDims() != new_state.getStaticDims()) {
+        const auto& dims = new_state.getStaticDims();
+        const bool hasZeroDims = std::count(dims.begin(), dims.end(), 0) > 0;
+        nextState->redefineDesc(getBaseMemDescAtOutputPort(0)->cloneWithNewDims(dims, hasZeroDims));
+    }
     // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
+    //           nextState.SetData(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    simple_copy(*nextState, new_state);
 }
 
 void MemoryInput::execute(dnnl::stream strm) {
     // TODO: Should be simple call of:
-    //           dst_mem.SetData(dataStore, false);
+    //           dst_mem.SetData(currentState, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    simple_copy(getChildEdgeAt(0)->getMemory(), *currentState);
 }
 
 MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput * node) {
@@ -68,9 +68,21 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override {}
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
     bool created() const override {
         return getType() == Type::MemoryOutput;
     }
+    bool isExecutable() const override {
+        return true;
+    }
+    bool needShapeInfer() const override {
+        return false;
+    }
+    bool needPrepareParams() const override {
+        return false;
+    }
 
     void setInputNode(Node* node) override {
         inputNode = node;
@@ -97,14 +109,36 @@ public:
         return true;
     }
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
 
     void createPrimitive() override;
 
     void setInputNode(Node* node) override {}
     void storeState(const Memory& mem);
     MemoryPtr getStore();
+    /**
+     * @brief binds the memory the state is read from and the memory the new state is written to,
+     * by default both are the internal store
+     */
+    void setStateMemory(MemoryPtr current, MemoryPtr next);
+    /**
+     * @brief returns the size in bytes reserved up front for the state of a growing variable,
+     * zero if the variable is not a growing one
+     */
+    size_t getReservedStateSize() const;
  private:
+    Node* findAppendingConcat();
+
     MemoryPtr dataStore;
+    MemoryPtr currentState;
+    MemoryPtr nextState;
+    /**
+     * @brief the Concat which appends to the state of a growing variable and whose output is assigned to it,
+     * both the value read by the node and the output of the Concat are placed into the state buffer then
+     */
+    Node* appendingConcat = nullptr;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
@@ -17,9 +17,13 @@
 
 #include "ie_parallel.hpp"
 #include "utils/general_utils.h"
+#include "common/nms_utils.h"
+#include "cpu/x64/jit_generator.hpp"
 #include <utils/shape_inference/shape_inference_internal_dyn.hpp>
 
 using namespace InferenceEngine;
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::x64;
 
 namespace ov {
 namespace intel_cpu {
@@ -134,6 +138,28 @@ void MultiClassNms::initSupportedPrimitiveDescriptors() {
                             {LayoutType::ncsp, Precision::I32}},
                             impl_desc_type::ref_any);
     }
+
+    // the kernel doesn't depend on the shapes, so it's created once
+    createJitKernel();
+}
+
+void MultiClassNms::createJitKernel() {
+#if defined(OPENVINO_ARCH_X86_64)
+    auto jcp = jit_nms_config_params();
+    jcp.box_encode_type = NMSBoxEncodeType::CORNER;
+    jcp.coord_offset = m_normalized ? 0.f : 1.f;
+
+    if (mayiuse(cpu::x64::avx512_core)) {
+        m_nmsKernel.reset(new jit_uni_nms_kernel_f32<cpu::x64::avx512_core>(jcp));
+    } else if (mayiuse(cpu::x64::avx2)) {
+        m_nmsKernel.reset(new jit_uni_nms_kernel_f32<cpu::x64::avx2>(jcp));
+    } else if (mayiuse(cpu::x64::sse41)) {
+        m_nmsKernel.reset(new jit_uni_nms_kernel_f32<cpu::x64::sse41>(jcp));
+    }
+
+    if (m_nmsKernel)
+        m_nmsKernel->create_ker();
+#endif
 }
 
 // shared           Y               N
@@ -441,32 +467,77 @@ void MultiClassNms::nmsWithEta(const float* boxes,
             const float* boxesPtr = slice_class(batch_idx, class_idx, boxes, boxesStrides, true, roisnum, roisnumStrides, shared);
             const float* scoresPtr = slice_class(batch_idx, class_idx, scores, scoresStrides, false, roisnum, roisnumStrides, shared);
 
-            std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
+            std::vector<boxInfo> sorted_boxes;
             int cur_numBoxes = shared ? m_numBoxes : roisnum[batch_idx];
             for (int box_idx = 0; box_idx < cur_numBoxes; box_idx++) {
                 if (scoresPtr[box_idx] >= m_scoreThreshold)  // algin with ref
-                    sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
+                    sorted_boxes.emplace_back(boxInfo({scoresPtr[box_idx], box_idx, 0}));
             }
             fb.reserve(sorted_boxes.size());
             if (sorted_boxes.size() > 0) {
                 auto adaptive_threshold = m_iouThreshold;
                 int max_out_box = (m_nmsRealTopk > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
-                while (max_out_box && !sorted_boxes.empty()) {
-                    boxInfo currBox = sorted_boxes.top();
+
+                // at most max_out_box candidates are visited, so only they are sorted. The boxes with the decayed
+                // scores are returned to the queue.
+                auto greater = [&less](const boxInfo& l, const boxInfo& r) {
+                    return less(r, l);
+                };
+                const size_t sortedNum = sortNextCandidates(sorted_boxes.begin(), sorted_boxes.end(), max_out_box, greater) -
+                                         sorted_boxes.begin();
+                std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> updated_boxes(less);
+                size_t next_idx = 0;
+                auto hasCandidate = [&]() {
+                    return next_idx < sortedNum || !updated_boxes.empty();
+                };
+                auto popCandidate = [&]() {
+                    if (next_idx < sortedNum && (updated_boxes.empty() || less(updated_boxes.top(), sorted_boxes[next_idx])))
+                        return sorted_boxes[next_idx++];
+                    boxInfo box = updated_boxes.top();
+                    updated_boxes.pop();
+                    return box;
+                };
+
+                const float coordOffset = m_normalized ? 0.f : 1.f;
+                NmsBoxesSoA selectedCoord(m_nmsKernel ? max_out_box : 0);
+                bool orderedSelected = true;
+                const float softScale = 0.f;
+                auto arg = jit_nms_args();
+                arg.iou_threshold = &adaptive_threshold;
+                arg.score_threshold = &m_scoreThreshold;
+                arg.scale = &softScale;
+
+                while (max_out_box && hasCandidate()) {
+                    boxInfo currBox = popCandidate();
                     float origScore = currBox.score;
-                    sorted_boxes.pop();
                     max_out_box--;
 
+                    const float* currBoxCoord = &boxesPtr[currBox.idx * 4];
                     bool box_is_selected = true;
-                    for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[currBox.idx * 4], &boxesPtr[fb[idx].box_index * 4], m_normalized);
-                        currBox.score *= func(iou, adaptive_threshold);
-                        if (iou >= adaptive_threshold) {
-                            box_is_selected = false;
-                            break;
+                    // the kernel checks all the selected boxes, the boxes with the threshold score are compared with
+                    // the last selected one only
+                    if (m_nmsKernel && orderedSelected && isOrderedBox(currBoxCoord, coordOffset) &&
+                        currBox.score > m_scoreThreshold) {
+                        int candidateStatus = NMSCandidateStatus::SELECTED;
+                        arg.selected_boxes_num = fb.size() - currBox.suppress_begin_index;
+                        for (size_t c = 0; c < BOX_COORD_NUM; c++)
+                            arg.selected_boxes_coord[c] = selectedCoord.coord[c].data() + currBox.suppress_begin_index;
+                        arg.candidate_box = currBoxCoord;
+                        arg.candidate_status = &candidateStatus;
+                        arg.score = &currBox.score;
+                        (*m_nmsKernel)(&arg);
+                        box_is_selected = candidateStatus == NMSCandidateStatus::SELECTED;
+                    } else {
+                        for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
+                            float iou = intersectionOverUnion(currBoxCoord, &boxesPtr[fb[idx].box_index * 4], m_normalized);
+                            currBox.score *= func(iou, adaptive_threshold);
+                            if (iou >= adaptive_threshold) {
+                                box_is_selected = false;
+                                break;
+                            }
+                            if (currBox.score <= m_scoreThreshold)
+                                break;
                         }
-                        if (currBox.score <= m_scoreThreshold)
-                            break;
                     }
 
                     currBox.suppress_begin_index = fb.size();
@@ -475,11 +546,15 @@ void MultiClassNms::nmsWithEta(const float* boxes,
                             adaptive_threshold *= m_nmsEta;
                         }
                         if (currBox.score == origScore) {
+                            if (m_nmsKernel) {
+                                selectedCoord.set(fb.size(), currBoxCoord);
+                                orderedSelected = orderedSelected && isOrderedBox(currBoxCoord, coordOffset);
+                            }
                             fb.push_back({currBox.score, batch_idx, class_idx, currBox.idx});
                             continue;
                         }
                         if (currBox.score > m_scoreThreshold) {
-                            sorted_boxes.push(currBox);
+                            updated_boxes.push(currBox);
                         }
                     }
                 }
@@ -557,25 +632,58 @@ void MultiClassNms::nmsWithoutEta(const float* boxes,
 
             int io_selection_size = 0;
             if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(), [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                    return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                });
+                int max_out_box = (m_nmsRealTopk > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
+                // only max_out_box candidates are visited, so only they are sorted
+                sortNextCandidates(sorted_boxes.begin(), sorted_boxes.end(), max_out_box,
+                                   [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                                       return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
+                                   });
                 int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
                 m_filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
                 io_selection_size++;
-                int max_out_box = (m_nmsRealTopk > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
+
+                const float coordOffset = m_normalized ? 0.f : 1.f;
+                NmsBoxesSoA selectedCoord(m_nmsKernel ? max_out_box : 0);
+                bool orderedSelected = true;
+                if (m_nmsKernel) {
+                    selectedCoord.set(0, &boxesPtr[sorted_boxes[0].second * 4]);
+                    orderedSelected = isOrderedBox(&boxesPtr[sorted_boxes[0].second * 4], coordOffset);
+                }
+                const float softScale = 0.f;
+                auto arg = jit_nms_args();
+                arg.iou_threshold = &m_iouThreshold;
+                arg.score_threshold = &m_scoreThreshold;
+                arg.scale = &softScale;
+                // box start index do not change for hard supresion
+                for (size_t c = 0; c < BOX_COORD_NUM; c++)
+                    arg.selected_boxes_coord[c] = selectedCoord.coord[c].data();
+
                 for (size_t box_idx = 1; box_idx < max_out_box; box_idx++) {
+                    const float* candidateCoord = &boxesPtr[sorted_boxes[box_idx].second * 4];
                     bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4],
-                            &boxesPtr[m_filtBoxes[offset + idx].box_index * 4], m_normalized);
-                        if (iou >= m_iouThreshold) {
-                            box_is_selected = false;
-                            break;
+                    if (m_nmsKernel && orderedSelected && isOrderedBox(candidateCoord, coordOffset)) {
+                        int candidateStatus = NMSCandidateStatus::SELECTED;
+                        arg.selected_boxes_num = io_selection_size;
+                        arg.candidate_box = candidateCoord;
+                        arg.candidate_status = &candidateStatus;
+                        (*m_nmsKernel)(&arg);
+                        box_is_selected = candidateStatus == NMSCandidateStatus::SELECTED;
+                    } else {
+                        for (int idx = io_selection_size - 1; idx >= 0; idx--) {
+                            float iou = intersectionOverUnion(candidateCoord, &boxesPtr[m_filtBoxes[offset + idx].box_index * 4],
+                                                              m_normalized);
+                            if (iou >= m_iouThreshold) {
+                                box_is_selected = false;
+                                break;
+                            }
                         }
                     }
 
                     if (box_is_selected) {
+                        if (m_nmsKernel) {
+                            selectedCoord.set(io_selection_size, candidateCoord);
+                            orderedSelected = orderedSelected && isOrderedBox(candidateCoord, coordOffset);
+                        }
                         m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx,
                             sorted_boxes[box_idx].second);
                         io_selection_size++;
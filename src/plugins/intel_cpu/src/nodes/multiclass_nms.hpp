@@ -8,6 +8,7 @@
 #include <node.h>
 
 #include <string>
+#include "kernels/x64/nms_kernel.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -110,6 +111,9 @@ private:
                             const int* roisnum,
                             const InferenceEngine::SizeVector& roisnumStrides,
                             const bool shared);
+
+    void createJitKernel();
+    std::shared_ptr<jit_uni_nms_kernel> m_nmsKernel = nullptr;
 };
 
 }   // namespace node
@@ -9,8 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
-
-#define BOX_COORD_NUM 4
+#include "kernels/x64/nms_kernel.hpp"
 
 using namespace InferenceEngine;
 
@@ -18,50 +17,6 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
-enum class NMSBoxEncodeType {
-    CORNER,
-    CENTER
-};
-
-enum NMSCandidateStatus {
-    SUPPRESSED = 0,
-    SELECTED = 1,
-    UPDATED = 2
-};
-
-struct jit_nms_config_params {
-    NMSBoxEncodeType box_encode_type;
-    bool is_soft_suppressed_by_iou;
-};
-
-struct jit_nms_args {
-    const void* selected_boxes_coord[BOX_COORD_NUM];
-    size_t selected_boxes_num;
-    const void* candidate_box;
-    const void* iou_threshold;
-    void* candidate_status;
-    // for soft suppression, score *= scale * iou * iou;
-    const void* score_threshold;
-    const void* scale;
-    void* score;
-};
-
-struct jit_uni_nms_kernel {
-    void (*ker_)(const jit_nms_args *);
-
-    void operator()(const jit_nms_args *args) {
-        assert(ker_);
-        ker_(args);
-    }
-
-    explicit jit_uni_nms_kernel(jit_nms_config_params jcp_) : ker_(nullptr), jcp(jcp_) {}
-    virtual ~jit_uni_nms_kernel() {}
-
-    virtual void create_ker() = 0;
-
-    jit_nms_config_params jcp;
-};
-
 class NonMaxSuppression : public Node {
 public:
     NonMaxSuppression(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context);
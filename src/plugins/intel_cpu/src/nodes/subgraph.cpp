@@ -23,6 +23,7 @@
 #include <snippets/op/subgraph.hpp>
 #include "snippets/pass/matmul_to_brgemm.hpp"
 #include "utils/cpu_utils.hpp"
+#include "utils/debug_capabilities.h"
 #include "emitters/x64/cpu_generator.hpp"
 #include "transformations/snippets/x64/pass/lowered/fuse_load_store_and_convert.hpp"
 #include "transformations/snippets/x64/pass/mul_add_to_fma.hpp"
@@ -84,26 +85,27 @@ Snippet::Snippet(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr c
     }
 }
 
-void Snippet::copy_snippet() {
+std::shared_ptr<snippets::op::Subgraph> Snippet::copy_snippet() {
     ov::OutputVector subgraph_node_inputs;
     for (const auto &input : original_snippet->input_values()) {
         auto new_input = std::make_shared<ov::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
         subgraph_node_inputs.push_back(new_input);
     }
     std::shared_ptr<ov::Model> new_body = original_snippet->body_ptr()->clone();
-    snippet = std::make_shared<snippets::op::Subgraph>(subgraph_node_inputs, new_body);
-    ov::copy_runtime_info(original_snippet, snippet);
-    snippet->set_friendly_name(original_snippet->get_friendly_name());
+    auto subgraph = std::make_shared<snippets::op::Subgraph>(subgraph_node_inputs, new_body);
+    ov::copy_runtime_info(original_snippet, subgraph);
+    subgraph->set_friendly_name(original_snippet->get_friendly_name());
 #if defined(OPENVINO_ARCH_X86_64)
-    snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
-    isa_num_lanes =  snippet->get_generator()->get_target_machine()->get_lanes();
+    subgraph->set_generator(std::make_shared<CPUGenerator>(host_isa));
+    isa_num_lanes =  subgraph->get_generator()->get_target_machine()->get_lanes();
 #else
     IE_THROW(NotImplemented) << "CPU plugin: code-generation is not supported on non-x64 platforms";
 #endif // OPENVINO_ARCH_X86_64
+    return subgraph;
 }
 
 void Snippet::initSupportedPrimitiveDescriptors() {
-    copy_snippet();
+    snippet = copy_snippet();
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
@@ -118,8 +120,9 @@ void Snippet::initSupportedPrimitiveDescriptors() {
     }
 
     const size_t ndims = outputShapes[0].getRank();
-    // Domain sensitive operations support only Planar layout
-    const bool isOnlyPlanarApplicable = snippet->has_domain_sensitive_ops();
+    // Domain sensitive operations support only Planar layout.
+    // Shape inference of dynamic nodes works with planar dims as well
+    const bool isOnlyPlanarApplicable = snippet->has_domain_sensitive_ops() || isDynamic;
     const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1u, 2u, 3u, 4u, 5u) && dimRanksAreEqual && !isOnlyPlanarApplicable;
     // Todo: Snippets currently don't support per-channel broadcasting of Blocked descriptors because
     //  canonicalization can't distinguish between <N, C, H, W, c> and <N, C, D, H, W> cases.
@@ -316,7 +319,7 @@ bool Snippet::optimizeExecDomain(std::vector<VectorDims>& inputShapes, std::vect
     };
     return findDimsToCollapse();
 }
-ov::PartialShape Snippet::canonicalizeBody() {
+ov::PartialShape Snippet::canonicalizeBody(const std::shared_ptr<snippets::op::Subgraph>& subgraph) {
     auto edgeToBlockedShape = [](const EdgePtr& edge) {
         const auto blockedDesc = edge->getMemory().GetDescWithType<BlockedMemoryDesc>();
         std::vector<Dimension> dims;
@@ -346,13 +349,13 @@ ov::PartialShape Snippet::canonicalizeBody() {
         output_blocked_shapes.push_back(blockedShape);
     }
 
-    const auto& canonicalShape = snippet->canonicalize(output_blocked_shapes, input_blocked_shapes);
+    const auto& canonicalShape = subgraph->canonicalize(output_blocked_shapes, input_blocked_shapes);
     return canonicalShape;
 }
 void Snippet::createPrimitive() {
     // determine canonicalize, determine master_shape and prepend up to 6D
     // NB! normInputShapes are updated, so body reshape might be needed
-    const auto& canonicalShape = canonicalizeBody();
+    const auto& canonicalShape = canonicalizeBody(snippet);
     // initialize by maximum output dimension. Dimensions of outputs should be broadcastable
     tensorRank = std::max(static_cast<size_t>(rank6D), canonicalShape.size());
 
@@ -368,6 +371,15 @@ void Snippet::createPrimitive() {
     };
     initDataSizes();
 
+    if (isDynamic) {
+        // The kernels of dynamic nodes are generated for the actual shapes in prepareParams.
+        // Elementwise bodies are lowered to shape-agnostic kernels which are reused for other shapes
+        isShapeAgnostic = !snippet->has_domain_sensitive_ops() && !snippet->is_quantized();
+        normInputShapes.resize(inputShapes.size());
+        normOutputShapes.resize(outputShapes.size());
+        return;
+    }
+
     jit_snippets_compile_args jcp;
     if (canonicalShape.is_dynamic())
         IE_THROW() << "Snippets: Canonicalization returned dynamic shape in static pipeline";
@@ -381,7 +393,7 @@ void Snippet::createPrimitive() {
     prepareParams();
     jcp.master_shape = masterShape;
     jcp.tile_rank = tileRank;
-    generate(&jcp);
+    schedule = generate(snippet, &jcp);
     buffer_scratchpad_size = snippet->get_buffer_scratchpad_size();
     buffer_scratchpad.resize(buffer_scratchpad_size * parallel_get_max_threads(), 0);
 }
@@ -499,6 +511,18 @@ void Snippet::prepareParams() {
         dim = 1;
     }
 
+    if (isDynamic) {
+        if (isShapeAgnostic)
+            isShapeAgnostic = prepareShapeAgnosticKernel();
+        if (!isShapeAgnostic) {
+            dynamicKernel = generateKernel(false);
+            schedule = dynamicKernel.schedule;
+            buffer_scratchpad_size = dynamicKernel.subgraph->get_buffer_scratchpad_size();
+            buffer_scratchpad.resize(buffer_scratchpad_size * parallel_get_max_threads(), 0);
+        }
+        return;
+    }
+
     if (dims_collapsed) {
         std::vector<ov::Shape> new_shapes;
         for (int i = 0; i < normInputShapes.size(); i++) {
@@ -546,10 +570,125 @@ bool Snippet::created() const {
     return getType() == Type::Subgraph;
 }
 
-void Snippet::generate(const jit_snippets_compile_args* jcp) {
+Snippet::GeneratedKernel Snippet::generateKernel(bool shapeAgnostic) {
+    // the body of the copy is reshaped to the actual shapes and lowered, the copy owns the generated code
+    const auto subgraph = copy_snippet();
+    canonicalizeBody(subgraph);
+    const auto& params = subgraph->body_ptr()->get_parameters();
+    std::vector<ov::Shape> new_shapes;
+    for (size_t i = 0; i < normInputShapes.size(); i++) {
+        // shape-agnostic kernels are lowered for the full-rank shapes, so the Loop dims match the ones of runtime args
+        const auto& norm_shape = normInputShapes[i];
+        const size_t rank = shapeAgnostic ? norm_shape.size() : params[i]->get_partial_shape().size();
+        new_shapes.emplace_back(norm_shape.end() - rank, norm_shape.end());
+    }
+    subgraph->reshape_body(new_shapes);
+    subgraph->set_master_shape(ov::PartialShape(masterShape));
+    subgraph->set_tile_rank(tileRank);
+    subgraph->set_shape_agnostic(shapeAgnostic);
+
+    jit_snippets_compile_args jcp;
+    jcp.master_shape = masterShape;
+    jcp.tile_rank = tileRank;
+    jcp.shape_agnostic = shapeAgnostic;
+    return {subgraph, generate(subgraph, &jcp)};
+}
+
+bool Snippet::prepareShapeAgnosticKernel() {
+    // the kernel depends only on the tile rank and on the dims equal to 1 (they define broadcasting and Load counts)
+    std::vector<bool> key{tileRank == maxTileRank};
+    auto appendBroadcastingPattern = [&key](const VectorDims& dims) {
+        for (const auto& d : dims)
+            key.push_back(d == 1);
+    };
+    for (const auto& dims : normInputShapes)
+        appendBroadcastingPattern(dims);
+    for (const auto& dims : normOutputShapes)
+        appendBroadcastingPattern(dims);
+
+    auto found = shapeAgnosticKernels.find(key);
+    if (found == shapeAgnosticKernels.end()) {
+        GeneratedKernel generated;
+        try {
+            generated = generateKernel(true);
+        } catch (const std::exception& ex) {
+            // e.g. the kernel is out of GPRs since the runtime Loop args pointer stays reserved,
+            // the kernels generated for the actual shapes are used instead
+            DEBUG_LOG("Shape-agnostic kernel generation failed for ", getName(), ": ", ex.what());
+            return false;
+        }
+        // all the Loop ports must be bound to inputs or outputs, so the runtime args could be computed for them
+        const auto& loops = generated.schedule.runtime_loops;
+        const bool isSupported = generated.subgraph->get_buffer_scratchpad_size() == 0 &&
+            std::all_of(loops.begin(), loops.end(), [](const snippets::RuntimeLoopInfo& loop) {
+                return loop.io_indexes.size() <= SNIPPETS_MAX_SNIPPETS_DIMS &&
+                       std::none_of(loop.io_indexes.begin(), loop.io_indexes.end(), [](size_t idx) {
+                           return idx == snippets::RuntimeLoopInfo::UNDEFINED_IO;
+                       });
+            });
+        if (!isSupported)
+            return false;
+        found = shapeAgnosticKernels.emplace(std::move(key), std::move(generated)).first;
+    }
+    schedule = found->second.schedule;
+    buffer_scratchpad_size = 0;
+    initLoopArgs();
+    initDataOffsets();
+    return true;
+}
+
+void Snippet::initLoopArgs() {
+    const size_t numInputs = normInputShapes.size();
+    auto getShape = [&](size_t ioIdx) -> const VectorDims& {
+        return ioIdx < numInputs ? normInputShapes[ioIdx] : normOutputShapes[ioIdx - numInputs];
+    };
+    const auto& loops = schedule.runtime_loops;
+    loopArgs.resize(loops.size());
+    for (size_t i = 0; i < loops.size(); i++) {
+        const auto& loop = loops[i];
+        auto& args = loopArgs[i];
+        args = jit_snippets_loop_args();
+        const size_t dim = tensorRank - 1 - loop.dim_idx;
+        // The same values as InitLoops sets in the static case: the work amount is the maximal dim of the ports,
+        // pointers of the broadcasted ports aren't incremented
+        int64_t workAmount = 1;
+        for (const auto& ioIdx : loop.io_indexes)
+            workAmount = std::max(workAmount, static_cast<int64_t>(getShape(ioIdx)[dim]));
+        args.work_amount = loop.tail_of != 0 ? workAmount % static_cast<int64_t>(loop.tail_of) : workAmount;
+        for (size_t j = 0; j < loop.io_indexes.size(); j++) {
+            const auto& shape = getShape(loop.io_indexes[j]);
+            int64_t ptrIncrement = 0;
+            if (!(shape[dim] == 1 && workAmount != 1))
+                ptrIncrement = std::accumulate(shape.begin() + dim + 1, shape.end(), int64_t(1), std::multiplies<int64_t>());
+            const auto dataSize = loop.element_type_sizes[j];
+            args.ptr_increments[j] = ptrIncrement * static_cast<int64_t>(loop.increment) * dataSize;
+            args.finalization_offsets[j] = loop.apply_finalization ? -ptrIncrement * workAmount * dataSize : 0;
+        }
+    }
+}
+
+void Snippet::initDataOffsets() {
+    // The same offsets as KernelEmitter applies in the static case: the last dim is processed by the kernel,
+    // broadcasted dims have zero strides
+    const size_t numInputs = normInputShapes.size();
+    const size_t numParams = numInputs + normOutputShapes.size();
+    dataOffsets.resize(numParams);
+    for (size_t i = 0; i < numParams; i++) {
+        const auto& shape = i < numInputs ? normInputShapes[i] : normOutputShapes[i - numInputs];
+        auto& offsets = dataOffsets[i];
+        offsets.assign(shape.size() - 1, 0);
+        ptrdiff_t dimStep = dataSize[i];
+        for (int k = static_cast<int>(shape.size()) - 2; k >= 0; k--) {
+            dimStep *= shape[k + 1];
+            offsets[k] = shape[k] != 1 ? dimStep : 0;
+        }
+    }
+}
+
+snippets::Schedule Snippet::generate(const std::shared_ptr<snippets::op::Subgraph>& subgraph, const jit_snippets_compile_args* jcp) {
     ov::pass::Manager pre_dialect;
     pre_dialect.register_pass<ConvertToSwishCPU>();
-    if (context->getConfig().enforceBF16 && snippet->has_domain_sensitive_ops()) {
+    if (context->getConfig().enforceBF16 && subgraph->has_domain_sensitive_ops()) {
         // enforce BF16 precisions to supported operations
         // MatMul has to be decomposed to Brgemm operations before enforcement
         // Note, MatMul decomposition will be ran later again for case if BF16 enforcement is not happened
@@ -567,7 +706,7 @@ void Snippet::generate(const jit_snippets_compile_args* jcp) {
     ov::snippets::lowered::pass::PassPipeline control_flow_pipeline;
     CPU_REGISTER_PASS_X64(control_flow_pipeline, ov::intel_cpu::pass::FuseLoadStoreConvert);
 
-    schedule = snippet->generate(
+    return subgraph->generate(
         pre_dialect,
         post_dialect,
         post_precision,
@@ -586,6 +725,25 @@ void Snippet::update_ptrs(jit_snippets_call_args& call_args) {
         call_args.buffer_scratchpad_ptr =
                 reinterpret_cast<uint8_t*>(buffer_scratchpad.data()) + parallel_get_thread_num() * buffer_scratchpad_size;
     }
+
+    if (isShapeAgnostic)
+        call_args.loop_args = loopArgs.data();
+}
+
+void Snippet::offset_ptrs(jit_snippets_call_args& call_args, const int64_t* indexes) const {
+    auto getOffset = [&](size_t i) {
+        const auto& offsets = dataOffsets[i];
+        ptrdiff_t offset = 0;
+        for (size_t j = 0; j < offsets.size(); j++)
+            offset += offsets[j] * indexes[j];
+        return offset;
+    };
+    const size_t numInputs = srcMemPtrs.size();
+    for (size_t i = 0; i < numInputs; i++)
+        call_args.src_ptrs[i] = reinterpret_cast<const uint8_t*>(call_args.src_ptrs[i]) + getOffset(i);
+
+    for (size_t i = 0; i < dstMemPtrs.size(); i++)
+        call_args.dst_ptrs[i] = reinterpret_cast<uint8_t*>(call_args.dst_ptrs[i]) + getOffset(i + numInputs);
 }
 
 void Snippet::execute(dnnl::stream strm) {
@@ -599,6 +757,10 @@ void Snippet::execute(dnnl::stream strm) {
     }
 }
 
+void Snippet::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
 void Snippet::schedule_6d() {
     const auto& dom = exec_domain;
     // < N, C, H, W > < 1, 1, N, C*H*W>
@@ -607,6 +769,8 @@ void Snippet::schedule_6d() {
             int64_t indexes[] = {d0, d1, d2, d3, d4};
             jit_snippets_call_args call_args;
             update_ptrs(call_args);
+            if (isShapeAgnostic)
+                offset_ptrs(call_args, indexes);
 
             schedule.get_callable<kernel>()(indexes, &call_args);
         });
@@ -629,7 +793,13 @@ void Snippet::schedule_nt() {
                 tmp /= work_size[j];
             }
 
-            schedule.get_callable<kernel>()(indexes.data(), &call_args);
+            if (isShapeAgnostic) {
+                auto offset_call_args = call_args;
+                offset_ptrs(offset_call_args, indexes.data());
+                schedule.get_callable<kernel>()(indexes.data(), &offset_call_args);
+            } else {
+                schedule.get_callable<kernel>()(indexes.data(), &call_args);
+            }
         }
     });
 }
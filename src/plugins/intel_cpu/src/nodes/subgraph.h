@@ -14,6 +14,7 @@
 #include "snippets/op/subgraph.hpp"
 
 #include <array>
+#include <map>
 
 namespace ov {
 namespace intel_cpu {
@@ -47,23 +48,38 @@ public:
 
     // if generator is set, it would execute generated code otherwise it would fallback to nGraph reference
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override;
 
 private:
     static const size_t rank6D {6};
 
     typedef void (*kernel)(const void *, const void *);
 
+    // Generated code is owned by the generator of the subgraph copy it was generated for
+    struct GeneratedKernel {
+        std::shared_ptr<snippets::op::Subgraph> subgraph;
+        snippets::Schedule schedule;
+    };
+
     // Create a deep local copy of the input snippet to perform canonicalization & code generation
     // TODO: Probably better to implement a proper copy constructor
     // NOTE: Before call mutex should be initialized
-    void copy_snippet();
+    std::shared_ptr<snippets::op::Subgraph> copy_snippet();
 
-    ov::PartialShape canonicalizeBody();
+    ov::PartialShape canonicalizeBody(const std::shared_ptr<snippets::op::Subgraph>& subgraph);
     // returns true if exec domain was modified
     bool optimizeExecDomain(std::vector<VectorDims>&, std::vector<VectorDims>&, VectorDims&, size_t&) const;
 
-    void generate(const jit_snippets_compile_args*);
+    snippets::Schedule generate(const std::shared_ptr<snippets::op::Subgraph>& subgraph, const jit_snippets_compile_args*);
+    // Dynamic nodes: generates a kernel for the actual normalized shapes on a separate copy of the snippet
+    GeneratedKernel generateKernel(bool shapeAgnostic);
+    // Dynamic nodes: takes the shape-agnostic kernel from the cache (or generates it) and computes its runtime args,
+    // returns false if the body can't be lowered to a shape-agnostic kernel (including the generation failures)
+    bool prepareShapeAgnosticKernel();
+    void initLoopArgs();
+    void initDataOffsets();
     inline void update_ptrs(jit_snippets_call_args&);
+    inline void offset_ptrs(jit_snippets_call_args&, const int64_t* indexes) const;
     // Evaluates generated snippet using parallel backend
     void schedule_6d();
     void schedule_nt();
@@ -110,6 +126,17 @@ private:
     // Buffer scratchpad
     std::vector<uint8_t> buffer_scratchpad = {};
     size_t buffer_scratchpad_size = 0;
+
+    // Dynamic nodes with elementwise bodies use shape-agnostic kernels. Such a kernel depends only on the tile rank
+    // and the broadcasting pattern of the normalized shapes, which are the key of the cache. Loop parameters and
+    // data offsets are computed for the actual shapes in prepareParams.
+    bool isShapeAgnostic = false;
+    std::map<std::vector<bool>, GeneratedKernel> shapeAgnosticKernels = {};
+    std::vector<jit_snippets_loop_args> loopArgs = {};
+    // offsets of the data pointers in bytes per every harness dim
+    std::vector<std::vector<ptrdiff_t>> dataOffsets = {};
+    // the kernel generated for the actual shapes if the shape-agnostic one isn't applicable
+    GeneratedKernel dynamicKernel = {};
 };
 
 }   // namespace node
@@ -4,6 +4,9 @@
 
 #include "tensoriterator.h"
 
+#include <algorithm>
+#include <array>
+#include <numeric>
 #include <string>
 #include <vector>
 #include <dnnl_extension_utils.h>
@@ -145,6 +148,96 @@ private:
     int iter_count;
 };
 
+/**
+ * Binds the memory of the body port to the chunk of the outer tensor for each iteration, so the body reads the sliced
+ * input or writes the sliced output in place. It is used instead of PortIteratorHelper if the chunk is a contiguous
+ * block of the outer tensor and the body port has the same plain layout.
+ */
+class PortViewHelper : public PortMapHelper {
+public:
+    PortViewHelper(const MemoryPtr &full, const std::vector<MemoryPtr> &part, const PortMap &slice_rule)
+                   : full_mem(full), part_mems(part) {
+        const auto abs_stride = std::abs(slice_rule.stride);
+        iter_count = full->getStaticDims()[slice_rule.axis] / abs_stride;
+
+        chunk_stride_in_byte = part.front()->GetSize();
+        chunk_offset_in_byte = slice_rule.stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= slice_rule.stride < 0 ? -1 : 1;
+    }
+
+    static bool isApplicable(const MemoryPtr &full, const MemoryPtr &part, const PortMap &slice_rule) {
+        const auto &full_desc = full->getDesc();
+        const auto &part_desc = part->getDesc();
+        if (!full_desc.hasLayoutType(LayoutType::ncsp) || !part_desc.hasLayoutType(LayoutType::ncsp) ||
+            full_desc.getPrecision() != part_desc.getPrecision())
+            return false;
+
+        auto chunk_dims = full->getStaticDims();
+        chunk_dims[slice_rule.axis] = std::abs(slice_rule.stride);
+        if (chunk_dims != part->getStaticDims())
+            return false;
+        // the chunks are contiguous if the outer dimensions are 1 and both memories are dense
+        const auto elem_size = full_desc.getPrecision().size();
+        const auto &full_dims = full->getStaticDims();
+        const auto full_size = std::accumulate(full_dims.begin(), full_dims.end(), elem_size, std::multiplies<size_t>());
+        const auto chunk_size = std::accumulate(chunk_dims.begin(), chunk_dims.end(), elem_size, std::multiplies<size_t>());
+        return std::all_of(chunk_dims.begin(), chunk_dims.begin() + slice_rule.axis, [](size_t dim) { return dim == 1; }) &&
+               full->GetSize() == full_size && part->GetSize() == chunk_size;
+    }
+
+    void execute(dnnl::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        auto chunk_ptr = static_cast<uint8_t *>(full_mem->GetPtr()) + chunk_offset_in_byte + chunk_stride_in_byte * iter;
+        for (auto &mem : part_mems)
+            mem->setDataHandle(chunk_ptr);
+    }
+
+private:
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    MemoryPtr full_mem;
+    std::vector<MemoryPtr> part_mems;
+
+    int iter_count;
+};
+
+/**
+ * Passes the body output to the body input of the next iteration by swapping two buffers bound to them instead of
+ * copying the data. The buffers are owned by the helper, since the body memory of the ports may be reused by the other
+ * body tensors while the port data is alive.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const MemoryPtr &from, const std::vector<MemoryPtr> &to, const dnnl::engine& eng)
+                       : from_mem(from), to_mems(to) {
+        for (auto &buffer : buffers) {
+            buffer = std::make_shared<Memory>(eng);
+            buffer->Create(to.front()->getDescPtr());
+        }
+        bind();
+    }
+
+    void execute(dnnl::stream strm, int iter = -1) override {
+        if (iter != 0) {
+            std::swap(buffers[0], buffers[1]);
+            bind();
+        }
+    }
+
+private:
+    void bind() {
+        for (auto &mem : to_mems)
+            mem->setDataHandle(buffers[0]->GetData());
+        from_mem->setDataHandle(buffers[1]->GetData());
+    }
+
+    MemoryPtr from_mem;
+    std::vector<MemoryPtr> to_mems;
+    std::array<MemoryPtr, 2> buffers;
+};
+
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(MultiCachePtr cache, const MemoryPtr &from, const MemoryPtr &to, const dnnl::engine& eng) {
@@ -415,6 +508,7 @@ void TensorIterator::getSupportedDescriptors() {
         auto inNode = inMap.find(param->get_friendly_name());
         if (inNode != inMap.end()) {
             input_mems.push_back(getToMemories(inNode->second.get(), 0));
+            input_nodes.push_back(inNode->second);
         }
     }
 
@@ -426,6 +520,7 @@ void TensorIterator::getSupportedDescriptors() {
         if (outNode != outMap.end()) {
             auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
             output_mem.push_back(outMem);
+            output_edges.push_back(outNode->second->getParentEdgeAt(0));
         }
     }
 
@@ -548,6 +643,7 @@ void TensorIterator::prepareParams() {
     first_mappers.clear();
     before_mappers.clear();
     back_mappers.clear();
+    redirected_mems.clear();
 
     if ((lastUsedCond && lastUsedTripCount != 0) || !isDynamicNode()) {
         reshapeSubgraphInput();
@@ -637,24 +733,39 @@ void TensorIterator::prepareInputPorts() {
         auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &to_mem = input_mems[map_rule.to].front();  // first memory is enough to access the shared underlying physical memory
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             first_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
-        else
+        } else if (!isDynamicNode() && PortViewHelper::isApplicable(from_mem, to_mem, map_rule) &&
+                   canChangeChildEdgesPtr(input_nodes[map_rule.to]) && redirected_mems.insert(to_mem->GetData()).second) {
+            before_mappers.emplace_back(std::make_shared<PortViewHelper>(from_mem, input_mems[map_rule.to], map_rule));
+        } else {
             before_mappers.emplace_back(
                     std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, true, map_rule, eng));
+        }
     }
 }
 
+bool TensorIterator::isBodyInputMemory(const MemoryPtr& mem) const {
+    return std::any_of(input_mems.begin(), input_mems.end(), [&mem](const std::vector<MemoryPtr>& mems) {
+        return mems.front()->GetData() == mem->GetData();
+    });
+}
+
 void TensorIterator::prepareOutputPorts() {
     const auto &eng = getEngine();
     for (auto map_rule : outputPortMap) {
         auto &to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &from_mem = output_mem[map_rule.to];
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             last_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
-        else
+        } else if (PortViewHelper::isApplicable(to_mem, from_mem, map_rule) && !isBodyInputMemory(from_mem) &&
+                   canChangeParentEdgePtr(output_edges[map_rule.to]) && redirected_mems.insert(from_mem->GetData()).second) {
+            // the body writes the chunk of the output directly, so the view is bound before the iteration
+            before_mappers.emplace_back(std::make_shared<PortViewHelper>(to_mem, std::vector<MemoryPtr>{from_mem}, map_rule));
+        } else {
             after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, false, map_rule, eng));
+        }
     }
 }
 
@@ -664,7 +775,15 @@ void TensorIterator::prepareBackEdges() {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mems[map_rule.to].front();
 
-        before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+        if (from_mem->GetData() != to_mem->GetData() && from_mem->getDesc().isCompatible(to_mem->getDesc()) &&
+            canChangeChildEdgesPtr(input_nodes[map_rule.to]) && canChangeParentEdgePtr(output_edges[map_rule.from]) &&
+            !redirected_mems.count(from_mem->GetData()) && !redirected_mems.count(to_mem->GetData())) {
+            redirected_mems.insert(from_mem->GetData());
+            redirected_mems.insert(to_mem->GetData());
+            before_mappers.emplace_back(std::make_shared<BackEdgeSwapHelper>(from_mem, input_mems[map_rule.to], eng));
+        } else {
+            before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+        }
     }
 }
 
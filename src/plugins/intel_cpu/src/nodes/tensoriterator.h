@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <unordered_set>
 #include <common/memory_desc_wrapper.hpp>
 
 namespace ov {
@@ -132,6 +133,7 @@ private:
     void prepareContinueCond();
     void prepareInitialCond();
     void prepareTripCount();
+    bool isBodyInputMemory(const MemoryPtr& mem) const;
 
     /* Dynamic support */
     void reshapeSubgraphInput();
@@ -143,6 +145,10 @@ private:
     Graph sub_graph;
     std::vector<std::vector<MemoryPtr>> input_mems;
     std::vector<MemoryPtr> output_mem;
+    std::vector<NodePtr> input_nodes;
+    std::vector<EdgePtr> output_edges;
+    // the body memories bound to the outer tensors or to the back edge buffers, identified by their original data
+    std::unordered_set<const void*> redirected_mems;
 
     std::vector<std::shared_ptr<PortMapHelper>>
         first_mappers,   /// < Applied once before loop
@@ -7,6 +7,7 @@
 #include <string>
 #include <vector>
 #include <set>
+#include <cstring>
 #include <onednn/dnnl.h>
 #include <dnnl_extension_utils.h>
 #include "emitters/x64/jit_load_store_emitters.hpp"
@@ -1790,6 +1791,166 @@ private:
 };
 #endif
 
+namespace {
+
+// the threshold select outperforms the comparison based algorithms starting from these sizes of the axis and K
+constexpr size_t radix_select_min_axis = 4096;
+constexpr int radix_select_min_k = 32;
+
+constexpr int radix_bits = 8;
+constexpr size_t radix_size = 1 << radix_bits;
+constexpr int radix_top_shift = 32 - radix_bits;
+
+// the number of the elements whose keys are computed at once, so the branchless key computation is vectorized
+constexpr size_t radix_block = 256;
+
+// Order preserving maps of the supported data types to the unsigned keys. The narrow types are placed into the most
+// significant bits, so the select is completed by the first passes.
+inline uint32_t radix_float_key(uint32_t bits) {
+    // -0.0 is equal to +0.0 for the comparison based algorithms, so it gets the same key
+    bits = bits == 0x80000000u ? 0u : bits;
+    // the negative values have all the bits inverted, the positive ones only the sign bit
+    return bits ^ (static_cast<uint32_t>(static_cast<int32_t>(bits) >> 31) | 0x80000000u);
+}
+
+inline uint32_t radix_key(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return radix_float_key(bits);
+}
+
+inline uint32_t radix_key(uint16_t bf16_bits) {
+    return radix_float_key(static_cast<uint32_t>(bf16_bits) << 16);
+}
+
+inline uint32_t radix_key(int32_t value) {
+    return static_cast<uint32_t>(value) ^ 0x80000000u;
+}
+
+inline uint32_t radix_key(int8_t value) {
+    return static_cast<uint32_t>(static_cast<int32_t>(value) + 128) << 24;
+}
+
+inline uint32_t radix_key(uint8_t value) {
+    return static_cast<uint32_t>(value) << 24;
+}
+
+template <typename T>
+inline void radix_keys(const T *src, size_t n, uint32_t flip, uint32_t *keys) {
+    for (size_t i = 0; i < n; i++)
+        keys[i] = radix_key(src[i]) ^ flip;
+}
+
+// The digit which contains the k-th greatest key, 'above' is set to the number of the keys with the greater digits
+inline size_t radix_threshold_digit(const size_t *hist, size_t k, size_t &above) {
+    size_t digit = radix_size - 1;
+    above = 0;
+    for (; digit > 0 && above + hist[digit] < k; digit--)
+        above += hist[digit];
+    return digit;
+}
+
+/**
+ * Selects the k elements with the greatest keys (the keys are xor-ed with 'flip', so the min mode selects the least
+ * values) by the MSB radix select: the histogram of the top digit of the whole row gives the digit of the threshold,
+ * the elements with the greater digits are selected and the ones with the equal digit become the candidates, which are
+ * refined by the next digits. The candidates keep the order of the indices, so from the equal keys the ones with the
+ * lower indices are selected. The first pass over the row is split between 'nthr' threads.
+ * The keys are computed by blocks with the vectorized loop, while the histogram updates and the scatter of the selected
+ * elements are scalar, as their destinations depend on the data.
+ */
+template <typename T>
+void radix_select_row(const T *src, size_t n, size_t k, uint32_t flip, int nthr,
+                      std::vector<topk_radix_item> &sel, std::vector<topk_radix_item> &cand,
+                      std::vector<size_t> &hists) {
+    hists.assign(nthr * radix_size, 0);
+    auto run = [nthr](const std::function<void(int)> &body) {
+        if (nthr == 1)
+            body(0);
+        else
+            parallel_nt(nthr, [&](const int ithr, const int) { body(ithr); });
+    };
+
+    run([&](int ithr) {
+        size_t start = 0, end = 0;
+        splitter(n, nthr, ithr, start, end);
+        auto hist = &hists[ithr * radix_size];
+        uint32_t keys[radix_block];
+        for (size_t b = start; b < end; b += radix_block) {
+            const size_t len = std::min(radix_block, end - b);
+            radix_keys(src + b, len, flip, keys);
+            for (size_t i = 0; i < len; i++)
+                hist[keys[i] >> radix_top_shift]++;
+        }
+    });
+
+    size_t total[radix_size] = {};
+    for (int ithr = 0; ithr < nthr; ithr++) {
+        for (size_t d = 0; d < radix_size; d++)
+            total[d] += hists[ithr * radix_size + d];
+    }
+    size_t above = 0;
+    const size_t digit = radix_threshold_digit(total, k, above);
+
+    // the offsets of the threads in the selected and the candidate arrays preserve the order of the indices
+    std::vector<size_t> sel_offs(nthr + 1, 0), cand_offs(nthr + 1, 0);
+    for (int ithr = 0; ithr < nthr; ithr++) {
+        const auto hist = &hists[ithr * radix_size];
+        size_t thr_above = 0;
+        for (size_t d = digit + 1; d < radix_size; d++)
+            thr_above += hist[d];
+        sel_offs[ithr + 1] = sel_offs[ithr] + thr_above;
+        cand_offs[ithr + 1] = cand_offs[ithr] + hist[digit];
+    }
+    sel.resize(k);
+    cand.resize(total[digit]);
+
+    run([&](int ithr) {
+        size_t start = 0, end = 0;
+        splitter(n, nthr, ithr, start, end);
+        auto sel_ptr = sel.data() + sel_offs[ithr];
+        auto cand_ptr = cand.data() + cand_offs[ithr];
+        uint32_t keys[radix_block];
+        for (size_t b = start; b < end; b += radix_block) {
+            const size_t len = std::min(radix_block, end - b);
+            radix_keys(src + b, len, flip, keys);
+            for (size_t i = 0; i < len; i++) {
+                const size_t d = keys[i] >> radix_top_shift;
+                if (d > digit)
+                    *sel_ptr++ = {keys[i], static_cast<int32_t>(b + i)};
+                else if (d == digit)
+                    *cand_ptr++ = {keys[i], static_cast<int32_t>(b + i)};
+            }
+        }
+    });
+
+    size_t sel_count = above;
+    size_t need = k - above;
+    for (int shift = radix_top_shift - radix_bits; shift >= 0 && cand.size() > need; shift -= radix_bits) {
+        size_t hist[radix_size] = {};
+        for (const auto &item : cand)
+            hist[(item.key >> shift) & (radix_size - 1)]++;
+        size_t cand_above = 0;
+        const size_t cand_digit = radix_threshold_digit(hist, need, cand_above);
+
+        size_t cand_count = 0;
+        for (const auto &item : cand) {
+            const size_t d = (item.key >> shift) & (radix_size - 1);
+            if (d > cand_digit)
+                sel[sel_count++] = item;
+            else if (d == cand_digit)
+                cand[cand_count++] = item;
+        }
+        cand.resize(cand_count);
+        need -= cand_above;
+    }
+
+    // the rest of the candidates either fit entirely or have the equal keys
+    std::copy(cand.begin(), cand.begin() + need, sel.begin() + sel_count);
+}
+
+}   // namespace
+
 bool TopK::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!one_of(op->get_type_info(), ov::op::v1::TopK::get_type_info_static(),
@@ -2060,7 +2221,16 @@ void TopK::prepareParams() {
         }
         dim = static_cast<int>(src_dims[axis]);
         before_num = count(src_dims, 0, axis);
+        calc_dims_size(dstMemPtr->GetDescWithType<BlockedMemoryDesc>()->getBlockDims());
     }
+
+    // [case 0]: for the long axis and the large K the threshold select followed by the sorting of the selected elements
+    //           only is applied instead of any of the above algorithms, it requires the sorting axis to be contiguous.
+    data_precision = srcMemPtr->getDesc().getPrecision();
+    radix_select = context->getConfig().topkRadixSelect && layout != TopKLayoutType::topk_blocked && I == 1 &&
+                   src_dims[axis] >= radix_select_min_axis && top_k >= radix_select_min_k &&
+                   one_of(data_precision, Precision::FP32, Precision::BF16, Precision::I32,
+                          Precision::I8, Precision::U8);
 }
 
 void TopK::createPrimitive() {
@@ -2079,7 +2249,8 @@ void TopK::createPrimitive() {
         updateLastInputDims();
     }
 
-    if (jit_mode) {
+    // the kernel is not used by a static node which always runs the threshold select
+    if (jit_mode && (isDynamicNode() || !radix_select)) {
         if (!preset_params_done) {
             preset_params();
             preset_params_done = true;
@@ -2145,7 +2316,9 @@ void TopK::execute(dnnl::stream strm) {
     uint8_t *dst_data = reinterpret_cast<uint8_t *>(dstMemPtr->GetPtr());
     uint8_t *dst_idx = reinterpret_cast<uint8_t *>(dstIndexesMemPtr->GetPtr());
 
-    if (jit_mode) {
+    if (radix_select) {
+        topk_radix_select_process(src_data, dst_data, dst_idx);
+    } else if (jit_mode) {
         topk_process(src_data, dst_data, dst_idx);
     } else {
         if (layout == TopKLayoutType::topk_ncsp) {
@@ -2212,6 +2385,76 @@ void TopK::topk_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *out_id
     }
 }
 
+void TopK::topk_radix_select_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *out_idx_ptr) {
+    auto out_idx = reinterpret_cast<int32_t *>(out_idx_ptr);
+    switch (data_precision) {
+        case Precision::FP32:
+            topk_radix_select(reinterpret_cast<const float *>(in_ptr), reinterpret_cast<float *>(out_ptr), out_idx);
+            break;
+        case Precision::BF16:
+            topk_radix_select(reinterpret_cast<const uint16_t *>(in_ptr), reinterpret_cast<uint16_t *>(out_ptr),
+                              out_idx);
+            break;
+        case Precision::I32:
+            topk_radix_select(reinterpret_cast<const int32_t *>(in_ptr), reinterpret_cast<int32_t *>(out_ptr), out_idx);
+            break;
+        case Precision::I8:
+            topk_radix_select(reinterpret_cast<const int8_t *>(in_ptr), reinterpret_cast<int8_t *>(out_ptr), out_idx);
+            break;
+        case Precision::U8:
+            topk_radix_select(reinterpret_cast<const uint8_t *>(in_ptr), reinterpret_cast<uint8_t *>(out_ptr), out_idx);
+            break;
+        default:
+            IE_THROW() << errorPrefix << " doesn't support the threshold select for precision " << data_precision;
+    }
+}
+
+// The rows are processed in parallel if there are enough of them to load all the threads, otherwise the first pass
+// over each row is split between the threads.
+template <typename T>
+void TopK::topk_radix_select(const T *in_ptr, T *out_ptr, int32_t *out_idx_ptr) {
+    const size_t k = static_cast<size_t>(top_k);
+    const uint32_t flip = mode_max ? 0u : ~0u;
+    const int nthr = parallel_get_max_threads();
+
+    if (vec_radix_sel.size() < static_cast<size_t>(nthr)) {
+        vec_radix_sel.resize(nthr);
+        vec_radix_cand.resize(nthr);
+        vec_radix_hist.resize(nthr);
+    }
+
+    auto process_row = [&](size_t o, int row_nthr, int ithr) {
+        auto &sel = vec_radix_sel[ithr];
+        radix_select_row(in_ptr + o * A, A, k, flip, row_nthr, sel, vec_radix_cand[ithr], vec_radix_hist[ithr]);
+        if (sort_index) {
+            std::sort(sel.begin(), sel.end(), [](const topk_radix_item &a, const topk_radix_item &b) {
+                return a.idx < b.idx;
+            });
+        } else {
+            std::sort(sel.begin(), sel.end(), [](const topk_radix_item &a, const topk_radix_item &b) {
+                return a.key > b.key || (a.key == b.key && a.idx < b.idx);
+            });
+        }
+        T *out = out_ptr + o * k;
+        int32_t *out_idx = out_idx_ptr + o * k;
+        for (size_t i = 0; i < k; i++) {
+            out[i] = in_ptr[o * A + sel[i].idx];
+            out_idx[i] = sel[i].idx;
+        }
+    };
+
+    if (O >= static_cast<size_t>(nthr)) {
+        parallel_nt(nthr, [&](const int ithr, const int threads) {
+            for_1d(ithr, threads, O, [&](size_t o) {
+                process_row(o, 1, ithr);
+            });
+        });
+    } else {
+        for (size_t o = 0; o < O; o++)
+            process_row(o, nthr, 0);
+    }
+}
+
 inline void TopK::topk_kernel_process(const uint8_t *in_p, uint8_t *out_p, uint8_t *out_idx_p,
                                                 uint8_t *process_p, uint8_t *process_idx_p, size_t work_amount) {
     auto arg = jit_topk_call_args();
@@ -62,6 +62,12 @@ struct jit_topk_call_args {
     size_t sort_stride;
 };
 
+// the key of an element in the threshold select mode and its index on the axis
+struct topk_radix_item {
+    uint32_t key;
+    int32_t idx;
+};
+
 struct jit_uni_topk_kernel {
     void (*ker_)(const jit_topk_call_args *);
 
@@ -101,6 +107,9 @@ public:
 private:
     void topk_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *dst_idx);
     void topk_ref(const float *in_ptr, float *out_ptr, int32_t *dst_idx);
+    void topk_radix_select_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *dst_idx);
+    template <typename T>
+    void topk_radix_select(const T *in_ptr, T *out_ptr, int32_t *dst_idx);
     inline void topk_kernel_process(const uint8_t *in_p, uint8_t *out_p, uint8_t *src_idx,
                                     uint8_t *process_p, uint8_t *process_idx_p, size_t work_amount);
     inline static int count(const VectorDims& dims, size_t start_ind, size_t end_ind);
@@ -130,6 +139,8 @@ private:
     int dim = 0, before_num = 0;
     bool bubble_inplace = false;
     bool preset_params_done = false;
+    bool radix_select = false;
+    InferenceEngine::Precision data_precision;
 
     VectorDims src_dims, dst_dims;
     TopKLayoutType layout = TopKLayoutType::topk_ncsp;
@@ -144,6 +155,11 @@ private:
     std::vector<uint8_t> vec_process_ptr;
     std::vector<uint8_t> vec_process_idx_ptr;
 
+    // the per thread buffers of the threshold select, reused by the rows and the inferences
+    std::vector<std::vector<topk_radix_item>> vec_radix_sel;
+    std::vector<std::vector<topk_radix_item>> vec_radix_cand;
+    std::vector<std::vector<size_t>> vec_radix_hist;
+
     std::shared_ptr<jit_uni_topk_kernel> topk_kernel = nullptr;
 
     std::string errorPrefix;
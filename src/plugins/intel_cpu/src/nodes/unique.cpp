@@ -2,10 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cmath>
+#include <cstring>
 #include <string>
 #include <vector>
 
 #include "unique.hpp"
+#include "ie_parallel.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <utils/shape_inference/shape_inference_internal_dyn.hpp>
 
@@ -162,103 +165,239 @@ void Unique::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
 
+namespace {
+
+// The flattened Unique is computed with hash tables instead of the comparison of every element with all the found
+// unique values. The elements are distributed to the partitions by their hashes keeping the order of the elements,
+// so every partition owns its own set of the values and is processed by one thread without synchronization.
+
+// The elements shorter than this are processed by one thread.
+constexpr size_t parallelUniqueMinLen = 32768;
+
+// The values are compared with ==, so both zeros must have the same hash.
+inline uint32_t hashBits(float val) {
+    uint32_t bits = 0;
+    if (val != 0.f)
+        std::memcpy(&bits, &val, sizeof(bits));
+    return bits;
+}
+inline uint32_t hashBits(int32_t val) { return static_cast<uint32_t>(val); }
+inline uint32_t hashBits(int8_t val) { return static_cast<uint8_t>(val); }
+inline uint32_t hashBits(uint8_t val) { return val; }
+
+// NaN is not equal to itself, so every NaN is a unique value and is not inserted into the tables.
+inline bool isNaN(float val) { return std::isnan(val); }
+template <typename T>
+inline bool isNaN(T) { return false; }
+
+// Unsigned keys with the same order as the values for the radix sort.
+inline uint32_t orderKey(float val) {
+    uint32_t bits;
+    std::memcpy(&bits, &val, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+inline uint32_t orderKey(int32_t val) { return static_cast<uint32_t>(val) ^ 0x80000000u; }
+inline uint32_t orderKey(int8_t val) { return static_cast<uint8_t>(val) ^ 0x80u; }
+inline uint32_t orderKey(uint8_t val) { return val; }
+
+inline uint64_t tableHash(uint32_t bits) { return bits * 0x9E3779B97F4A7C15ull; }
+inline uint64_t partitionHash(uint32_t bits) { return bits * 0xC2B2AE3D27D4EB4Full; }
+
+/**
+ * LSD radix sort of the indices by the keys, 8 bits per pass. The digits are counted and scattered by the chunks in
+ * parallel, the passes where all the keys have the same digit are skipped.
+ * @param keyBytes number of the meaningful bytes of the keys
+ */
+void radixSortByKey(std::vector<uint32_t>& keys, std::vector<int32_t>& indices, size_t keyBytes) {
+    constexpr size_t radix = 256;
+    const size_t len = keys.size();
+    const size_t chunksNum = len < parallelUniqueMinLen ? 1 : static_cast<size_t>(parallel_get_max_threads());
+    std::vector<uint32_t> keysTmp(len);
+    std::vector<int32_t> indicesTmp(len);
+    std::vector<size_t> histogram(chunksNum * radix);
+
+    for (size_t shift = 0; shift < keyBytes * 8; shift += 8) {
+        std::fill(histogram.begin(), histogram.end(), 0);
+        parallel_for(chunksNum, [&](size_t c) {
+            size_t start = 0, end = 0;
+            splitter(len, chunksNum, c, start, end);
+            auto hist = histogram.data() + c * radix;
+            for (size_t i = start; i < end; i++)
+                hist[(keys[i] >> shift) & (radix - 1)]++;
+        });
+
+        size_t offset = 0;
+        bool sameDigit = false;
+        for (size_t d = 0; d < radix; d++) {
+            size_t digitCount = 0;
+            for (size_t c = 0; c < chunksNum; c++) {
+                const size_t count = histogram[c * radix + d];
+                histogram[c * radix + d] = offset;
+                offset += count;
+                digitCount += count;
+            }
+            sameDigit = sameDigit || digitCount == len;
+        }
+        if (sameDigit)
+            continue;
+
+        parallel_for(chunksNum, [&](size_t c) {
+            size_t start = 0, end = 0;
+            splitter(len, chunksNum, c, start, end);
+            auto offsets = histogram.data() + c * radix;
+            for (size_t i = start; i < end; i++) {
+                const size_t pos = offsets[(keys[i] >> shift) & (radix - 1)]++;
+                keysTmp[pos] = keys[i];
+                indicesTmp[pos] = indices[i];
+            }
+        });
+        keys.swap(keysTmp);
+        indices.swap(indicesTmp);
+    }
+}
+
+}   // namespace
+
 template <typename T>
 void Unique::flattenTensorExec() {
     const T* srcDataPtr = reinterpret_cast<const T*>(getParentEdgeAt(IN_DATA)->getMemoryPtr()->GetPtr());
     const size_t inputLen = getParentEdgeAt(IN_DATA)->getMemoryPtr()->GetSize() / sizeof(T);
     std::vector<T> uniDataTmp(inputLen);
     auto uniDataTmpPtr = uniDataTmp.data();
-    int *firstTmpPtr = nullptr, *inToOutTmpPtr = nullptr, *occurTmpPtr = nullptr;
-    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-        firstTmpPtr = firstUniTmp.data();
-    }
-    if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-        inToOutTmpPtr = inToOutTmp.data();
-    }
-    if (definedOutputs[OCCURRENCES_NUM]) {
-        occurTmpPtr = occurTmp.data();
-    }
-    uniqueLen = inputLen;
-
-    if (sorted) {
-        std::memcpy(uniDataTmpPtr, srcDataPtr, inputLen * sizeof(T));
-        std::sort(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        auto last = std::unique(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        uniqueLen = last - uniDataTmpPtr;
-
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            T* first = uniDataTmpPtr;
-            for (T* it = first; it < last; it++) {
-                for (int i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == *it) {
-                        *firstTmpPtr++ = i;
-                        first++;
-                        break;
-                    }
-                }
-            }
+    auto firstTmpPtr = firstUniTmp.data();
+    auto inToOutTmpPtr = inToOutTmp.data();
+    auto occurTmpPtr = occurTmp.data();
+
+    const size_t chunksNum = inputLen < parallelUniqueMinLen ? 1 : static_cast<size_t>(parallel_get_max_threads());
+    const size_t partsNum = chunksNum;
+    auto partitionOf = [&](size_t i) {
+        return partsNum == 1 ? size_t(0) : static_cast<size_t>((partitionHash(hashBits(srcDataPtr[i])) >> 32) % partsNum);
+    };
+
+    // Distribute the element indices to the partitions. Every chunk of the input writes its indices to its own range
+    // of every partition, so the indices of a partition are in ascending order.
+    std::vector<size_t> chunkOffsets(chunksNum * partsNum, 0);
+    parallel_for(chunksNum, [&](size_t c) {
+        size_t start = 0, end = 0;
+        splitter(inputLen, chunksNum, c, start, end);
+        auto hist = chunkOffsets.data() + c * partsNum;
+        for (size_t i = start; i < end; i++)
+            hist[partitionOf(i)]++;
+    });
+    std::vector<size_t> partStart(partsNum + 1, 0);
+    for (size_t p = 0, offset = 0; p < partsNum; p++) {
+        for (size_t c = 0; c < chunksNum; c++) {
+            const size_t count = chunkOffsets[c * partsNum + p];
+            chunkOffsets[c * partsNum + p] = offset;
+            offset += count;
         }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            for (int i = 0; i < inputLen; i++) {
-                if (i > 0 && srcDataPtr[i] == srcDataPtr[i - 1]) {
-                    inToOutTmpPtr[i] = inToOutTmpPtr[i - 1];
-                    continue;
-                }
-                for (int j = 0; j < uniqueLen; j++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        inToOutTmpPtr[i] = j;
-                        break;
-                    }
-                }
+        partStart[p + 1] = offset;
+    }
+    std::vector<int32_t> partElements(inputLen);
+    parallel_for(chunksNum, [&](size_t c) {
+        size_t start = 0, end = 0;
+        splitter(inputLen, chunksNum, c, start, end);
+        auto offsets = chunkOffsets.data() + c * partsNum;
+        for (size_t i = start; i < end; i++)
+            partElements[offsets[partitionOf(i)]++] = static_cast<int32_t>(i);
+    });
+
+    // Find the unique values of every partition with an open addressing table. Since the indices are visited in
+    // ascending order, the first visited index of a value is its first occurrence.
+    struct Partition {
+        std::vector<int32_t> first;
+        std::vector<int32_t> count;
+        std::vector<int32_t> outIdx;
+    };
+    std::vector<Partition> parts(partsNum);
+    std::vector<int32_t> localIdx(inputLen);
+    parallel_for(partsNum, [&](size_t p) {
+        auto& part = parts[p];
+        const size_t begin = partStart[p], end = partStart[p + 1];
+        int tableBits = 4;
+        while ((size_t(1) << tableBits) < 2 * (end - begin))
+            tableBits++;
+        const size_t tableMask = (size_t(1) << tableBits) - 1;
+        std::vector<int32_t> table(tableMask + 1, -1);
+
+        for (size_t e = begin; e < end; e++) {
+            const int32_t i = partElements[e];
+            const T val = srcDataPtr[i];
+            int32_t id = -1;
+            if (!isNaN(val)) {
+                size_t slot = tableHash(hashBits(val)) >> (64 - tableBits);
+                while (table[slot] != -1 && srcDataPtr[part.first[table[slot]]] != val)
+                    slot = (slot + 1) & tableMask;
+                id = table[slot];
+                if (id == -1)
+                    table[slot] = static_cast<int32_t>(part.first.size());
             }
-        }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + uniqueLen, 0);
-            for (int j = 0; j < uniqueLen; j++) {
-                for (int i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        occurTmpPtr[j]++;
-                    }
-                }
+            if (id == -1) {
+                id = static_cast<int32_t>(part.first.size());
+                part.first.push_back(i);
+                part.count.push_back(0);
             }
+            part.count[id]++;
+            localIdx[i] = id;
         }
+        part.outIdx.resize(part.first.size());
+    });
+
+    auto storeUnique = [&](size_t pos, int32_t i) {
+        auto& part = parts[partitionOf(i)];
+        const int32_t id = localIdx[i];
+        part.outIdx[id] = static_cast<int32_t>(pos);
+        uniDataTmpPtr[pos] = srcDataPtr[i];
+        firstTmpPtr[pos] = i;
+        occurTmpPtr[pos] = part.count[id];
+    };
+
+    if (sorted) {
+        std::vector<int32_t> uniqueFirst;
+        for (const auto& part : parts)
+            uniqueFirst.insert(uniqueFirst.end(), part.first.begin(), part.first.end());
+        uniqueLen = uniqueFirst.size();
+        std::vector<uint32_t> keys(uniqueLen);
+        parallel_for(uniqueLen, [&](size_t u) {
+            keys[u] = orderKey(srcDataPtr[uniqueFirst[u]]);
+        });
+        radixSortByKey(keys, uniqueFirst, sizeof(T));
+        parallel_for(uniqueLen, [&](size_t pos) {
+            storeUnique(pos, uniqueFirst[pos]);
+        });
     } else {
-        uniDataTmpPtr[0] = srcDataPtr[0];
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            firstTmpPtr[0] = 0;
-        }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            inToOutTmpPtr[0] = 0;
-        }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + inputLen, 1);
-        }
-        uniqueLen = 1;
-
-        for (int i = 1; i < inputLen; i++) {
-            bool found = false;
-            int j = 0;
-            for (; j < uniqueLen; j++) {
-                if (uniDataTmpPtr[j] == srcDataPtr[i]) {
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) {
-                uniDataTmpPtr[uniqueLen] = srcDataPtr[i];
-                if (definedOutputs[FIRST_UNIQUE_IDX]) {
-                    firstTmpPtr[uniqueLen] = i;
-                }
-                uniqueLen++;
-            } else {
-                if (definedOutputs[OCCURRENCES_NUM]) {
-                    occurTmpPtr[j]++;
-                }
-            }
-            if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-                inToOutTmpPtr[i] = j;
+        // The unique values are ordered by their first occurrences, which are found by the chunks of the input.
+        std::vector<size_t> chunkUniques(chunksNum + 1, 0);
+        auto isFirst = [&](size_t i) {
+            return parts[partitionOf(i)].first[localIdx[i]] == static_cast<int32_t>(i);
+        };
+        parallel_for(chunksNum, [&](size_t c) {
+            size_t start = 0, end = 0;
+            splitter(inputLen, chunksNum, c, start, end);
+            for (size_t i = start; i < end; i++)
+                chunkUniques[c + 1] += isFirst(i);
+        });
+        for (size_t c = 0; c < chunksNum; c++)
+            chunkUniques[c + 1] += chunkUniques[c];
+        uniqueLen = chunkUniques[chunksNum];
+        parallel_for(chunksNum, [&](size_t c) {
+            size_t start = 0, end = 0;
+            splitter(inputLen, chunksNum, c, start, end);
+            size_t pos = chunkUniques[c];
+            for (size_t i = start; i < end; i++) {
+                if (isFirst(i))
+                    storeUnique(pos++, static_cast<int32_t>(i));
             }
-        }
+        });
+    }
+
+    if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
+        parallel_for(chunksNum, [&](size_t c) {
+            size_t start = 0, end = 0;
+            splitter(inputLen, chunksNum, c, start, end);
+            for (size_t i = start; i < end; i++)
+                inToOutTmpPtr[i] = parts[partitionOf(i)].outIdx[localIdx[i]];
+        });
     }
 
     redefineOutputMemory({ {uniqueLen}, {uniqueLen}, {inputLen}, {uniqueLen}});
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_count.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ov {
+namespace intel_cpu {
+
+double PerfClock::tickPeriodNs() {
+    static const double period = []() {
+#if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
+        // the invariant TSC runs at a constant rate, so a short busy wait gives the rate with a sufficient accuracy
+        const auto clockStart = std::chrono::steady_clock::now();
+        const auto tscStart = now();
+        auto clockFinish = clockStart;
+        while (clockFinish - clockStart < std::chrono::milliseconds(10))
+            clockFinish = std::chrono::steady_clock::now();
+        const auto tscFinish = now();
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clockFinish - clockStart).count();
+        return tscFinish > tscStart ? static_cast<double>(ns) / static_cast<double>(tscFinish - tscStart) : 1.0;
+#else
+        return 1.0;
+#endif
+    }();
+    return period;
+}
+
+constexpr size_t LatencyHistogram::subBucketsLog2;
+constexpr size_t LatencyHistogram::subBuckets;
+constexpr size_t LatencyHistogram::maxLog2;
+constexpr size_t LatencyHistogram::numBuckets;
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (size_t i = 0; i < numBuckets; i++)
+        buckets[i].fetch_add(other.buckets[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    const auto otherMax = other.max();
+    auto curMax = maxTicks.load(std::memory_order_relaxed);
+    while (otherMax > curMax && !maxTicks.compare_exchange_weak(curMax, otherMax, std::memory_order_relaxed)) {}
+}
+
+uint64_t LatencyHistogram::count() const {
+    uint64_t total = 0;
+    for (const auto& bucket : buckets)
+        total += bucket.load(std::memory_order_relaxed);
+    return total;
+}
+
+uint64_t LatencyHistogram::percentile(double q) const {
+    const auto total = count();
+    if (total == 0)
+        return 0;
+    const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(std::min(std::max(q, 0.0), 1.0) * total)));
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < numBuckets; i++) {
+        accumulated += buckets[i].load(std::memory_order_relaxed);
+        if (accumulated >= rank)
+            return std::min(bucketUpperBound(i), max());
+    }
+    return max();
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
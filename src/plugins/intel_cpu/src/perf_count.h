@@ -4,54 +4,177 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <memory>
 #include <ratio>
 
+#if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
+#    ifdef _MSC_VER
+#        include <intrin.h>
+#    else
+#        include <x86intrin.h>
+#    endif
+#endif
+
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * Cheap monotonic timer for the per node measurements: reads the time stamp counter on x86 (a few cycles, no syscall)
+ * and the steady clock on the other platforms. The ticks are converted to time with the calibrated tick period.
+ */
+class PerfClock {
+public:
+    static uint64_t now() {
+#if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
+        return __rdtsc();
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    // nanoseconds per tick, calibrated against the steady clock once per process
+    static double tickPeriodNs();
+
+    static double toMicroseconds(uint64_t ticks) {
+        return static_cast<double>(ticks) * tickPeriodNs() * 1e-3;
+    }
+};
+
+/**
+ * Lock-free log-bucketed histogram of the durations in ticks. Every power of two range is split into subBuckets
+ * linear buckets, so the relative error of the reported percentiles doesn't exceed 1 / subBuckets.
+ * Recording a sample is a few relaxed atomic increments and doesn't allocate.
+ */
+class LatencyHistogram {
+public:
+    static constexpr size_t subBucketsLog2 = 3;
+    static constexpr size_t subBuckets = 1 << subBucketsLog2;
+    // the durations up to 2^maxLog2 ticks (hours) are distinguished, the longer ones fall into the last bucket
+    static constexpr size_t maxLog2 = 47;
+    static constexpr size_t numBuckets = (maxLog2 - subBucketsLog2 + 1) * subBuckets + subBuckets;
+
+    LatencyHistogram() {
+        for (auto& bucket : buckets)
+            bucket.store(0, std::memory_order_relaxed);
+    }
+
+    void add(uint64_t ticks) {
+        buckets[bucketIndex(ticks)].fetch_add(1, std::memory_order_relaxed);
+        auto curMax = maxTicks.load(std::memory_order_relaxed);
+        while (ticks > curMax && !maxTicks.compare_exchange_weak(curMax, ticks, std::memory_order_relaxed)) {}
+    }
+
+    // Adds the samples of the other histogram, e.g. to aggregate the histograms of the same node over the streams
+    void merge(const LatencyHistogram& other);
+
+    uint64_t count() const;
+    uint64_t max() const { return maxTicks.load(std::memory_order_relaxed); }
+    // the upper bound of the bucket containing the requested quantile (q in [0, 1]), never greater than max()
+    uint64_t percentile(double q) const;
+
+    static size_t bucketIndex(uint64_t ticks) {
+        if (ticks < subBuckets)
+            return static_cast<size_t>(ticks);
+        size_t log2 = msb(ticks);
+        if (log2 > maxLog2)
+            return numBuckets - 1;
+        const auto sub = static_cast<size_t>(ticks >> (log2 - subBucketsLog2)) & (subBuckets - 1);
+        return (log2 - subBucketsLog2 + 1) * subBuckets + sub;
+    }
+
+    static uint64_t bucketUpperBound(size_t idx) {
+        if (idx < subBuckets)
+            return idx;
+        const size_t log2 = idx / subBuckets + subBucketsLog2 - 1;
+        const uint64_t sub = idx % subBuckets;
+        return ((subBuckets + sub + 1) << (log2 - subBucketsLog2)) - 1;
+    }
+
+private:
+    static size_t msb(uint64_t value) {
+#ifdef _MSC_VER
+        unsigned long idx = 0;
+        _BitScanReverse64(&idx, value);
+        return idx;
+#else
+        return 63 - __builtin_clzll(value);
+#endif
+    }
+
+    std::array<std::atomic<uint32_t>, numBuckets> buckets;
+    std::atomic<uint64_t> maxTicks {0};
+};
+
 class PerfCount {
-    uint64_t total_duration;
-    uint32_t num;
+    std::atomic<uint64_t> total_duration;
+    std::atomic<uint32_t> num;
 
-    std::chrono::high_resolution_clock::time_point __start = {};
-    std::chrono::high_resolution_clock::time_point __finish = {};
+    uint64_t __start = 0;
+    uint64_t __finish = 0;
+
+    std::unique_ptr<LatencyHistogram> histogram;
 
 public:
     PerfCount(): total_duration(0), num(0) {}
 
     std::chrono::duration<double, std::milli> duration() const {
-        return __finish - __start;
+        return std::chrono::duration<double, std::milli>(PerfClock::toMicroseconds(__finish - __start) * 1e-3);
+    }
+
+    uint64_t avg() const {
+        const auto n = count();
+        return (n == 0) ? 0 : static_cast<uint64_t>(PerfClock::toMicroseconds(total_duration.load(std::memory_order_relaxed)) / n);
     }
+    uint32_t count() const { return num.load(std::memory_order_relaxed); }
 
-    uint64_t avg() const { return (num == 0) ? 0 : total_duration / num; }
-    uint32_t count() const { return num; }
+    // Allocates the latency histogram, must be called before the execution starts
+    void enableHistogram() {
+        if (!histogram)
+            histogram.reset(new LatencyHistogram());
+    }
+    const LatencyHistogram* getHistogram() const { return histogram.get(); }
 
 private:
     void start_itr() {
-        __start = std::chrono::high_resolution_clock::now();
+        __start = PerfClock::now();
     }
 
     void finish_itr() {
-        __finish = std::chrono::high_resolution_clock::now();
-        total_duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
-        num++;
+        __finish = PerfClock::now();
+        const auto ticks = __finish - __start;
+        total_duration.fetch_add(ticks, std::memory_order_relaxed);
+        num.fetch_add(1, std::memory_order_relaxed);
+        if (histogram)
+            histogram->add(ticks);
     }
 
     friend class PerfHelper;
 };
 
 class PerfHelper {
-    PerfCount &counter;
+    PerfCount* counter;
 
 public:
-    explicit PerfHelper(PerfCount &count): counter(count) { counter.start_itr(); }
+    PerfHelper(PerfCount &count, bool need): counter(need ? &count : nullptr) {
+        if (counter)
+            counter->start_itr();
+    }
+
+    ~PerfHelper() {
+        if (counter)
+            counter->finish_itr();
+    }
 
-    ~PerfHelper() { counter.finish_itr(); }
+    PerfHelper(const PerfHelper&) = delete;
+    PerfHelper& operator=(const PerfHelper&) = delete;
 };
 
 }   // namespace intel_cpu
 }   // namespace ov
 
-#define GET_PERF(_node) std::unique_ptr<PerfHelper>(new PerfHelper(_node->PerfCounter()))
-#define PERF(_node, _need) auto pc = _need ? GET_PERF(_node) : nullptr;
+#define PERF(_node, _need) PerfHelper pc(_node->PerfCounter(), _need);
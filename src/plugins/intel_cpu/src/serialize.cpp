@@ -3,7 +3,11 @@
 //
 #include "serialize.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include <openvino/pass/serialize.hpp>
+#include <openvino/runtime/mapped_stream_buffer.hpp>
 
 #include <pugixml.hpp>
 
@@ -12,6 +16,36 @@ using namespace InferenceEngine;
 namespace ov {
 namespace intel_cpu {
 namespace {
+    // The weights section of the blob is aligned to the page size, so it's aligned in the mapped blob as well
+    constexpr size_t weightsAlignment = 4096;
+
+    // Exposes a part of the mapped blob as a blob memory, the mapping is kept alive by the allocator
+    class MappedMemoryAllocator final : public IAllocator {
+    public:
+        MappedMemoryAllocator(std::shared_ptr<ov::MappedMemory> memory, size_t offset)
+            : _memory(std::move(memory)), _offset(offset) {}
+
+        void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+            return handle;
+        }
+
+        void unlock(void*) noexcept override {}
+
+        void* alloc(size_t size) noexcept override {
+            if (_offset + size > _memory->size())
+                return nullptr;
+            return _memory->data() + _offset;
+        }
+
+        bool free(void*) noexcept override {
+            return false;
+        }
+
+    private:
+        std::shared_ptr<ov::MappedMemory> _memory;
+        size_t _offset;
+    };
+
     std::string to_string(InferenceEngine::Layout layout) {
         std::stringstream ss;
         ss << layout;
@@ -110,6 +144,11 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
         }
 
         xml_doc.save(stream);
+
+        // the padding is the trailing whitespace of the XML document
+        const auto pos = static_cast<size_t>(stream.tellp());
+        const auto padding = (weightsAlignment - pos % weightsAlignment) % weightsAlignment;
+        std::fill_n(std::ostreambuf_iterator<char>(stream), padding, ' ');
     };
 
     // Serialize to old representation in case of old API
@@ -146,10 +185,19 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     // read blob content
     _istream.seekg(hdr.consts_offset);
     if (hdr.consts_size) {
-        dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
-            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C));
-        dataBlob->allocate();
-        _istream.read(dataBlob->buffer(), hdr.consts_size);
+        InferenceEngine::TensorDesc desc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C);
+        // the blob is mapped into memory, so the weights are used in place
+        if (auto mappedBuffer = dynamic_cast<ov::MappedStreamBuffer*>(_istream.rdbuf())) {
+            auto allocator = std::make_shared<MappedMemoryAllocator>(mappedBuffer->get_memory(), hdr.consts_offset);
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(desc, allocator);
+            dataBlob->allocate();
+            if (!dataBlob->buffer())
+                IE_THROW(NetworkNotRead) << "The weights section is out of the blob bounds.";
+        } else {
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(desc);
+            dataBlob->allocate();
+            _istream.read(dataBlob->buffer(), hdr.consts_size);
+        }
     }
 
     // read XML content
@@ -0,0 +1,172 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shape_buckets_mem_plan.h"
+
+#include <algorithm>
+
+#include "memory_desc/dnnl_blocked_memory_desc.h"
+#include "utils/general_utils.h"
+
+namespace ov {
+namespace intel_cpu {
+
+ShapeBucketsMemPlan::ShapeBucketsMemPlan(const dnnl::engine& eng, size_t maxBuckets, int64_t alignment)
+    : eng(eng), maxBuckets(maxBuckets), alignment(alignment) {}
+
+void ShapeBucketsMemPlan::addBox(const MemorySolver::Box& box, DnnlMemoryMngrPtr mngr, std::vector<EdgePtr> edges) {
+    slots.push_back({box, std::move(mngr), std::move(edges)});
+}
+
+bool ShapeBucketsMemPlan::covers(const std::vector<VectorDims>& bucketDims, const std::vector<VectorDims>& dims) {
+    if (bucketDims.size() != dims.size())
+        return false;
+
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (bucketDims[i].size() != dims[i].size())
+            return false;
+        for (size_t j = 0; j < dims[i].size(); j++) {
+            if (dims[i][j] > bucketDims[i][j])
+                return false;
+        }
+    }
+    return true;
+}
+
+void ShapeBucketsMemPlan::extend(std::vector<VectorDims>& bucketDims, const std::vector<VectorDims>& dims) {
+    if (bucketDims.size() != dims.size()) {
+        bucketDims = dims;
+        return;
+    }
+
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (bucketDims[i].size() != dims[i].size()) {
+            // dynamic rank, the bucket is reset to the last observed rank
+            bucketDims[i] = dims[i];
+            continue;
+        }
+        for (size_t j = 0; j < dims[i].size(); j++) {
+            bucketDims[i][j] = std::max(bucketDims[i][j], dims[i][j]);
+        }
+    }
+}
+
+size_t ShapeBucketsMemPlan::currentSize(const Slot& slot) const {
+    size_t size = 0;
+    for (const auto& edge : slot.edges) {
+        const auto& desc = edge->getMemory().getDesc();
+        if (desc.isDefined()) {
+            size = std::max(size, desc.getCurrentMemSize());
+        }
+    }
+    return size;
+}
+
+void ShapeBucketsMemPlan::solve(Bucket& bucket) {
+    std::vector<MemorySolver::Box> boxes;
+    boxes.reserve(slots.size());
+    for (size_t i = 0; i < slots.size(); i++) {
+        auto box = slots[i].box;
+        // zero sized boxes are not supported by the solver
+        box.size = std::max<int64_t>(bucket.sizes[i], 1);
+        box.id = static_cast<int64_t>(i);
+        boxes.push_back(box);
+    }
+
+    MemorySolver solver(boxes);
+    bucket.total = solver.solve();
+    bucket.offsets.resize(slots.size());
+    for (size_t i = 0; i < slots.size(); i++) {
+        bucket.offsets[i] = solver.getOffset(static_cast<int>(i));
+    }
+    bucket.dirty = true;
+}
+
+void ShapeBucketsMemPlan::bind(Bucket& bucket) {
+    const size_t arenaSize = static_cast<size_t>(bucket.total * alignment);
+    if (!arena || arena->GetSize() < arenaSize) {
+        // release the previous arena before the new allocation to keep the peak footprint low,
+        // the slots are rebound below anyway
+        for (auto& slot : slots) {
+            slot.mngr->setExtBuff(nullptr, 0);
+        }
+        arena.reset();
+        arena = std::make_shared<Memory>(eng);
+        arena->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{arenaSize})));
+    }
+
+    auto* base = static_cast<int8_t*>(arena->GetData());
+    for (size_t i = 0; i < slots.size(); i++) {
+        auto& slot = slots[i];
+        slot.mngr->setExtBuff(base + bucket.offsets[i] * alignment, bucket.sizes[i] * alignment);
+        // The tensors, which shapes are not going to be redefined during the next inference, must stay valid.
+        // If the slot is too small for them, the manager falls back to its own buffer.
+        slot.mngr->resize(currentSize(slot));
+    }
+    bucket.dirty = false;
+}
+
+void ShapeBucketsMemPlan::select(const std::vector<VectorDims>& inputDims) {
+    lastDims = inputDims;
+
+    int best = -1;
+    for (size_t i = 0; i < buckets.size(); i++) {
+        if (covers(buckets[i].maxDims, inputDims) && (best < 0 || buckets[i].total < buckets[best].total)) {
+            best = static_cast<int>(i);
+        }
+    }
+
+    // If there is no matching bucket the boxes keep the previous binding, it remains consistent since any box
+    // outgrowing its slot is moved to an own buffer by the memory manager.
+    if (best >= 0 && (best != active || buckets[best].dirty)) {
+        bind(buckets[best]);
+    }
+    active = best;
+}
+
+void ShapeBucketsMemPlan::update() {
+    if (slots.empty() || maxBuckets == 0)
+        return;
+
+    std::vector<int64_t> observed(slots.size());
+    for (size_t i = 0; i < slots.size(); i++) {
+        observed[i] = div_up(static_cast<int64_t>(currentSize(slots[i])), alignment);
+    }
+
+    auto grow = [&](Bucket& bucket) {
+        bool grown = false;
+        for (size_t i = 0; i < observed.size(); i++) {
+            if (observed[i] > bucket.sizes[i]) {
+                bucket.sizes[i] = observed[i];
+                grown = true;
+            }
+        }
+        if (grown)
+            solve(bucket);
+    };
+
+    if (active >= 0) {
+        grow(buckets[active]);
+        return;
+    }
+
+    if (buckets.size() < maxBuckets) {
+        Bucket bucket;
+        bucket.maxDims = lastDims;
+        bucket.sizes = std::move(observed);
+        solve(bucket);
+        buckets.push_back(std::move(bucket));
+        return;
+    }
+
+    // All the buckets are in use, so the biggest one is extended to cover the new shapes
+    auto biggest = std::max_element(buckets.begin(), buckets.end(), [](const Bucket& lhs, const Bucket& rhs) {
+        return lhs.total < rhs.total;
+    });
+    extend(biggest->maxDims, lastDims);
+    grow(*biggest);
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
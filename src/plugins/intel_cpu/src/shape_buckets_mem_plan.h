@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+#include "edge.h"
+#include "memory_solver.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Keeps a small set of precomputed memory plans for the intermediate tensors of a dynamic graph.
+ *
+ * Each plan (bucket) is associated with the max input shapes it has been observed with. The box sizes are learned
+ * from the inferences and a static MemorySolver layout is solved for them, so the tensors are placed into a single
+ * shared arena instead of growing their own buffers on every shape change.
+ * A box which still outgrows its slot falls back to its own buffer (MemoryMngrWithReuse behaviour), the bucket is then
+ * enlarged and re-solved after the inference.
+ *
+ * Is NOT thread safe, the owner graph is expected to serialize the calls.
+ */
+class ShapeBucketsMemPlan {
+public:
+    using Ptr = std::shared_ptr<ShapeBucketsMemPlan>;
+
+    ShapeBucketsMemPlan(const dnnl::engine& eng, size_t maxBuckets, int64_t alignment);
+
+    /**
+     * @brief Registers a box which memory placement is controlled by the plan
+     * @param box lifetime of the box in the execution order
+     * @param mngr memory manager shared by all the edges of the box
+     * @param edges edges which memory is provided by the manager
+     */
+    void addBox(const MemorySolver::Box& box, DnnlMemoryMngrPtr mngr, std::vector<EdgePtr> edges);
+
+    /**
+     * @brief Selects the bucket matching the input shapes and binds the boxes to its arena layout.
+     * Must be called before the graph nodes execution.
+     */
+    void select(const std::vector<VectorDims>& inputDims);
+
+    /**
+     * @brief Updates the buckets with the box sizes observed during the last inference.
+     * Must be called after the graph nodes execution.
+     */
+    void update();
+
+    size_t bucketsCount() const {
+        return buckets.size();
+    }
+
+private:
+    struct Slot {
+        MemorySolver::Box box;
+        DnnlMemoryMngrPtr mngr;
+        std::vector<EdgePtr> edges;
+    };
+
+    struct Bucket {
+        std::vector<VectorDims> maxDims;
+        std::vector<int64_t> sizes;    // in alignment units, per slot
+        std::vector<int64_t> offsets;  // in alignment units, per slot
+        int64_t total = 0;
+        bool dirty = true;
+    };
+
+    static bool covers(const std::vector<VectorDims>& bucketDims, const std::vector<VectorDims>& dims);
+    static void extend(std::vector<VectorDims>& bucketDims, const std::vector<VectorDims>& dims);
+
+    size_t currentSize(const Slot& slot) const;
+    void solve(Bucket& bucket);
+    void bind(Bucket& bucket);
+
+    dnnl::engine eng;
+    size_t maxBuckets;
+    int64_t alignment;
+
+    std::vector<Slot> slots;
+    std::vector<Bucket> buckets;
+    std::vector<VectorDims> lastDims;
+    int active = -1;
+
+    MemoryPtr arena;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
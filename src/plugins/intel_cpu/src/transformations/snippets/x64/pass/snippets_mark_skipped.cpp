@@ -157,6 +157,12 @@ int getChannelAxis(const ov::AxisSet &axes, bool keep_dims) {
     }
     return channelAxis;
 }
+// Reductions over the last dimension are tokenized by Snippets together with the surrounding eltwise ops
+// (e.g. normalization patterns), so they shouldn't start fusing chains
+bool isTokenizableReduce(const std::shared_ptr<const Node> &node) {
+    return ov::is_type<ov::op::util::ArithmeticReductionKeepDims>(node) &&
+           snippets::pass::TokenizeSnippets::AppropriateForSubgraph(node);
+}
 bool isSuitableMiscParent(const std::shared_ptr<const Node> &node) {
     const bool is_suitable_node = ov::is_type<ov::op::v0::MVN>(node) ||
                                   ov::is_type<ov::op::v6::MVN>(node) ||
@@ -172,7 +178,7 @@ bool isSuitableMiscParent(const std::shared_ptr<const Node> &node) {
     // has a single output, connected to a single child
     const auto out = node->outputs();
     const bool has_only_child = (out.size() == 1) && (out[0].get_target_inputs().size() == 1);
-    return is_suitable_node && has_only_child;
+    return is_suitable_node && has_only_child && !isTokenizableReduce(node);
 }
 // Matmul is a special case, since it supports simple + bias fusings
 bool isSuitableMatMulParent(const std::shared_ptr<const Node> &node) {
@@ -196,6 +196,7 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
 
     ov::pass::Manager manager;
     manager.set_per_pass_validation(false);
+    manager.set_incremental_rewrite(config.incrementalGraphRewrite);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::InitNodeInfo);
 
     const bool useLpt = !defaultPrecisions.empty();
@@ -247,7 +248,7 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConvertMatrixNmsToMatrixNmsIE);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::Validate);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::TransposeMatMul);
-    CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConstantFolding);
+    CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConstantFolding, config.parallelConstantFolding);
 
     if (useLpt) {
         CPU_LPT_SCOPE(LowPrecisionTransformations_Part2);
@@ -556,6 +557,7 @@ void Transformations::PostLpt() {
 
     ov::pass::Manager postLPTPassManager;
     postLPTPassManager.set_per_pass_validation(false);
+    postLPTPassManager.set_incremental_rewrite(config.incrementalGraphRewrite);
     CPU_REGISTER_PASS_COMMON(postLPTPassManager, ov::pass::UnrollTensorIterator);
     CPU_REGISTER_PASS_COMMON(postLPTPassManager, ov::pass::ReshapePRelu);
     CPU_SET_CALLBACK_COMMON(postLPTPassManager,
@@ -574,7 +576,7 @@ void Transformations::PostLpt() {
         },
         MoveEltwiseUpThroughDataMov);
 
-    CPU_REGISTER_PASS_COMMON(postLPTPassManager, ov::pass::ConstantFolding);
+    CPU_REGISTER_PASS_COMMON(postLPTPassManager, ov::pass::ConstantFolding, config.parallelConstantFolding);
 
     // Snippets may brake MHA patterns so the fusion has to performed before
     CPU_REGISTER_PASS_X64(postLPTPassManager, MHAFusion);
@@ -653,7 +655,7 @@ void Transformations::MainSnippets(void) {
             },
             snippets::pass::TokenizeMHASnippets);
         CPU_SET_CALLBACK_X64(snippetsManager,
-            [](const std::shared_ptr<const ov::Node>& n) -> bool {
+            [this](const std::shared_ptr<const ov::Node>& n) -> bool {
                 // CPU Plugin support Swish in Subgraph via conversion to SwichCPU which assumes second input to be constant
                 const bool is_unsupported_swish =
                         ov::is_type<const ov::op::v4::Swish>(n) && n->inputs().size() > 1 &&
@@ -675,7 +677,7 @@ void Transformations::MainSnippets(void) {
                                                             });
                 // todo: clarify whether we can evaluate snippets on inputs with larger ranks
                 auto rank_is_too_large = [](const ov::descriptor::Tensor& t) {
-                    // callback is called has_supported_in_out(), so it's safe to assume that the shapes are static
+                    // callback is called has_supported_in_out(), so it's safe to assume that the ranks are static
                     return t.get_partial_shape().rank().get_length() > 6;
                 };
                 const bool bad_input_rank = std::any_of(inputs.begin(), inputs.end(),
@@ -687,8 +689,19 @@ void Transformations::MainSnippets(void) {
                                                         [&](const ov::Output<const ov::Node>& out) {
                                                             return rank_is_too_large(out.get_tensor());
                                                         });
+                // the dynamic shapes are supported by the shape-agnostic kernels unless they are disabled
+                auto is_dynamic = [](const ov::descriptor::Tensor& t) {
+                    return t.get_partial_shape().is_dynamic();
+                };
+                const bool is_disabled_dynamic = !config.snippetsDynamicShapes &&
+                    (std::any_of(inputs.begin(), inputs.end(), [&](const ov::Input<const ov::Node>& in) {
+                         return is_dynamic(in.get_tensor());
+                     }) ||
+                     std::any_of(outputs.begin(), outputs.end(), [&](const ov::Output<const ov::Node>& out) {
+                         return is_dynamic(out.get_tensor());
+                     }));
                 return has_only_const_inputs || bad_input_rank || bad_output_rank || is_unsupported_swish ||
-                    is_disabled_tokenization;
+                    is_disabled_tokenization || is_disabled_dynamic;
             },
             snippets::pass::TokenizeSnippets);
     }
@@ -705,7 +718,7 @@ void Transformations::PostSnippets(void) {
             return node::FakeQuantize::isSupportedOperation(node, errMsg);
         },
         ov::pass::FakeQuantizeDecomposition);
-    CPU_REGISTER_PASS_COMMON(postSnippetsManager, ov::pass::ConstantFolding);
+    CPU_REGISTER_PASS_COMMON(postSnippetsManager, ov::pass::ConstantFolding, config.parallelConstantFolding);
     postSnippetsManager.run_passes(model);
 }
 
@@ -35,9 +35,7 @@ public:
           enableBF16(enableBF16),
           isLegacyApi(isLegacyApi),
           snippetsMode(snippetsMode),
-          config(config) {
-            CPU_DEBUG_CAPS_MAYBE_UNUSED(this->config);
-          }
+          config(config) {}
 
     void UpToCpuSpecificOpSet();
     void CpuSpecificOpSet();
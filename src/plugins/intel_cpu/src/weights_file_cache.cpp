@@ -0,0 +1,147 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weights_file_cache.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+#include "weights_cache.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+MappedMemoryMngr::MappedMemoryMngr(std::shared_ptr<ov::MappedMemory> mapped) : _mapped(std::move(mapped)) {
+    _mngr.setExtBuff(_mapped->data(), _mapped->size());
+}
+
+void* MappedMemoryMngr::getRawPtr() const noexcept {
+    return _mngr.getRawPtr();
+}
+
+void MappedMemoryMngr::setExtBuff(void* ptr, size_t size) {
+    _mngr.setExtBuff(ptr, size);
+}
+
+bool MappedMemoryMngr::resize(size_t size) {
+    return _mngr.resize(size);
+}
+
+bool MappedMemoryMngr::hasExtBuffer() const noexcept {
+    return _mngr.hasExtBuffer();
+}
+
+namespace {
+
+constexpr uint64_t blobMagic = 0x4c42575550434f56;  // "VOCPUWBL"
+
+// follows the weights data in the blob file
+struct BlobTrailer {
+    uint64_t magic;
+    uint64_t srcHash;  // the hash of the whole source data
+};
+
+std::string descToStr(const MemoryDesc& desc) {
+    return desc.serializeFormat() + "_" + desc.getPrecision().name() + "_" + vec2str(desc.getShape().getStaticDims());
+}
+
+uint64_t dataHash(const Memory& src) {
+    return WeightsSharing::GetHashFunc().hash(static_cast<const unsigned char*>(src.GetData()), src.GetSize());
+}
+
+}   // namespace
+
+WeightsFileCache::WeightsFileCache(std::string dir) : _dir(std::move(dir)) {
+    ov::util::create_directory_recursive(_dir);
+}
+
+std::string WeightsFileCache::blobPath(uint64_t srcHash, const Memory& src, const MemoryDesc& dstDesc) const {
+    const auto& hashFunc = WeightsSharing::GetHashFunc();
+    const auto descStr = descToStr(src.getDesc()) + "->" + descToStr(dstDesc);
+    const auto descHash = hashFunc.hash(reinterpret_cast<const unsigned char*>(descStr.data()), descStr.size());
+
+    std::stringstream name;
+    name << std::hex << std::setfill('0') << std::setw(16) << srcHash << "_" << std::setw(16) << descHash << ".blob";
+    return ov::util::path_join({_dir, name.str()});
+}
+
+MemoryPtr WeightsFileCache::map(const std::string& path,
+                                const dnnl::engine& eng,
+                                const MemoryDesc& dstDesc,
+                                uint64_t srcHash) const {
+    std::shared_ptr<ov::MappedMemory> mapped;
+    try {
+        mapped = ov::load_mmap_object(path);
+    } catch (const std::runtime_error& ex) {
+        DEBUG_LOG("Cannot map weights blob ", path, ": ", ex.what());
+        return nullptr;
+    }
+    // a truncated or a foreign file (e.g. written by an interrupted process) is ignored
+    const auto memSize = dstDesc.getCurrentMemSize();
+    if (mapped->size() != memSize + sizeof(BlobTrailer))
+        return nullptr;
+    BlobTrailer trailer;
+    std::memcpy(&trailer, mapped->data() + memSize, sizeof(trailer));
+    if (trailer.magic != blobMagic || trailer.srcHash != srcHash)
+        return nullptr;
+
+    auto mem = std::make_shared<Memory>(eng, std::unique_ptr<IMemoryMngr>(new MappedMemoryMngr(mapped)));
+    mem->Create(dstDesc);
+    return mem;
+}
+
+bool WeightsFileCache::store(const std::string& path, const Memory& mem, uint64_t srcHash) const {
+    std::random_device rd;
+    const auto tmpPath = path + "." + std::to_string(rd()) + ".tmp";
+    {
+        std::ofstream stream(tmpPath, std::ios::binary);
+        if (!stream.is_open())
+            return false;
+        const BlobTrailer trailer{blobMagic, srcHash};
+        stream.write(static_cast<const char*>(mem.GetData()), mem.GetSize());
+        stream.write(reinterpret_cast<const char*>(&trailer), sizeof(trailer));
+        if (!stream.good()) {
+            stream.close();
+            std::remove(tmpPath.c_str());
+            return false;
+        }
+    }
+    // the blob becomes visible to the other processes only when it is completely written
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        std::remove(tmpPath.c_str());
+        return ov::util::file_exists(path);
+    }
+    return true;
+}
+
+MemoryPtr WeightsFileCache::findOrCreate(const Memory& src,
+                                         const MemoryDesc& dstDesc,
+                                         const std::function<MemoryPtr(void)>& create) const {
+    // the key covers the whole source data, so the changed weights never match a stale blob
+    const auto srcHash = dataHash(src);
+    const auto path = blobPath(srcHash, src, dstDesc);
+    if (ov::util::file_exists(path)) {
+        if (auto mem = map(path, src.getEngine(), dstDesc, srcHash))
+            return mem;
+    }
+
+    auto mem = create();
+    // Mapping the just stored blob lets the reordered copy go, so only the page cache backs the weights
+    if (store(path, *mem, srcHash)) {
+        if (auto mapped = map(path, src.getEngine(), dstDesc, srcHash))
+            return mapped;
+    }
+    return mem;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
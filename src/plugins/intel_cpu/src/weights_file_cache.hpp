@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace ov {
+
+class MappedMemory;
+
+namespace intel_cpu {
+
+/**
+ * @brief A memory manager which exposes a read only memory mapped file.
+ * The mapping is kept alive until the manager is destroyed, if a bigger buffer is requested
+ * the manager falls back to the regular allocation.
+ */
+class MappedMemoryMngr : public IMemoryMngr {
+public:
+    explicit MappedMemoryMngr(std::shared_ptr<ov::MappedMemory> mapped);
+    void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    bool hasExtBuffer() const noexcept override;
+
+private:
+    std::shared_ptr<ov::MappedMemory> _mapped;
+    MemoryMngrWithReuse _mngr;
+};
+
+/**
+ * Persistent storage of the reordered weights
+ * Each blob is stored in a separate file named by the SimpleDataHash of the whole source weights data
+ * and the source/destination descriptors, so the blobs are mapped into memory by the subsequent
+ * compilations (including other processes) instead of being reordered again.
+ * The file ends with a trailer holding the source data hash, so the truncated or foreign files are not mapped.
+ *
+ * Is a thread safe, the files are written under a temporary name and renamed afterwards.
+ */
+class WeightsFileCache {
+public:
+    typedef std::shared_ptr<WeightsFileCache> Ptr;
+
+    explicit WeightsFileCache(std::string dir);
+
+    /**
+     * @brief Maps the blob corresponding to the source memory and the destination descriptor or creates it
+     * @param src source (plain) weights memory
+     * @param dstDesc descriptor of the reordered weights
+     * @param create functor performing the reordering
+     * @return memory backed by the mapped file, or the memory returned by the create functor if the file
+     * can not be written or mapped
+     */
+    MemoryPtr findOrCreate(const Memory& src,
+                           const MemoryDesc& dstDesc,
+                           const std::function<MemoryPtr(void)>& create) const;
+
+private:
+    std::string blobPath(uint64_t srcHash, const Memory& src, const MemoryDesc& dstDesc) const;
+    // srcHash is the hash of the source data the blob has to be created from
+    MemoryPtr map(const std::string& path, const dnnl::engine& eng, const MemoryDesc& dstDesc, uint64_t srcHash) const;
+    bool store(const std::string& path, const Memory& mem, uint64_t srcHash) const;
+
+    std::string _dir;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -13,6 +13,7 @@
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "functional_test_utils/skip_tests_config.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 
 namespace {
 
@@ -40,6 +41,8 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::execution_devices.name()),
         RO_property(ov::intel_cpu::denormals_optimization.name()),
         RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+        RO_property(ov::intel_cpu::runtime_cache_statistics.name()),
+        RO_property(ov::intel_cpu::latency_percentiles.name()),
     };
 
     ov::Core ie;
@@ -216,4 +219,41 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckModelInferencePrecisionHas
     ASSERT_EQ(inference_precision_value, inference_precision_expected);
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkLatencyPercentilesDoNotChangeProfilingInfo) {
+    ov::Core ie;
+    auto get_node_names = [&](const ov::AnyMap& config, ov::CompiledModel& compiledModel) {
+        compiledModel = ie.compile_model(model, deviceName, config);
+        auto request = compiledModel.create_infer_request();
+        for (int i = 0; i < 3; i++)
+            request.infer();
+        std::vector<std::string> names;
+        for (const auto& info : request.get_profiling_info())
+            names.push_back(info.node_name);
+        std::sort(names.begin(), names.end());
+        return names;
+    };
+
+    ov::CompiledModel compiledModel, compiledModelWithHistograms;
+    const auto names = get_node_names({ov::enable_profiling(true)}, compiledModel);
+    const auto namesWithHistograms =
+        get_node_names({ov::enable_profiling(true),
+                        {InferenceEngine::PluginConfigInternalParams::KEY_CPU_LATENCY_HISTOGRAMS, "YES"}},
+                       compiledModelWithHistograms);
+    // the percentiles are reported by the separate property rather than as the additional profiling entries
+    ASSERT_EQ(names, namesWithHistograms);
+
+    decltype(ov::intel_cpu::latency_percentiles)::value_type latencies;
+    ASSERT_NO_THROW(latencies = compiledModel.get_property(ov::intel_cpu::latency_percentiles));
+    ASSERT_TRUE(latencies.empty());
+
+    ASSERT_NO_THROW(latencies = compiledModelWithHistograms.get_property(ov::intel_cpu::latency_percentiles));
+    ASSERT_FALSE(latencies.empty());
+    for (const auto& node : latencies) {
+        EXPECT_NE(namesWithHistograms.end(),
+                  std::find(namesWithHistograms.begin(), namesWithHistograms.end(), node.first));
+        EXPECT_LE(node.second.at("P50"), node.second.at("P99"));
+        EXPECT_LE(node.second.at("P99"), node.second.at("MAX"));
+    }
+}
+
 } // namespace
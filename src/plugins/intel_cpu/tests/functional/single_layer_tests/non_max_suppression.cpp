@@ -435,4 +435,27 @@ const auto nmsParams = ::testing::Combine(::testing::ValuesIn(inShapeParams),
 
 INSTANTIATE_TEST_SUITE_P(smoke_NmsLayerCPUTest, NmsLayerCPUTest, nmsParams, NmsLayerCPUTest::getTestCaseName);
 
+// the candidates lists are much longer than the selection, so they are sorted in parts
+const std::vector<InputShapeParams> inShapeParamsManyBoxes = {
+    InputShapeParams{std::vector<ov::Dimension>{-1, -1, -1}, std::vector<TargetShapeParams>{TargetShapeParams{1, 5000, 2},
+                                                                                            TargetShapeParams{2, 2000, 3}}}
+};
+
+const auto nmsParamsManyBoxes = ::testing::Combine(::testing::ValuesIn(inShapeParamsManyBoxes),
+                                                   ::testing::Combine(::testing::Values(ElementType::f32),
+                                                                      ::testing::Values(ElementType::i32),
+                                                                      ::testing::Values(ElementType::f32)),
+                                                   ::testing::Values(100),
+                                                   ::testing::Combine(::testing::Values(0.3f),
+                                                                      ::testing::Values(0.1f),
+                                                                      ::testing::ValuesIn(sigmaThreshold)),
+                                                   ::testing::Values(ngraph::helpers::InputLayerType::PARAMETER),
+                                                   ::testing::ValuesIn(encodType),
+                                                   ::testing::Values(true),
+                                                   ::testing::Values(element::i32),
+                                                   ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_NmsLayerCPUTest_ManyBoxes, NmsLayerCPUTest, nmsParamsManyBoxes, NmsLayerCPUTest::getTestCaseName);
+
 } // namespace CPULayerTestsDefinitions
@@ -219,6 +219,22 @@ INSTANTIATE_TEST_SUITE_P(nightly_static, UniqueLayerTestCPU,
                         ::testing::Values(additionalConfig[0])),
                 UniqueLayerTestCPU::getTestCaseName);
 
+// The flattened inputs longer than 32768 elements are processed by the partitioned hash tables in parallel.
+const std::vector<std::vector<InputShape>> largeFlatShapes = {
+    { { {}, { {64, 1024} } } },
+    { { {}, { {3, 100, 211} } } }
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_static_large_flat, UniqueLayerTestCPU,
+                ::testing::Combine(
+                        ::testing::ValuesIn(largeFlatShapes),
+                        ::testing::Values(std::tuple<bool, int>{true, 0}),
+                        ::testing::ValuesIn(sorted),
+                        ::testing::ValuesIn(dataPrecisionSmoke),
+                        ::testing::ValuesIn(getCPUInfo()),
+                        ::testing::Values(additionalConfig[0])),
+                UniqueLayerTestCPU::getTestCaseName);
+
 const std::vector<std::vector<InputShape>> dynamicInSapes = {
    { { { ov::Dimension(1, 15), -1, -1, -1 },                               // Dynamic shape
        { {1, 1, 1, 1}, {6, 3, 1, 2}, {4, 5, 3, 1}, {2, 7, 2, 2} } } },     // Target shapes
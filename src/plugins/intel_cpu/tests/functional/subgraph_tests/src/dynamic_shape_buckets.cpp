@@ -0,0 +1,110 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* The intermediate tensors of the dynamic model are placed into the arena of the shape bucket matching the input
+   shapes when CPU_DYNAMIC_SHAPE_BUCKETS is set. The shapes are inferred in the order which reuses a bucket for the
+   smaller shapes, creates the new buckets, and grows the biggest bucket past the last one. The results must match
+   the ones of the unbucketed compilation for every inference.
+
+        Param
+          |
+        MatMul
+          |
+         Relu
+          |
+        MatMul
+          |
+         Add (Param)
+          |
+       Multiply
+          |
+        Result
+*/
+class DynamicShapeBucketsCPUTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    static constexpr size_t channels = 32;
+
+    static std::vector<float> makeData(size_t size, size_t period) {
+        std::vector<float> data(size);
+        for (size_t i = 0; i < data.size(); i++)
+            data[i] = static_cast<float>(i % period) / static_cast<float>(period) - 0.5f;
+        return data;
+    }
+
+    static std::shared_ptr<ov::Model> makeModel() {
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{-1, -1, channels});
+        auto weights1 = ov::opset8::Constant::create(ov::element::f32, ov::Shape{channels, 2 * channels},
+                                                     makeData(2 * channels * channels, 13));
+        auto matMul1 = std::make_shared<ov::opset8::MatMul>(param, weights1);
+        auto relu = std::make_shared<ov::opset8::Relu>(matMul1);
+        auto weights2 = ov::opset8::Constant::create(ov::element::f32, ov::Shape{2 * channels, channels},
+                                                     makeData(2 * channels * channels, 7));
+        auto matMul2 = std::make_shared<ov::opset8::MatMul>(relu, weights2);
+        auto add = std::make_shared<ov::opset8::Add>(matMul2, param);
+        auto scale = ov::opset8::Constant::create(ov::element::f32, ov::Shape{1, 1, channels}, makeData(channels, 5));
+        auto multiply = std::make_shared<ov::opset8::Multiply>(add, scale);
+        auto result = std::make_shared<ov::opset8::Result>(multiply);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "DynamicShapeBuckets");
+    }
+
+    static std::vector<float> infer(ov::InferRequest& inferReq, const ov::Shape& shape, size_t seed) {
+        auto input = ov::Tensor(ov::element::f32, shape);
+        for (size_t i = 0; i < input.get_size(); i++)
+            input.data<float>()[i] = static_cast<float>((i + seed) % 11) - 5.f;
+        inferReq.set_input_tensor(input);
+        inferReq.infer();
+        auto output = inferReq.get_output_tensor();
+        EXPECT_EQ(shape, output.get_shape());
+        return std::vector<float>(output.data<float>(), output.data<float>() + output.get_size());
+    }
+};
+
+TEST_F(DynamicShapeBucketsCPUTest, smoke_DynamicShapeBuckets) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const std::vector<ov::Shape> shapes{
+        {2, 4, channels},   // the first bucket
+        {1, 3, channels},   // reuse within the first bucket
+        {2, 4, channels},
+        {4, 8, channels},   // the second bucket
+        {3, 2, channels},   // reuse within the second bucket
+        {1, 4, channels},   // the smallest bucket covering the shapes is selected
+        {8, 2, channels},   // growth past the last bucket, the biggest bucket is extended
+        {8, 8, channels},   // growth within the extended bucket
+        {1, 1, channels},
+        {16, 16, channels},
+        {8, 8, channels},
+    };
+
+    ov::Core core;
+    auto model = makeModel();
+    const auto& bucketsKey = InferenceEngine::PluginConfigInternalParams::KEY_CPU_DYNAMIC_SHAPE_BUCKETS;
+    auto reference = core.compile_model(model, CommonTestUtils::DEVICE_CPU, {{bucketsKey, "0"}});
+    auto referenceReq = reference.create_infer_request();
+    auto bucketed = core.compile_model(model, CommonTestUtils::DEVICE_CPU, {{bucketsKey, "2"}});
+    auto bucketedReq = bucketed.create_infer_request();
+
+    for (size_t i = 0; i < shapes.size(); i++) {
+        SCOPED_TRACE("inference " + std::to_string(i) + ", shape " + CommonTestUtils::vec2str(shapes[i]));
+        const auto expected = infer(referenceReq, shapes[i], i);
+        const auto actual = infer(bucketedReq, shapes[i], i);
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t j = 0; j < expected.size(); j++)
+            ASSERT_FLOAT_EQ(expected[j], actual[j]);
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,168 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* In the shared memory mode the If bodies work on the memory of the If node inputs and outputs directly, and the branch
+   which is not taken is prepared on the input shapes change. The condition alternates between the inferences, the
+   results must match the ones of the default mode. The else body passes its input to the output unchanged, so the
+   output memory of this body can't be bound to the If output.
+
+         then body                 else body
+     X          Y                      X
+      \        /                       |
+         Add                         Result
+          |
+         Relu
+          |
+     Multiply(2)
+          |
+        Result
+
+   The then body of the guard model reshapes its input to {-1, 8}, so it's invalid for the shapes which size isn't
+   divisible by 8 and must not be taken for them. The failed preparation of this body must not fail the inference.
+*/
+class IfSharedMemoryCPUTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    static std::shared_ptr<ov::Model> makeModel(const ov::PartialShape& shape) {
+        auto cond = std::make_shared<ov::opset8::Parameter>(ov::element::boolean, ov::Shape{1});
+        auto x = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        auto y = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+
+        auto thenX = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        auto thenY = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        auto relu = std::make_shared<ov::opset8::Relu>(std::make_shared<ov::opset8::Add>(thenX, thenY));
+        auto mul = std::make_shared<ov::opset8::Multiply>(relu, ov::opset8::Constant::create(ov::element::f32, {}, {2.f}));
+        auto thenResult = std::make_shared<ov::opset8::Result>(mul);
+        auto thenBody = std::make_shared<ov::Model>(ov::ResultVector{thenResult}, ov::ParameterVector{thenX, thenY});
+
+        auto elseX = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        auto elseResult = std::make_shared<ov::opset8::Result>(elseX);
+        auto elseBody = std::make_shared<ov::Model>(ov::ResultVector{elseResult}, ov::ParameterVector{elseX});
+
+        auto ifOp = std::make_shared<ov::opset8::If>(cond);
+        ifOp->set_then_body(thenBody);
+        ifOp->set_else_body(elseBody);
+        ifOp->set_input(x, thenX, elseX);
+        ifOp->set_input(y, thenY, nullptr);
+        auto out = ifOp->set_output(thenResult, elseResult);
+
+        return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset8::Result>(out)},
+                                           ov::ParameterVector{cond, x, y},
+                                           "IfSharedMemory");
+    }
+
+    static std::shared_ptr<ov::Model> makeGuardModel() {
+        const ov::PartialShape shape{-1, 3, -1};
+        auto cond = std::make_shared<ov::opset8::Parameter>(ov::element::boolean, ov::Shape{1});
+        auto x = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+
+        auto thenX = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        auto thenReshape = std::make_shared<ov::opset8::Reshape>(
+            thenX, ov::opset8::Constant::create(ov::element::i64, {2}, {-1, 8}), false);
+        auto thenResult = std::make_shared<ov::opset8::Result>(std::make_shared<ov::opset8::Relu>(thenReshape));
+        auto thenBody = std::make_shared<ov::Model>(ov::ResultVector{thenResult}, ov::ParameterVector{thenX});
+
+        auto elseX = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        auto elseReshape = std::make_shared<ov::opset8::Reshape>(
+            elseX, ov::opset8::Constant::create(ov::element::i64, {2}, {0, -1}), true);
+        auto elseResult = std::make_shared<ov::opset8::Result>(elseReshape);
+        auto elseBody = std::make_shared<ov::Model>(ov::ResultVector{elseResult}, ov::ParameterVector{elseX});
+
+        auto ifOp = std::make_shared<ov::opset8::If>(cond);
+        ifOp->set_then_body(thenBody);
+        ifOp->set_else_body(elseBody);
+        ifOp->set_input(x, thenX, elseX);
+        auto out = ifOp->set_output(thenResult, elseResult);
+
+        return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset8::Result>(out)},
+                                           ov::ParameterVector{cond, x},
+                                           "IfSharedMemoryGuard");
+    }
+
+    static std::vector<float> infer(ov::InferRequest& inferReq, bool condition, const ov::Shape& shape) {
+        auto cond = ov::Tensor(ov::element::boolean, ov::Shape{1});
+        static_cast<char*>(cond.data())[0] = condition;
+        auto x = ov::Tensor(ov::element::f32, shape);
+        auto y = ov::Tensor(ov::element::f32, shape);
+        for (size_t i = 0; i < x.get_size(); i++) {
+            x.data<float>()[i] = static_cast<float>(i % 7) - 3.f;
+            y.data<float>()[i] = static_cast<float>(i % 5) - 1.f;
+        }
+        inferReq.set_input_tensor(0, cond);
+        inferReq.set_input_tensor(1, x);
+        if (inferReq.get_compiled_model().inputs().size() > 2)
+            inferReq.set_input_tensor(2, y);
+        inferReq.infer();
+        auto output = inferReq.get_output_tensor(0);
+        return std::vector<float>(output.data<float>(), output.data<float>() + output.get_size());
+    }
+
+    // infers the conditions and the shapes in the given order, the results must match the ones of the default mode
+    static void run(const std::shared_ptr<ov::Model>& model,
+                    const std::vector<std::pair<bool, ov::Shape>>& inferences) {
+        ov::Core core;
+        auto refReq = core.compile_model(model, CommonTestUtils::DEVICE_CPU).create_infer_request();
+        auto inferReq = core.compile_model(model,
+                                           CommonTestUtils::DEVICE_CPU,
+                                           {{InferenceEngine::PluginConfigInternalParams::KEY_CPU_IF_SHARED_MEMORY, "YES"}})
+                            .create_infer_request();
+
+        for (const auto& inference : inferences) {
+            const auto expected = infer(refReq, inference.first, inference.second);
+            const auto actual = infer(inferReq, inference.first, inference.second);
+            ASSERT_EQ(expected.size(), actual.size());
+            for (size_t i = 0; i < expected.size(); i++)
+                ASSERT_FLOAT_EQ(expected[i], actual[i]);
+        }
+    }
+
+    // every shape is inferred with the both conditions
+    static void run(const ov::PartialShape& modelShape, const std::vector<ov::Shape>& shapes) {
+        std::vector<std::pair<bool, ov::Shape>> inferences;
+        bool condition = true;
+        for (const auto& shape : shapes) {
+            for (int n = 0; n < 2; n++, condition = !condition)
+                inferences.emplace_back(condition, shape);
+        }
+        run(makeModel(modelShape), inferences);
+    }
+};
+
+TEST_F(IfSharedMemoryCPUTest, smoke_Static) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run({2, 3, 8}, {{2, 3, 8}, {2, 3, 8}});
+}
+
+TEST_F(IfSharedMemoryCPUTest, smoke_Dynamic) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run({-1, 3, -1}, {{2, 3, 8}, {4, 3, 5}, {2, 3, 8}, {1, 3, 16}});
+}
+
+TEST_F(IfSharedMemoryCPUTest, smoke_DynamicBranchTakenWithPreviousShapes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    // the then body is prepared for {4, 3, 5} when the else one is taken, and is taken for {2, 3, 8} again
+    run(makeModel({-1, 3, -1}), {{true, {2, 3, 8}}, {false, {4, 3, 5}}, {true, {2, 3, 8}}, {false, {2, 3, 8}},
+                                 {true, {4, 3, 5}}, {false, {1, 3, 16}}, {false, {4, 3, 5}}, {true, {4, 3, 5}}});
+}
+
+TEST_F(IfSharedMemoryCPUTest, smoke_DynamicBranchInvalidForShapes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    // the then body can't be prepared for the shapes {1, 3, 5} and {2, 3, 3}, the else body is taken for them
+    run(makeGuardModel(), {{true, {2, 3, 8}}, {false, {1, 3, 5}}, {true, {2, 3, 8}}, {false, {2, 3, 3}},
+                           {true, {1, 3, 8}}, {false, {1, 3, 5}}, {true, {1, 3, 8}}});
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* The compiled model is exported to the cache directory and then imported from the memory mapped blob, so the
+   constants of the imported model use the weights section of the mapping in place. The results must match the ones
+   of the compiled model, also when the blob file is removed while the imported model is alive.
+
+    Param
+      |
+    MatMul
+      |
+     Add
+      |
+     Relu
+      |
+    Result
+*/
+class ImportMappedBlobCPUTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    void SetUp() override {
+        cacheDir = CommonTestUtils::generateTestFilePrefix() + "_import_mapped_blob_cache";
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
+    static std::shared_ptr<ov::Model> makeModel() {
+        const size_t channels = 64;
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{4, channels});
+        std::vector<float> weights(channels * channels);
+        for (size_t i = 0; i < weights.size(); i++)
+            weights[i] = static_cast<float>(i % 13) / 13.f - 0.5f;
+        auto weightsConst = ov::opset8::Constant::create(ov::element::f32, ov::Shape{channels, channels}, weights);
+        auto matMul = std::make_shared<ov::opset8::MatMul>(param, weightsConst);
+        std::vector<float> bias(channels);
+        for (size_t i = 0; i < bias.size(); i++)
+            bias[i] = static_cast<float>(i % 5) - 2.f;
+        auto biasConst = ov::opset8::Constant::create(ov::element::f32, ov::Shape{1, channels}, bias);
+        auto add = std::make_shared<ov::opset8::Add>(matMul, biasConst);
+        auto relu = std::make_shared<ov::opset8::Relu>(add);
+        auto result = std::make_shared<ov::opset8::Result>(relu);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "ImportMappedBlob");
+    }
+
+    static std::vector<float> infer(ov::CompiledModel& compiledModel) {
+        auto inferReq = compiledModel.create_infer_request();
+        auto input = ov::Tensor(ov::element::f32, ov::Shape{4, 64});
+        for (size_t i = 0; i < input.get_size(); i++)
+            input.data<float>()[i] = static_cast<float>(i % 11) - 5.f;
+        inferReq.set_input_tensor(input);
+        inferReq.infer();
+        auto output = inferReq.get_output_tensor();
+        return std::vector<float>(output.data<float>(), output.data<float>() + output.get_size());
+    }
+
+    std::string cacheDir;
+};
+
+TEST_F(ImportMappedBlobCPUTest, smoke_ImportFromMappedBlob) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    auto model = makeModel();
+    auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU);
+    const auto expected = infer(compiledModel);
+
+    core.set_property(ov::cache_dir(cacheDir));
+    auto exportedModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU);
+    ASSERT_FALSE(exportedModel.get_property(ov::loaded_from_cache));
+    const auto blobs = CommonTestUtils::listFilesWithExt(cacheDir, "blob");
+    ASSERT_EQ(1, blobs.size());
+
+    auto importedModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU);
+    ASSERT_TRUE(importedModel.get_property(ov::loaded_from_cache));
+    // the mapping keeps the weights alive, the removal fails on Windows as the file is mapped
+    std::remove(blobs.front().c_str());
+
+    for (auto* compiled : {&exportedModel, &importedModel}) {
+        const auto actual = infer(*compiled);
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); i++)
+            ASSERT_FLOAT_EQ(expected[i], actual[i]);
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* The sampled inferences are written as the Chrome trace JSON files. Every trace contains the input push, the executed
+   nodes and the output pull, as well as the time attribution and the critical path. The traces are written in the
+   background and are complete when the compiled model is released. A trace which can't be written doesn't fail the
+   inference.
+
+       Param
+         |
+       MatMul
+         |
+        Relu
+         |
+       Result
+*/
+class InferenceTraceCPUTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    static std::shared_ptr<ov::Model> makeModel() {
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{4, 16});
+        param->set_friendly_name("data");
+        auto weights = ov::opset8::Constant::create(ov::element::f32, ov::Shape{16, 16}, std::vector<float>(256, 0.1f));
+        auto matMul = std::make_shared<ov::opset8::MatMul>(param, weights);
+        auto relu = std::make_shared<ov::opset8::Relu>(matMul);
+        relu->set_friendly_name("relu");
+        auto result = std::make_shared<ov::opset8::Result>(relu);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "InferenceTrace");
+    }
+
+    // the compiled model is released on return, so all the traces are written
+    static void infer(const std::string& prefix, int inferences) {
+        const auto& traceKey = InferenceEngine::PluginConfigInternalParams::KEY_CPU_INFERENCE_TRACE;
+        const auto& periodKey = InferenceEngine::PluginConfigInternalParams::KEY_CPU_INFERENCE_TRACE_PERIOD;
+        ov::Core core;
+        auto compiledModel =
+            core.compile_model(makeModel(), CommonTestUtils::DEVICE_CPU, {{traceKey, prefix}, {periodKey, "2"}});
+        auto inferReq = compiledModel.create_infer_request();
+
+        auto input = ov::Tensor(ov::element::f32, ov::Shape{4, 16});
+        for (size_t i = 0; i < input.get_size(); i++)
+            input.data<float>()[i] = static_cast<float>(i % 5);
+        inferReq.set_input_tensor(input);
+        for (int i = 0; i < inferences; i++)
+            ASSERT_NO_THROW(inferReq.infer());
+    }
+
+    // the traces are numbered across the process, so the files are searched by the prefix
+    static std::vector<std::string> readTraces(const std::string& prefix) {
+        std::vector<std::string> traces;
+        for (size_t i = 0; i < 1000; i++) {
+            const auto fileName = prefix + std::to_string(i) + ".json";
+            std::ifstream file(fileName);
+            if (!file)
+                continue;
+            std::stringstream content;
+            content << file.rdbuf();
+            traces.push_back(content.str());
+            file.close();
+            std::remove(fileName.c_str());
+        }
+        return traces;
+    }
+};
+
+TEST_F(InferenceTraceCPUTest, smoke_SampledTraces) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const std::string prefix = "InferenceTraceCPUTest_";
+    infer(prefix, 4);
+
+    const auto traces = readTraces(prefix);
+    ASSERT_EQ(2u, traces.size());
+    for (const auto& trace : traces) {
+        ASSERT_NE(std::string::npos, trace.find("\"traceEvents\":["));
+        ASSERT_NE(std::string::npos, trace.find("\"name\":\"data\",\"cat\":\"input\""));
+        ASSERT_NE(std::string::npos, trace.find("\"cat\":\"output\""));
+        ASSERT_NE(std::string::npos, trace.find("\"cat\":\"node\""));
+        ASSERT_NE(std::string::npos, trace.find("\"critical_path\":["));
+        ASSERT_NE(std::string::npos, trace.find("\"graph\":\"InferenceTrace\""));
+    }
+}
+
+TEST_F(InferenceTraceCPUTest, smoke_UnwritableTraces) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    // the directory of the traces doesn't exist
+    const std::string prefix = "InferenceTraceCPUTest_missing_dir/trace_";
+    infer(prefix, 4);
+    ASSERT_TRUE(readTraces(prefix).empty());
+}
+
+} // namespace SubgraphTestsDefinitions
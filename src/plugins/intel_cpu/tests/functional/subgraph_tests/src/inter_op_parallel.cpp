@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* The independent branches of a static graph are executed concurrently, the results must match the ones of the
+   sequential execution. The branches have different lengths, so the memory of the intermediate tensors would be reused
+   across the branches by the sequential memory plan.
+
+                   Param
+         /           |            \
+      MatMul       MatMul        MatMul
+        |            |             |
+       Relu       Sigmoid         Tanh
+        |            |             |
+      MatMul         |             |
+        |            |             |
+       Relu          |             |
+         \           |            /
+                   Concat
+                     |
+                   Result
+*/
+class InterOpParallelCPUTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    static constexpr size_t channels = 32;
+
+    static std::shared_ptr<ov::Node> makeMatMul(const ov::Output<ov::Node>& input, size_t seed) {
+        std::vector<float> weights(channels * channels);
+        for (size_t i = 0; i < weights.size(); i++)
+            weights[i] = static_cast<float>((i + seed) % 7) / 7.f - 0.5f;
+        auto constant = ov::opset8::Constant::create(ov::element::f32, ov::Shape{channels, channels}, weights);
+        return std::make_shared<ov::opset8::MatMul>(input, constant);
+    }
+
+    std::shared_ptr<ov::Model> makeModel() {
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{4, channels});
+        auto relu1 = std::make_shared<ov::opset8::Relu>(makeMatMul(param, 1));
+        auto relu2 = std::make_shared<ov::opset8::Relu>(makeMatMul(relu1, 2));
+        auto sigmoid = std::make_shared<ov::opset8::Sigmoid>(makeMatMul(param, 3));
+        auto tanh = std::make_shared<ov::opset8::Tanh>(makeMatMul(param, 4));
+        auto concat = std::make_shared<ov::opset8::Concat>(ov::OutputVector{relu2, sigmoid, tanh}, 1);
+        auto result = std::make_shared<ov::opset8::Result>(concat);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "InterOpParallel");
+    }
+
+    static std::vector<float> infer(ov::InferRequest& inferReq, float shift) {
+        auto input = ov::Tensor(ov::element::f32, ov::Shape{4, channels});
+        for (size_t i = 0; i < input.get_size(); i++)
+            input.data<float>()[i] = static_cast<float>(i % 11) - shift;
+        inferReq.set_input_tensor(input);
+        inferReq.infer();
+        auto output = inferReq.get_output_tensor();
+        return std::vector<float>(output.data<float>(), output.data<float>() + output.get_size());
+    }
+};
+
+TEST_F(InterOpParallelCPUTest, smoke_ConcurrentBranches) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    auto model = makeModel();
+    auto refReq = core.compile_model(model, CommonTestUtils::DEVICE_CPU).create_infer_request();
+    auto inferReq = core.compile_model(model,
+                                       CommonTestUtils::DEVICE_CPU,
+                                       {{InferenceEngine::PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLELISM, "3"}})
+                        .create_infer_request();
+
+    for (float shift : {5.f, 2.f, 7.f}) {
+        const auto expected = infer(refReq, shift);
+        const auto actual = infer(inferReq, shift);
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); i++)
+            ASSERT_FLOAT_EQ(expected[i], actual[i]);
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
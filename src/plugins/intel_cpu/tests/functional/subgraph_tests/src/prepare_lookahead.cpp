@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* The primitives of a dynamic graph are prepared ahead of the execution, the results must match the ones of the graph
+   which prepares all the primitives before the execution, whatever the input shape changes are.
+
+    Param
+      |
+    MatMul
+      |
+     Relu
+      |
+    MatMul
+      |
+    Softmax
+      |
+    Result
+*/
+class PrepareLookaheadCPUTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    std::shared_ptr<ov::Model> makeModel() {
+        const size_t channels = 16;
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{-1, channels});
+        std::vector<float> weights(channels * channels);
+        for (size_t i = 0; i < weights.size(); i++)
+            weights[i] = static_cast<float>(i % 7) / 7.f - 0.5f;
+        auto weights1 = ov::opset8::Constant::create(ov::element::f32, ov::Shape{channels, channels}, weights);
+        auto matMul1 = std::make_shared<ov::opset8::MatMul>(param, weights1);
+        auto relu = std::make_shared<ov::opset8::Relu>(matMul1);
+        std::reverse(weights.begin(), weights.end());
+        auto weights2 = ov::opset8::Constant::create(ov::element::f32, ov::Shape{channels, channels}, weights);
+        auto matMul2 = std::make_shared<ov::opset8::MatMul>(relu, weights2);
+        auto softmax = std::make_shared<ov::opset8::Softmax>(matMul2, 1);
+        auto result = std::make_shared<ov::opset8::Result>(softmax);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "PrepareLookahead");
+    }
+
+    static std::vector<float> infer(ov::InferRequest& inferReq, size_t batch) {
+        auto input = ov::Tensor(ov::element::f32, ov::Shape{batch, 16});
+        for (size_t i = 0; i < input.get_size(); i++)
+            input.data<float>()[i] = static_cast<float>(i % 11) - 5.f;
+        inferReq.set_input_tensor(input);
+        inferReq.infer();
+        auto output = inferReq.get_output_tensor();
+        return std::vector<float>(output.data<float>(), output.data<float>() + output.get_size());
+    }
+};
+
+TEST_F(PrepareLookaheadCPUTest, smoke_PrepareAhead) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    auto model = makeModel();
+    auto refReq = core.compile_model(model, CommonTestUtils::DEVICE_CPU).create_infer_request();
+    auto inferReq = core.compile_model(model,
+                                       CommonTestUtils::DEVICE_CPU,
+                                       {{InferenceEngine::PluginConfigInternalParams::KEY_CPU_PREPARE_LOOKAHEAD, "2"}})
+                        .create_infer_request();
+
+    for (size_t batch : {1, 3, 7, 3, 1, 12}) {
+        const auto expected = infer(refReq, batch);
+        const auto actual = infer(inferReq, batch);
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); i++)
+            ASSERT_FLOAT_EQ(expected[i], actual[i]);
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,154 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* The elementwise subgraph with dynamic shapes is lowered to a shape-agnostic kernel, the kernel is reused for the
+   shapes with the same broadcasting pattern. The shapes below change both the work amounts (including the tails of
+   the vector loops) and the broadcasting of the second input.
+
+    Param0  Param1
+        \    /
+         Add
+          |
+        Multiply(2)
+          |
+         Relu
+          |
+        Result
+*/
+class SnippetsDynamicCPUTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    std::shared_ptr<ov::Model> makeModel() {
+        auto param0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{-1, -1, -1});
+        auto param1 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{-1, -1, -1});
+        auto add = std::make_shared<ov::opset8::Add>(param0, param1);
+        auto multiply = std::make_shared<ov::opset8::Multiply>(add,
+                                                               ov::opset8::Constant::create(ov::element::f32, {}, {2.f}));
+        auto relu = std::make_shared<ov::opset8::Relu>(multiply);
+        auto result = std::make_shared<ov::opset8::Result>(relu);
+        return std::make_shared<ov::Model>(ov::ResultVector{result},
+                                           ov::ParameterVector{param0, param1},
+                                           "SnippetsDynamic");
+    }
+
+    // the sum of numInputs dynamic inputs, which is tokenized into a single Subgraph with numInputs + 1 i/o
+    static std::shared_ptr<ov::Model> makeSumModel(size_t numInputs) {
+        ov::ParameterVector params;
+        for (size_t i = 0; i < numInputs; i++)
+            params.push_back(std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{-1, -1, -1}));
+        std::shared_ptr<ov::Node> sum = params[0];
+        for (size_t i = 1; i < numInputs; i++)
+            sum = std::make_shared<ov::opset8::Add>(sum, params[i]);
+        auto result = std::make_shared<ov::opset8::Result>(sum);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, params, "SnippetsDynamicSum");
+    }
+
+    static void inferSum(ov::CompiledModel& compiledModel, size_t numInputs) {
+        auto inferReq = compiledModel.create_infer_request();
+        for (const auto& shape : std::vector<ov::Shape>{{2, 3, 5}, {4, 7, 33}, {1, 2, 3}}) {
+            std::vector<ov::Tensor> inputs;
+            for (size_t i = 0; i < numInputs; i++) {
+                inputs.push_back(makeInput(shape, static_cast<float>(i)));
+                inferReq.set_input_tensor(i, inputs.back());
+            }
+            inferReq.infer();
+            const auto out = inferReq.get_output_tensor();
+            ASSERT_EQ(shape, out.get_shape());
+            for (size_t j = 0; j < out.get_size(); j++) {
+                float expected = 0.f;
+                for (const auto& in : inputs)
+                    expected += in.data<const float>()[j];
+                ASSERT_FLOAT_EQ(expected, out.data<const float>()[j]);
+            }
+        }
+    }
+
+    static ov::Tensor makeInput(const ov::Shape& shape, float shift) {
+        auto tensor = ov::Tensor(ov::element::f32, shape);
+        for (size_t i = 0; i < tensor.get_size(); i++)
+            tensor.data<float>()[i] = static_cast<float>(i % 13) - shift;
+        return tensor;
+    }
+
+    static void check(const ov::Tensor& in0, const ov::Tensor& in1, const ov::Tensor& out) {
+        const auto& shape0 = in0.get_shape();
+        const auto& shape1 = in1.get_shape();
+        ASSERT_EQ(shape0, out.get_shape());
+        auto src0 = in0.data<const float>();
+        auto src1 = in1.data<const float>();
+        auto dst = out.data<const float>();
+        for (size_t i = 0; i < shape0[0]; i++) {
+            for (size_t j = 0; j < shape0[1]; j++) {
+                for (size_t k = 0; k < shape0[2]; k++) {
+                    const size_t idx0 = (i * shape0[1] + j) * shape0[2] + k;
+                    const size_t idx1 = ((shape1[0] == 1 ? 0 : i) * shape1[1] + (shape1[1] == 1 ? 0 : j)) * shape1[2] +
+                                        (shape1[2] == 1 ? 0 : k);
+                    const float expected = std::max(0.f, (src0[idx0] + src1[idx1]) * 2.f);
+                    ASSERT_FLOAT_EQ(expected, dst[idx0]);
+                }
+            }
+        }
+    }
+};
+
+TEST_F(SnippetsDynamicCPUTest, smoke_ReuseKernelForShapes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(makeModel(), CommonTestUtils::DEVICE_CPU);
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 1);
+    auto inferReq = compiledModel.create_infer_request();
+
+    const std::vector<std::pair<ov::Shape, ov::Shape>> shapes{
+        {{2, 3, 17}, {2, 3, 17}},
+        {{1, 5, 64}, {1, 5, 64}},
+        {{4, 7, 3}, {4, 7, 3}},
+        {{2, 3, 17}, {1, 3, 1}},
+        {{3, 9, 33}, {1, 1, 33}},
+        {{2, 3, 17}, {2, 3, 17}},
+    };
+    for (const auto& s : shapes) {
+        const auto in0 = makeInput(s.first, 6.f);
+        const auto in1 = makeInput(s.second, 4.f);
+        inferReq.set_input_tensor(0, in0);
+        inferReq.set_input_tensor(1, in1);
+        inferReq.infer();
+        check(in0, in1, inferReq.get_output_tensor());
+    }
+}
+
+// The shape-agnostic kernels keep one more GPR reserved, so the dynamic Subgraph takes up to 11 inputs and outputs
+TEST_F(SnippetsDynamicCPUTest, smoke_IoLimit) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    auto atLimit = core.compile_model(makeSumModel(10), CommonTestUtils::DEVICE_CPU);
+    CheckNumberOfNodesWithType(atLimit, "Subgraph", 1);
+    inferSum(atLimit, 10);
+
+    auto overLimit = core.compile_model(makeSumModel(11), CommonTestUtils::DEVICE_CPU);
+    CheckNumberOfNodesWithType(overLimit, "Subgraph", 2);
+    inferSum(overLimit, 11);
+}
+
+TEST_F(SnippetsDynamicCPUTest, smoke_DynamicTokenizationDisabled) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    const ov::AnyMap config{{InferenceEngine::PluginConfigInternalParams::KEY_CPU_SNIPPETS_DYNAMIC_SHAPES,
+                             InferenceEngine::PluginConfigParams::NO}};
+    auto compiledModel = core.compile_model(makeSumModel(3), CommonTestUtils::DEVICE_CPU, config);
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 0);
+    inferSum(compiledModel, 3);
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,160 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* Reductions over the last dimension are tokenized with the surrounding eltwise ops, so the normalization blocks are
+   executed by one Subgraph node. The last dimension isn't a multiple of the vector size to cover the tail Loops,
+   the inputs are negative to check the initial value of ReduceMax, which must be -inf for the rows of -inf.
+
+    RMSNorm:                                  Shift by max:
+        Param                                     Param
+       /  |                                      /    \
+      |  Multiply(x, x)                         |   ReduceMax(-1)
+      |   |                                      \    /
+      |  ReduceMean(-1)                         Subtract
+      |   |                                         |
+      |  Add(eps)                                  Exp
+      |   |                                         |
+      |  Sqrt                                     Result
+       \  |
+       Divide
+          |
+        Result
+*/
+class SnippetsReduceCPUTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    const ov::Shape shape{2, 3, 19};
+    const float eps = 1e-5f;
+
+    std::shared_ptr<ov::Model> makeRMSNorm() {
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        auto square = std::make_shared<ov::opset8::Multiply>(param, param);
+        auto axes = ov::opset8::Constant::create(ov::element::i64, {1}, {-1});
+        auto mean = std::make_shared<ov::opset8::ReduceMean>(square, axes, true);
+        auto add = std::make_shared<ov::opset8::Add>(mean, ov::opset8::Constant::create(ov::element::f32, {}, {eps}));
+        auto sqrt = std::make_shared<ov::opset8::Sqrt>(add);
+        auto divide = std::make_shared<ov::opset8::Divide>(param, sqrt);
+        auto result = std::make_shared<ov::opset8::Result>(divide);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "RMSNorm");
+    }
+
+    std::shared_ptr<ov::Model> makeShiftByMax(bool withExp = true) {
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        auto axes = ov::opset8::Constant::create(ov::element::i64, {1}, {2});
+        auto max = std::make_shared<ov::opset8::ReduceMax>(param, axes, true);
+        std::shared_ptr<ov::Node> shifted = std::make_shared<ov::opset8::Subtract>(param, max);
+        if (withExp)
+            shifted = std::make_shared<ov::opset8::Exp>(shifted);
+        auto result = std::make_shared<ov::opset8::Result>(shifted);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "ShiftByMax");
+    }
+
+    std::shared_ptr<ov::Model> makeStandaloneReduce(const ov::element::Type& type) {
+        auto param = std::make_shared<ov::opset8::Parameter>(type, shape);
+        auto axes = ov::opset8::Constant::create(ov::element::i64, {1}, {-1});
+        auto mean = std::make_shared<ov::opset8::ReduceMean>(param, axes, true);
+        auto multiply = std::make_shared<ov::opset8::Multiply>(mean, ov::opset8::Constant::create(type, {}, {2}));
+        auto result = std::make_shared<ov::opset8::Result>(multiply);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "StandaloneReduce");
+    }
+
+    ov::Tensor makeInput() const {
+        auto tensor = ov::Tensor(ov::element::f32, shape);
+        for (size_t i = 0; i < tensor.get_size(); i++)
+            tensor.data<float>()[i] = -static_cast<float>(i % 17) / 4.f - 1.f;
+        return tensor;
+    }
+
+    template <typename RowFunc>
+    void infer(const std::shared_ptr<ov::Model>& model, const ov::Tensor& input, RowFunc reference) {
+        ov::Core core;
+        auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU);
+        CheckNumberOfNodesWithType(compiledModel, "Subgraph", 1);
+        auto inferReq = compiledModel.create_infer_request();
+        inferReq.set_input_tensor(input);
+        inferReq.infer();
+        const auto output = inferReq.get_output_tensor();
+        EXPECT_EQ(shape, output.get_shape());
+
+        const size_t rowSize = shape.back();
+        const auto src = input.data<const float>();
+        const auto dst = output.data<const float>();
+        std::vector<float> expected(input.get_size());
+        for (size_t row = 0; row < input.get_size() / rowSize; row++)
+            reference(src + row * rowSize, expected.data() + row * rowSize, rowSize);
+        for (size_t i = 0; i < expected.size(); i++) {
+            if (std::isnan(expected[i]))
+                EXPECT_TRUE(std::isnan(dst[i])) << "at " << i;
+            else if (std::isinf(expected[i]))
+                EXPECT_EQ(expected[i], dst[i]) << "at " << i;
+            else
+                EXPECT_NEAR(expected[i], dst[i], 1e-5f * std::max(1.f, std::abs(expected[i])));
+        }
+    }
+};
+
+TEST_F(SnippetsReduceCPUTest, smoke_RMSNorm) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    infer(makeRMSNorm(), makeInput(), [this](const float* src, float* dst, size_t size) {
+        float sum = 0.f;
+        for (size_t i = 0; i < size; i++)
+            sum += src[i] * src[i];
+        const float norm = std::sqrt(sum / static_cast<float>(size) + eps);
+        for (size_t i = 0; i < size; i++)
+            dst[i] = src[i] / norm;
+    });
+}
+
+TEST_F(SnippetsReduceCPUTest, smoke_ShiftByMax) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    infer(makeShiftByMax(), makeInput(), [](const float* src, float* dst, size_t size) {
+        const float max = *std::max_element(src, src + size);
+        for (size_t i = 0; i < size; i++)
+            dst[i] = std::exp(src[i] - max);
+    });
+}
+
+TEST_F(SnippetsReduceCPUTest, smoke_ShiftByMaxOfInfinities) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    // the first row is -inf only, so is its max, the second row mixes -inf with the finite values
+    auto input = makeInput();
+    const auto rowSize = shape.back();
+    for (size_t i = 0; i < 2 * rowSize; i++) {
+        if (i < rowSize || i % 3 == 0)
+            input.data<float>()[i] = -std::numeric_limits<float>::infinity();
+    }
+    infer(makeShiftByMax(false), input, [](const float* src, float* dst, size_t size) {
+        const float max = *std::max_element(src, src + size);
+        for (size_t i = 0; i < size; i++)
+            dst[i] = src[i] - max;
+    });
+}
+
+// Only the normalization patterns are tokenized, the standalone reductions keep the plugin node with its fusings
+TEST_F(SnippetsReduceCPUTest, smoke_StandaloneReduceIsNotTokenized) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    for (const auto& type : {ov::element::f32, ov::element::u8}) {
+        ov::Core core;
+        auto compiledModel = core.compile_model(makeStandaloneReduce(type), CommonTestUtils::DEVICE_CPU);
+        CheckNumberOfNodesWithType(compiledModel, "Subgraph", 0);
+        CheckNumberOfNodesWithType(compiledModel, "Reduce", 1);
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,168 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset6.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* The state is accumulated in place: the graph reads and writes the state buffers of the infer request directly,
+   and two infer requests sharing the graph keep their own states.
+
+    Param   ReadValue
+        \    /
+         Add
+        /   \
+    Assign   Result
+*/
+class StatefulModelCPUTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    std::shared_ptr<ov::Model> makeModel() {
+        const ov::Shape shape{1, 8};
+        auto param = std::make_shared<ov::opset6::Parameter>(ov::element::f32, shape);
+        auto variable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{shape, ov::element::f32, "state"});
+        auto init = ov::opset6::Constant::create(ov::element::f32, shape, {0.f});
+        auto readValue = std::make_shared<ov::opset6::ReadValue>(init, variable);
+        auto add = std::make_shared<ov::opset6::Add>(readValue, param);
+        auto assign = std::make_shared<ov::opset6::Assign>(add, variable);
+        auto result = std::make_shared<ov::opset6::Result>(add);
+        return std::make_shared<ov::Model>(ov::ResultVector{result},
+                                           ov::SinkVector{assign},
+                                           ov::ParameterVector{param},
+                                           "StatefulModel");
+    }
+
+    static void fill(ov::Tensor tensor, float value) {
+        auto data = tensor.data<float>();
+        std::fill(data, data + tensor.get_size(), value);
+    }
+
+    static void check(const ov::Tensor& tensor, float expected) {
+        auto data = tensor.data<const float>();
+        for (size_t i = 0; i < tensor.get_size(); i++)
+            ASSERT_FLOAT_EQ(expected, data[i]);
+    }
+};
+
+TEST_F(StatefulModelCPUTest, smoke_AccumulateState) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(makeModel(), CommonTestUtils::DEVICE_CPU);
+    auto inferReq1 = compiledModel.create_infer_request();
+    auto inferReq2 = compiledModel.create_infer_request();
+
+    fill(inferReq1.get_input_tensor(), 1.f);
+    fill(inferReq2.get_input_tensor(), 2.f);
+    for (int i = 1; i <= 3; i++) {
+        inferReq1.infer();
+        inferReq2.infer();
+        check(inferReq1.get_output_tensor(), 1.f * i);
+        check(inferReq2.get_output_tensor(), 2.f * i);
+    }
+
+    auto states = inferReq1.query_state();
+    ASSERT_EQ(1u, states.size());
+    check(states.front().get_state(), 3.f);
+
+    auto newState = ov::Tensor(ov::element::f32, ov::Shape{1, 8});
+    fill(newState, 10.f);
+    states.front().set_state(newState);
+    inferReq1.infer();
+    check(inferReq1.get_output_tensor(), 11.f);
+    check(states.front().get_state(), 11.f);
+
+    states.front().reset();
+    inferReq1.infer();
+    check(inferReq1.get_output_tensor(), 1.f);
+
+    // the state of the other request is not affected
+    inferReq2.infer();
+    check(inferReq2.get_output_tensor(), 8.f);
+}
+
+/* The state of a variable with a dynamic shape grows by a step on each inference. With the capacity reserved up front
+   the state is appended by the Concat in place, the reserved capacity is exceeded by the test to check the content of
+   the state is preserved while its buffer grows.
+
+    ReadValue  Param
+         \     /
+         Concat
+         /    \
+    Assign   Result
+*/
+class GrowingStateCPUTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    std::shared_ptr<ov::Model> makeModel() {
+        auto param = std::make_shared<ov::opset6::Parameter>(ov::element::f32, ov::Shape{1, 1, 4});
+        auto variable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{ov::PartialShape{1, -1, 4}, ov::element::f32, "history"});
+        auto init = ov::opset6::Constant::create(ov::element::f32, ov::Shape{1, 0, 4}, std::vector<float>{});
+        auto readValue = std::make_shared<ov::opset6::ReadValue>(init, variable);
+        auto concat = std::make_shared<ov::opset6::Concat>(ov::OutputVector{readValue, param}, 1);
+        auto assign = std::make_shared<ov::opset6::Assign>(concat, variable);
+        auto result = std::make_shared<ov::opset6::Result>(concat);
+        return std::make_shared<ov::Model>(ov::ResultVector{result},
+                                           ov::SinkVector{assign},
+                                           ov::ParameterVector{param},
+                                           "GrowingState");
+    }
+
+    void run(const ov::AnyMap& config) {
+        ov::Core core;
+        auto compiledModel = core.compile_model(makeModel(), CommonTestUtils::DEVICE_CPU, config);
+        auto inferReq = compiledModel.create_infer_request();
+
+        auto check = [](const ov::Tensor& tensor, size_t steps) {
+            ASSERT_EQ(ov::Shape({1, steps, 4}), tensor.get_shape());
+            auto data = tensor.data<const float>();
+            for (size_t i = 0; i < tensor.get_size(); i++)
+                ASSERT_FLOAT_EQ(static_cast<float>(i / 4 + 1), data[i]);
+        };
+
+        for (size_t step = 1; step <= 5; step++) {
+            auto input = inferReq.get_input_tensor();
+            std::fill_n(input.data<float>(), input.get_size(), static_cast<float>(step));
+            inferReq.infer();
+            check(inferReq.get_output_tensor(), step);
+        }
+
+        auto states = inferReq.query_state();
+        ASSERT_EQ(1u, states.size());
+        check(states.front().get_state(), 5);
+
+        auto newState = ov::Tensor(ov::element::f32, ov::Shape{1, 2, 4});
+        for (size_t i = 0; i < newState.get_size(); i++)
+            newState.data<float>()[i] = static_cast<float>(i / 4 + 1);
+        states.front().set_state(newState);
+        auto input = inferReq.get_input_tensor();
+        std::fill_n(input.data<float>(), input.get_size(), 3.f);
+        inferReq.infer();
+        check(inferReq.get_output_tensor(), 3);
+
+        states.front().reset();
+        std::fill_n(input.data<float>(), input.get_size(), 1.f);
+        inferReq.infer();
+        check(inferReq.get_output_tensor(), 1);
+    }
+};
+
+TEST_F(GrowingStateCPUTest, smoke_GrowState) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run({});
+}
+
+TEST_F(GrowingStateCPUTest, smoke_GrowStateInPlace) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run({{InferenceEngine::PluginConfigInternalParams::KEY_CPU_STATE_RESERVE, "2"}});
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* The TensorIterator body reads the sliced input and writes the sliced output in place when the slices are
+   contiguous (batch 1) and passes the hidden state through the back edge by swapping two buffers. The batch 2 slices
+   are not contiguous and are copied. Both directions of the input iteration are checked.
+
+    TensorIterator body:
+     X[:, i, :]     H
+          \        /
+           \   Multiply(0.5)
+            \    /
+             Add
+              |
+            Relu ---> H (back edge), concatenated output, last iteration output
+*/
+class TensorIteratorZeroCopyCPUTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    static constexpr size_t seqLen = 5;
+    static constexpr size_t channels = 8;
+
+    static std::shared_ptr<ov::Model> makeModel(size_t batch, bool reverse) {
+        auto x = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{batch, seqLen, channels});
+        auto h0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{batch, 1, channels});
+
+        auto bodyX = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{batch, 1, channels});
+        auto bodyH = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{batch, 1, channels});
+        auto scaled = std::make_shared<ov::opset8::Multiply>(bodyH, ov::opset8::Constant::create(ov::element::f32, {}, {0.5f}));
+        auto add = std::make_shared<ov::opset8::Add>(bodyX, scaled);
+        auto relu = std::make_shared<ov::opset8::Relu>(add);
+        auto bodyResult = std::make_shared<ov::opset8::Result>(relu);
+        auto body = std::make_shared<ov::Model>(ov::ResultVector{bodyResult}, ov::ParameterVector{bodyX, bodyH});
+
+        auto ti = std::make_shared<ov::opset8::TensorIterator>();
+        ti->set_body(body);
+        if (reverse)
+            ti->set_sliced_input(bodyX, x, -1, -1, 1, 0, 1);
+        else
+            ti->set_sliced_input(bodyX, x, 0, 1, 1, -1, 1);
+        ti->set_merged_input(bodyH, h0, bodyResult);
+        auto sequence = ti->get_concatenated_slices(bodyResult, 0, 1, 1, -1, 1);
+        auto last = ti->get_iter_value(bodyResult, -1);
+
+        return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset8::Result>(sequence),
+                                                            std::make_shared<ov::opset8::Result>(last)},
+                                           ov::ParameterVector{x, h0},
+                                           "TensorIteratorZeroCopy");
+    }
+
+    static void run(size_t batch, bool reverse) {
+        ov::Core core;
+        auto inferReq = core.compile_model(makeModel(batch, reverse), CommonTestUtils::DEVICE_CPU).create_infer_request();
+
+        auto x = ov::Tensor(ov::element::f32, ov::Shape{batch, seqLen, channels});
+        for (size_t i = 0; i < x.get_size(); i++)
+            x.data<float>()[i] = static_cast<float>(i % 13) / 4.f - 1.f;
+        auto h0 = ov::Tensor(ov::element::f32, ov::Shape{batch, 1, channels});
+        for (size_t i = 0; i < h0.get_size(); i++)
+            h0.data<float>()[i] = static_cast<float>(i % 5);
+
+        // the second inference checks the buffers are rebound correctly after the previous one
+        for (int n = 0; n < 2; n++) {
+            inferReq.set_input_tensor(0, x);
+            inferReq.set_input_tensor(1, h0);
+            inferReq.infer();
+            const auto sequence = inferReq.get_output_tensor(0);
+            const auto last = inferReq.get_output_tensor(1);
+
+            for (size_t b = 0; b < batch; b++) {
+                std::vector<float> h(h0.data<float>() + b * channels, h0.data<float>() + (b + 1) * channels);
+                for (size_t t = 0; t < seqLen; t++) {
+                    const size_t step = reverse ? seqLen - 1 - t : t;
+                    for (size_t c = 0; c < channels; c++) {
+                        h[c] = std::max(0.f, x.data<float>()[(b * seqLen + step) * channels + c] + 0.5f * h[c]);
+                        ASSERT_FLOAT_EQ(h[c], sequence.data<float>()[(b * seqLen + t) * channels + c]);
+                    }
+                }
+                for (size_t c = 0; c < channels; c++)
+                    ASSERT_FLOAT_EQ(h[c], last.data<float>()[b * channels + c]);
+            }
+        }
+    }
+};
+
+TEST_F(TensorIteratorZeroCopyCPUTest, smoke_ContiguousSlices) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run(1, false);
+    run(1, true);
+}
+
+TEST_F(TensorIteratorZeroCopyCPUTest, smoke_StridedSlices) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run(2, false);
+    run(2, true);
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,220 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset11.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* The threshold select mode of TopK is applied for the long contiguous axes and the large K. Its results must match
+   the ones of the comparison based algorithms, including the order of the equal values. The values are taken from a
+   narrow range, so there are many equal values around the threshold.
+
+       Param
+         |
+       TopK(K, axis = -1)
+        /      \
+    Values   Indices
+*/
+class TopKRadixSelectCPUTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    static std::shared_ptr<ov::Model> makeModel(const ov::Shape& shape, int64_t k, ov::op::TopKMode mode,
+                                                ov::op::TopKSortType sort, ov::element::Type type, bool stable) {
+        auto param = std::make_shared<ov::opset11::Parameter>(type, shape);
+        auto kConst = ov::opset11::Constant::create(ov::element::i64, {}, {k});
+        auto topk = std::make_shared<ov::opset11::TopK>(param, kConst, -1, mode, sort, ov::element::i32, stable);
+        return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset11::Result>(topk->output(0)),
+                                                            std::make_shared<ov::opset11::Result>(topk->output(1))},
+                                           ov::ParameterVector{param},
+                                           "TopKRadixSelect");
+    }
+
+    static ov::InferRequest compile(ov::Core& core, const std::shared_ptr<ov::Model>& model, bool radixSelect) {
+        const std::string value = radixSelect ? InferenceEngine::PluginConfigParams::YES
+                                              : InferenceEngine::PluginConfigParams::NO;
+        return core.compile_model(model,
+                                  CommonTestUtils::DEVICE_CPU,
+                                  {{InferenceEngine::PluginConfigInternalParams::KEY_CPU_TOPK_RADIX_SELECT, value}})
+            .create_infer_request();
+    }
+
+    static ov::Tensor makeInput(const ov::Shape& shape, ov::element::Type type, int range) {
+        auto input = ov::Tensor(type, shape);
+        for (size_t i = 0; i < input.get_size(); i++) {
+            const int value = static_cast<int>((i * 7919) % range) - range / 2;
+            if (type == ov::element::f32)
+                input.data<float>()[i] = static_cast<float>(value) * 0.25f;
+            else if (type == ov::element::bf16)
+                input.data<ov::bfloat16>()[i] = ov::bfloat16(static_cast<float>(value) * 0.25f);
+            else if (type == ov::element::i8)
+                input.data<int8_t>()[i] = static_cast<int8_t>(value);
+            else if (type == ov::element::u8)
+                input.data<uint8_t>()[i] = static_cast<uint8_t>(value + range / 2);
+            else
+                input.data<int32_t>()[i] = value;
+        }
+        return input;
+    }
+
+    // most of the values are -0.0 and +0.0, which are equal for the comparison
+    static ov::Tensor makeSignedZerosInput(const ov::Shape& shape) {
+        auto input = ov::Tensor(ov::element::f32, shape);
+        const float values[] = {1.f, -1.f, 0.f, -0.f, 0.f};
+        for (size_t i = 0; i < input.get_size(); i++)
+            input.data<float>()[i] = values[(i * 7919) % 5];
+        return input;
+    }
+
+    static double valueAt(const ov::Tensor& tensor, size_t i) {
+        const auto type = tensor.get_element_type();
+        if (type == ov::element::f32)
+            return tensor.data<const float>()[i];
+        if (type == ov::element::bf16)
+            return static_cast<float>(tensor.data<const ov::bfloat16>()[i]);
+        if (type == ov::element::i8)
+            return tensor.data<const int8_t>()[i];
+        if (type == ov::element::u8)
+            return tensor.data<const uint8_t>()[i];
+        return tensor.data<const int32_t>()[i];
+    }
+
+    static void compare(const ov::Tensor& input, int64_t k, ov::op::TopKMode mode, ov::op::TopKSortType sort,
+                        bool stable) {
+        ov::Core core;
+        const auto& shape = input.get_shape();
+        auto model = makeModel(shape, k, mode, sort, input.get_element_type(), stable);
+        auto refReq = compile(core, model, false);
+        auto inferReq = compile(core, model, true);
+
+        refReq.set_input_tensor(input);
+        inferReq.set_input_tensor(input);
+        refReq.infer();
+        inferReq.infer();
+
+        if (stable) {
+            // the stable sorting defines the order of the equal values for the comparison based algorithms
+            for (size_t port = 0; port < 2; port++) {
+                const auto expected = refReq.get_output_tensor(port);
+                const auto actual = inferReq.get_output_tensor(port);
+                ASSERT_EQ(expected.get_byte_size(), actual.get_byte_size());
+                ASSERT_EQ(0, std::memcmp(expected.data(), actual.data(), expected.get_byte_size()));
+            }
+            return;
+        }
+
+        // otherwise any of the equal values may be selected, so the values are compared and the indices are checked
+        // to point to them
+        const auto expected = refReq.get_output_tensor(0);
+        const auto actual = inferReq.get_output_tensor(0);
+        const auto indices = inferReq.get_output_tensor(1);
+        ASSERT_EQ(expected.get_size(), actual.get_size());
+        const size_t axis = shape.back();
+        for (size_t i = 0; i < actual.get_size(); i++) {
+            ASSERT_EQ(valueAt(expected, i), valueAt(actual, i)) << "at " << i;
+            const auto idx = indices.data<const int32_t>()[i];
+            ASSERT_LT(static_cast<size_t>(idx), axis);
+            ASSERT_EQ(valueAt(actual, i), valueAt(input, i / static_cast<size_t>(k) * axis + idx)) << "at " << i;
+        }
+    }
+
+    static void compare(const ov::Shape& shape, int64_t k, ov::op::TopKMode mode, ov::op::TopKSortType sort,
+                        ov::element::Type type = ov::element::f32, bool stable = true) {
+        // the narrow types get the narrow range, so there are many equal values as well
+        const int range = type.size() == 1 ? 200 : 1000;
+        compare(makeInput(shape, type, range), k, mode, sort, stable);
+    }
+};
+
+TEST_F(TopKRadixSelectCPUTest, smoke_SortByValue) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    compare({2, 20000}, 500, ov::op::TopKMode::MAX, ov::op::TopKSortType::SORT_VALUES);
+    compare({2, 20000}, 500, ov::op::TopKMode::MIN, ov::op::TopKSortType::SORT_VALUES);
+    compare({64, 5000}, 64, ov::op::TopKMode::MAX, ov::op::TopKSortType::SORT_VALUES);
+    compare({3, 10000}, 1000, ov::op::TopKMode::MAX, ov::op::TopKSortType::SORT_VALUES, ov::element::i32);
+}
+
+TEST_F(TopKRadixSelectCPUTest, smoke_SortByIndex) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    compare({2, 20000}, 500, ov::op::TopKMode::MAX, ov::op::TopKSortType::SORT_INDICES);
+    compare({64, 5000}, 64, ov::op::TopKMode::MIN, ov::op::TopKSortType::SORT_INDICES);
+}
+
+TEST_F(TopKRadixSelectCPUTest, smoke_NarrowPrecisions) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    for (const auto& type : {ov::element::bf16, ov::element::i8, ov::element::u8}) {
+        compare({2, 20000}, 500, ov::op::TopKMode::MAX, ov::op::TopKSortType::SORT_VALUES, type);
+        compare({2, 20000}, 500, ov::op::TopKMode::MIN, ov::op::TopKSortType::SORT_VALUES, type);
+        compare({64, 5000}, 64, ov::op::TopKMode::MAX, ov::op::TopKSortType::SORT_INDICES, type);
+    }
+}
+
+TEST_F(TopKRadixSelectCPUTest, smoke_NotStable) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    for (const auto& type : {ov::element::f32, ov::element::bf16, ov::element::i32, ov::element::i8, ov::element::u8}) {
+        compare({2, 20000}, 500, ov::op::TopKMode::MAX, ov::op::TopKSortType::SORT_VALUES, type, false);
+        compare({64, 5000}, 64, ov::op::TopKMode::MIN, ov::op::TopKSortType::SORT_VALUES, type, false);
+    }
+}
+
+TEST_F(TopKRadixSelectCPUTest, smoke_SignedZeros) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    // the threshold falls on the zeros, so the selection depends on -0.0 being equal to +0.0
+    const auto input = makeSignedZerosInput({2, 10000});
+    for (bool stable : {true, false}) {
+        compare(input, 4000, ov::op::TopKMode::MAX, ov::op::TopKSortType::SORT_VALUES, stable);
+        compare(input, 4000, ov::op::TopKMode::MIN, ov::op::TopKSortType::SORT_VALUES, stable);
+        // the unstable selection of the equal values is not defined, neither is the order of the indices then
+        if (stable)
+            compare(input, 4000, ov::op::TopKMode::MAX, ov::op::TopKSortType::SORT_INDICES, stable);
+    }
+}
+
+// Sweeps K and the axis length and reports the average latency of the threshold select against the comparison based
+// algorithms. Run it explicitly with --gtest_also_run_disabled_tests.
+TEST_F(TopKRadixSelectCPUTest, DISABLED_Benchmark) {
+    constexpr int iterations = 20;
+    ov::Core core;
+    std::cout << std::setw(10) << "axis" << std::setw(8) << "K" << std::setw(16) << "default, us"
+              << std::setw(16) << "radix, us" << std::endl;
+    for (size_t axis : {4096, 65536, 1048576, 4194304}) {
+        for (int64_t k : {32, 256, 2048, 8192}) {
+            if (static_cast<size_t>(k) > axis)
+                continue;
+            const ov::Shape shape{1, axis};
+            auto model = makeModel(shape, k, ov::op::TopKMode::MAX, ov::op::TopKSortType::SORT_VALUES, ov::element::f32,
+                                   false);
+            const auto input = makeInput(shape, ov::element::f32, 1 << 20);
+
+            std::cout << std::setw(10) << axis << std::setw(8) << k;
+            for (bool radixSelect : {false, true}) {
+                auto inferReq = compile(core, model, radixSelect);
+                inferReq.set_input_tensor(input);
+                inferReq.infer();
+                const auto start = std::chrono::steady_clock::now();
+                for (int i = 0; i < iterations; i++)
+                    inferReq.infer();
+                const auto us = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start).count() / iterations;
+                std::cout << std::setw(16) << us;
+            }
+            std::cout << std::endl;
+        }
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,166 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fstream>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* The weights of the convolution and the fully connected layer are reordered to the blocked layouts, so
+   CPU_WEIGHTS_CACHE_DIR stores them to the blob files and maps them on the subsequent compilations.
+   The results must match the ones of the default compilation for the cache miss, the cache hit, the truncated
+   blobs and the changed model weights, and for CPU_WEIGHTS_ZERO_COPY as well.
+
+        Param
+          |
+     Convolution
+          |
+        Relu
+          |
+       Reshape
+          |
+        MatMul
+          |
+        Result
+*/
+class WeightsCacheDirCPUTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    void SetUp() override {
+        cacheDir = CommonTestUtils::generateTestFilePrefix() + "_weights_cache_dir";
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
+    static std::vector<float> makeData(size_t size, size_t period) {
+        std::vector<float> data(size);
+        for (size_t i = 0; i < data.size(); i++)
+            data[i] = static_cast<float>(i % period) / static_cast<float>(period) - 0.5f;
+        return data;
+    }
+
+    // fcWeightsDelta is added to a single fully connected weight
+    static std::shared_ptr<ov::Model> makeModel(float fcWeightsDelta = 0.f) {
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 16, 8, 8});
+        auto convWeights = ov::opset8::Constant::create(ov::element::f32, ov::Shape{32, 16, 3, 3},
+                                                        makeData(32 * 16 * 3 * 3, 17));
+        auto conv = std::make_shared<ov::opset8::Convolution>(param, convWeights, ov::Strides{1, 1},
+                                                              ov::CoordinateDiff{1, 1}, ov::CoordinateDiff{1, 1},
+                                                              ov::Strides{1, 1});
+        auto relu = std::make_shared<ov::opset8::Relu>(conv);
+        auto shape = ov::opset8::Constant::create(ov::element::i64, ov::Shape{2}, std::vector<int64_t>{1, 32 * 8 * 8});
+        auto reshape = std::make_shared<ov::opset8::Reshape>(relu, shape, false);
+        auto fcData = makeData(32 * 8 * 8 * 64, 13);
+        fcData[25] += fcWeightsDelta;
+        auto fcWeights = ov::opset8::Constant::create(ov::element::f32, ov::Shape{32 * 8 * 8, 64}, fcData);
+        auto matMul = std::make_shared<ov::opset8::MatMul>(reshape, fcWeights);
+        auto result = std::make_shared<ov::opset8::Result>(matMul);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "WeightsCacheDir");
+    }
+
+    std::vector<float> compileAndInfer(const ov::AnyMap& config, float fcWeightsDelta = 0.f) {
+        ov::Core core;
+        auto compiledModel = core.compile_model(makeModel(fcWeightsDelta), CommonTestUtils::DEVICE_CPU, config);
+        auto inferReq = compiledModel.create_infer_request();
+        auto input = ov::Tensor(ov::element::f32, ov::Shape{1, 16, 8, 8});
+        for (size_t i = 0; i < input.get_size(); i++)
+            input.data<float>()[i] = static_cast<float>(i % 11) - 5.f;
+        inferReq.set_input_tensor(input);
+        inferReq.infer();
+        auto output = inferReq.get_output_tensor();
+        return std::vector<float>(output.data<float>(), output.data<float>() + output.get_size());
+    }
+
+    static void compare(const std::vector<float>& expected, const std::vector<float>& actual) {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); i++)
+            ASSERT_FLOAT_EQ(expected[i], actual[i]);
+    }
+
+    // changes the leading weights of the blobs keeping their size and trailer
+    static void overwriteWeights(const std::vector<std::string>& blobs) {
+        const std::vector<char> garbage(64, 0x5a);
+        for (const auto& blob : blobs) {
+            std::fstream stream(blob, std::ios::binary | std::ios::in | std::ios::out);
+            stream.write(garbage.data(), garbage.size());
+        }
+    }
+
+    ov::AnyMap cacheConfig() const {
+        return {{InferenceEngine::PluginConfigInternalParams::KEY_CPU_WEIGHTS_CACHE_DIR, cacheDir}};
+    }
+
+    std::string cacheDir;
+};
+
+TEST_F(WeightsCacheDirCPUTest, smoke_WeightsZeroCopy) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto expected = compileAndInfer({});
+    const ov::AnyMap config{{InferenceEngine::PluginConfigInternalParams::KEY_CPU_WEIGHTS_ZERO_COPY, "YES"}};
+    compare(expected, compileAndInfer(config));
+}
+
+TEST_F(WeightsCacheDirCPUTest, smoke_WeightsCacheHitAndMiss) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto expected = compileAndInfer({});
+
+    // miss: the reordered weights are stored
+    compare(expected, compileAndInfer(cacheConfig()));
+    const auto blobs = CommonTestUtils::listFilesWithExt(cacheDir, "blob");
+    ASSERT_FALSE(blobs.empty());
+
+    // hit: the stored weights are mapped and are not rewritten
+    compare(expected, compileAndInfer(cacheConfig()));
+    ASSERT_EQ(blobs, CommonTestUtils::listFilesWithExt(cacheDir, "blob"));
+
+    // the changed weights in the blobs prove the blobs are used
+    overwriteWeights(blobs);
+    const auto actual = compileAndInfer(cacheConfig());
+    ASSERT_EQ(expected.size(), actual.size());
+    ASSERT_NE(expected, actual);
+}
+
+TEST_F(WeightsCacheDirCPUTest, smoke_WeightsCacheCorruptedBlobs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto expected = compileAndInfer({});
+    compare(expected, compileAndInfer(cacheConfig()));
+    const auto blobs = CommonTestUtils::listFilesWithExt(cacheDir, "blob");
+    ASSERT_FALSE(blobs.empty());
+
+    // the truncated blobs are recreated
+    for (const auto& blob : blobs)
+        std::ofstream(blob, std::ios::binary | std::ios::trunc) << "truncated";
+    compare(expected, compileAndInfer(cacheConfig()));
+    // and are repaired
+    compare(expected, compileAndInfer(cacheConfig()));
+}
+
+TEST_F(WeightsCacheDirCPUTest, smoke_WeightsCacheChangedWeights) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    compileAndInfer(cacheConfig());
+    const auto blobs = CommonTestUtils::listFilesWithExt(cacheDir, "blob");
+    ASSERT_FALSE(blobs.empty());
+
+    // a single changed weight must not match the blob of the original weights
+    const auto expected = compileAndInfer({}, 1.f);
+    compare(expected, compileAndInfer(cacheConfig(), 1.f));
+    ASSERT_LT(blobs.size(), CommonTestUtils::listFilesWithExt(cacheDir, "blob").size());
+}
+
+} // namespace SubgraphTestsDefinitions
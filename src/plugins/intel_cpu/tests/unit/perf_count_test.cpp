@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "perf_count.h"
+
+using namespace ov::intel_cpu;
+
+TEST(LatencyHistogramTests, SmallValuesAreExact) {
+    for (uint64_t ticks = 0; ticks < 2 * LatencyHistogram::subBuckets; ticks++) {
+        EXPECT_EQ(ticks, LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(ticks)));
+    }
+}
+
+TEST(LatencyHistogramTests, BucketBoundsContainValue) {
+    for (uint64_t ticks = 1; ticks < (1ull << 40); ticks = ticks * 3 + 1) {
+        const auto idx = LatencyHistogram::bucketIndex(ticks);
+        ASSERT_LT(idx, LatencyHistogram::numBuckets);
+        const auto upper = LatencyHistogram::bucketUpperBound(idx);
+        EXPECT_GE(upper, ticks);
+        // the relative error is bounded by the number of the linear sub-buckets
+        EXPECT_LE(upper - ticks, ticks / LatencyHistogram::subBuckets);
+        if (idx > 0) {
+            EXPECT_LT(LatencyHistogram::bucketUpperBound(idx - 1), ticks);
+        }
+    }
+    EXPECT_EQ(LatencyHistogram::numBuckets - 1, LatencyHistogram::bucketIndex(~0ull));
+}
+
+TEST(LatencyHistogramTests, Percentiles) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(0, histogram.count());
+    EXPECT_EQ(0, histogram.percentile(0.5));
+
+    for (uint64_t i = 1; i <= 1000; i++) {
+        histogram.add(i * 100);
+    }
+    EXPECT_EQ(1000, histogram.count());
+    EXPECT_EQ(100000, histogram.max());
+
+    const auto p50 = histogram.percentile(0.5);
+    EXPECT_GE(p50, 50000);
+    EXPECT_LE(p50, 50000 + 50000 / LatencyHistogram::subBuckets);
+    const auto p99 = histogram.percentile(0.99);
+    EXPECT_GE(p99, 99000);
+    EXPECT_LE(p99, histogram.max());
+    EXPECT_EQ(histogram.max(), histogram.percentile(1.0));
+}
+
+TEST(LatencyHistogramTests, ConcurrentAdd) {
+    LatencyHistogram histogram;
+    constexpr size_t numThreads = 4;
+    constexpr uint64_t numSamples = 10000;
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < numThreads; t++) {
+        threads.emplace_back([&histogram, t]() {
+            for (uint64_t i = 0; i < numSamples; i++) {
+                histogram.add(i + t);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(numThreads * numSamples, histogram.count());
+    EXPECT_EQ(numSamples - 1 + numThreads - 1, histogram.max());
+}
+
+TEST(LatencyHistogramTests, Merge) {
+    LatencyHistogram first, second, all;
+    for (uint64_t i = 1; i <= 1000; i++) {
+        (i % 3 ? first : second).add(i * 100);
+        all.add(i * 100);
+    }
+    LatencyHistogram merged;
+    merged.merge(first);
+    merged.merge(second);
+    EXPECT_EQ(all.count(), merged.count());
+    EXPECT_EQ(all.max(), merged.max());
+    EXPECT_EQ(all.percentile(0.5), merged.percentile(0.5));
+    EXPECT_EQ(all.percentile(0.99), merged.percentile(0.99));
+
+    // merging the smaller durations doesn't decrease the max
+    LatencyHistogram small;
+    small.add(1);
+    merged.merge(small);
+    EXPECT_EQ(all.max(), merged.max());
+    EXPECT_EQ(all.count() + 1, merged.count());
+}
+
+TEST(PerfCountTests, HistogramIsOptional) {
+    PerfCount counter;
+    {
+        PerfHelper helper(counter, false);
+    }
+    EXPECT_EQ(0, counter.count());
+
+    {
+        PerfHelper helper(counter, true);
+    }
+    EXPECT_EQ(1, counter.count());
+    EXPECT_EQ(nullptr, counter.getHistogram());
+
+    counter.enableHistogram();
+    for (int i = 0; i < 3; i++) {
+        PerfHelper helper(counter, true);
+    }
+    EXPECT_EQ(4, counter.count());
+    ASSERT_NE(nullptr, counter.getHistogram());
+    EXPECT_EQ(3, counter.getHistogram()->count());
+}
@@ -8,6 +8,7 @@
 #include <gmock/gmock.h>
 
 #include "cache/lru_cache.h"
+#include "cache/sharded_lru_cache.h"
 #include "cache/multi_cache.h"
 
 using namespace ov::intel_cpu;
@@ -104,6 +105,82 @@ public:
 };
 }// namespace
 
+TEST(ShardedLruCacheTests, LruPolicy) {
+    // a small capacity leads to a single shard, so the eviction order is exactly LRU
+    constexpr size_t capacity = 10;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 4; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    for (int i = 21; i < 25; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < 4; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+
+    for (int i = 4; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+}
+
+TEST(ShardedLruCacheTests, Stats) {
+    constexpr size_t capacity = 10;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    for (int i = 0; i < 2 * capacity; ++i) {
+        cache.get({i});
+    }
+
+    auto stats = cache.getStats();
+    ASSERT_EQ(stats.hits, capacity);
+    ASSERT_EQ(stats.misses, capacity);
+    ASSERT_EQ(stats.evictions, capacity);
+    ASSERT_EQ(stats.size, capacity);
+
+    ASSERT_NO_THROW(cache.evict(2 * capacity));
+    ASSERT_EQ(cache.getStats().size, 0);
+    ASSERT_EQ(cache.get({2 * capacity - 1}), int());
+}
+
+TEST(ShardedLruCacheTests, ConcurrentAccess) {
+    constexpr size_t capacity = 1000;
+    constexpr int numThreads = 8;
+    constexpr int numKeys = 4 * capacity;
+    ShardedLruCache<IntKey, int> cache(capacity);
+
+    auto testRoutine = [&](int shift) {
+        for (int i = 0; i < numKeys; ++i) {
+            const int key = (i + shift) % numKeys + 1;
+            const int value = cache.get({key});
+            ASSERT_TRUE(value == int() || value == key);
+            cache.put({key}, key);
+        }
+    };
+
+    {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < numThreads; ++i) {
+            threads.emplace_back(testRoutine, i * 97);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    auto stats = cache.getStats();
+    ASSERT_EQ(stats.hits + stats.misses, static_cast<uint64_t>(numThreads * numKeys));
+    ASSERT_GE(stats.size, capacity);
+}
+
 TEST(CacheEntryTests, GetOrCreate) {
     using testing::_;
     using ValueType = std::shared_ptr<int>;
@@ -379,3 +456,49 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+namespace {
+struct StatelessValue : public StatelessCacheValue {
+    explicit StatelessValue(int data) : data(data) {}
+    int data;
+};
+} // namespace
+
+TEST(MultiCacheTests, SharedStatelessValues) {
+    constexpr size_t capacity = 10;
+
+    auto sharedCache = std::make_shared<MultiCache>(capacity);
+    // the caches of two streams sharing the stateless values
+    MultiCache cache0(capacity, sharedCache);
+    MultiCache cache1(capacity, sharedCache);
+    ASSERT_EQ(sharedCache, cache0.getSharedCache());
+
+    auto statelessBuilder = [](const IntKey& key) { return std::make_shared<StatelessValue>(key.data); };
+    auto statefulBuilder = [](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    for (int i = 0; i < capacity; ++i) {
+        auto result0 = cache0.getOrCreate(IntKey{i}, statelessBuilder);
+        ASSERT_EQ(result0.second, CacheEntryBase::LookUpStatus::Miss);
+        // the stateless value created by one stream is reused by the other one
+        auto result1 = cache1.getOrCreate(IntKey{i}, statelessBuilder);
+        ASSERT_EQ(result1.second, CacheEntryBase::LookUpStatus::Hit);
+        ASSERT_EQ(result0.first, result1.first);
+    }
+
+    for (int i = 0; i < capacity; ++i) {
+        auto result0 = cache0.getOrCreate(IntKey{i}, statefulBuilder);
+        ASSERT_EQ(result0.second, CacheEntryBase::LookUpStatus::Miss);
+        // the other values are never shared between the streams
+        auto result1 = cache1.getOrCreate(IntKey{i}, statefulBuilder);
+        ASSERT_EQ(result1.second, CacheEntryBase::LookUpStatus::Miss);
+        ASSERT_NE(result0.first, result1.first);
+        ASSERT_EQ(cache0.getOrCreate(IntKey{i}, statefulBuilder).second, CacheEntryBase::LookUpStatus::Hit);
+    }
+
+    // the shared values are accounted by the shared cache only
+    EXPECT_EQ(capacity, sharedCache->getStats().hits);
+    EXPECT_EQ(capacity, sharedCache->getStats().misses);
+    EXPECT_EQ(capacity, cache0.getStats().hits);
+    EXPECT_EQ(capacity, cache0.getStats().misses);
+    EXPECT_EQ(0, cache1.getStats().hits);
+}
@@ -0,0 +1,120 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include <common_test_utils/file_utils.hpp>
+#include <cpu_memory.h>
+#include <memory_desc/cpu_blocked_memory_desc.h>
+#include <weights_file_cache.hpp>
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+class WeightsFileCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 1 MB of the weights
+        srcData.resize(512 * 512);
+        for (size_t i = 0; i < srcData.size(); i++)
+            srcData[i] = static_cast<float>(i % 97) - 48.f;
+        desc = std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape{512, 512});
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
+    // finds the blob of srcData, the copy of the source stands for the reordered weights
+    MemoryPtr findOrCreate(const WeightsFileCache& cache, size_t& createCalls) {
+        Memory src(eng);
+        src.Create(desc, srcData.data());
+        return cache.findOrCreate(src, *desc, [&]() {
+            createCalls++;
+            auto mem = std::make_shared<Memory>(eng);
+            mem->Create(desc, srcData.data());
+            return mem;
+        });
+    }
+
+    void expectSrcData(const MemoryPtr& mem) {
+        ASSERT_NE(nullptr, mem);
+        ASSERT_EQ(srcData.size() * sizeof(float), mem->GetSize());
+        EXPECT_EQ(0, std::memcmp(srcData.data(), mem->GetData(), mem->GetSize()));
+    }
+
+    std::vector<std::string> blobs() const {
+        return CommonTestUtils::listFilesWithExt(cacheDir, "blob");
+    }
+
+    const std::string cacheDir = "weights_file_cache_test";
+    dnnl::engine eng{dnnl::engine::kind::cpu, 0};
+    std::vector<float> srcData;
+    CpuBlockedMemoryDescPtr desc;
+};
+
+TEST_F(WeightsFileCacheTest, missCreatesBlob) {
+    WeightsFileCache cache(cacheDir);
+    size_t createCalls = 0;
+    auto mem = findOrCreate(cache, createCalls);
+    EXPECT_EQ(1, createCalls);
+    expectSrcData(mem);
+    EXPECT_EQ(1, blobs().size());
+}
+
+TEST_F(WeightsFileCacheTest, hitMapsBlob) {
+    size_t createCalls = 0;
+    findOrCreate(WeightsFileCache(cacheDir), createCalls);
+
+    // another cache instance stands for the subsequent compilation
+    WeightsFileCache cache(cacheDir);
+    auto mem = findOrCreate(cache, createCalls);
+    EXPECT_EQ(1, createCalls);
+    expectSrcData(mem);
+    EXPECT_EQ(1, blobs().size());
+}
+
+TEST_F(WeightsFileCacheTest, corruptedBlobIsRecreated) {
+    size_t createCalls = 0;
+    findOrCreate(WeightsFileCache(cacheDir), createCalls);
+    ASSERT_EQ(1, blobs().size());
+    const auto path = blobs().front();
+
+    // a truncated blob, and a blob of the right size without the trailer
+    for (size_t size : {srcData.size() * sizeof(float) / 2, srcData.size() * sizeof(float) + 16}) {
+        {
+            std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+            const std::vector<char> garbage(size, 0x5a);
+            stream.write(garbage.data(), garbage.size());
+        }
+        WeightsFileCache cache(cacheDir);
+        const auto calls = createCalls;
+        expectSrcData(findOrCreate(cache, createCalls));
+        EXPECT_EQ(calls + 1, createCalls);
+
+        // the recreated blob is stored back
+        expectSrcData(findOrCreate(cache, createCalls));
+        EXPECT_EQ(calls + 1, createCalls);
+    }
+}
+
+TEST_F(WeightsFileCacheTest, changedWeightsAreNotMatched) {
+    size_t createCalls = 0;
+    findOrCreate(WeightsFileCache(cacheDir), createCalls);
+
+    // a single changed element anywhere in the data gives a separate blob, never the stale one
+    for (size_t idx : {size_t{25}, srcData.size() / 2 + 3, srcData.size() - 1}) {
+        srcData[idx] += 1.f;
+        WeightsFileCache cache(cacheDir);
+        const auto calls = createCalls;
+        expectSrcData(findOrCreate(cache, createCalls));
+        EXPECT_EQ(calls + 1, createCalls);
+    }
+    EXPECT_EQ(4, blobs().size());
+}